@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HostBench.dir/HostBench.cpp.o"
+  "CMakeFiles/HostBench.dir/HostBench.cpp.o.d"
+  "CMakeFiles/HostBench.dir/ReaderDefaults.cpp.o"
+  "CMakeFiles/HostBench.dir/ReaderDefaults.cpp.o.d"
+  "HostBench"
+  "HostBench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HostBench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
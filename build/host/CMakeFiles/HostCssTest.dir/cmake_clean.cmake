@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HostCssTest.dir/HostCssTest.cpp.o"
+  "CMakeFiles/HostCssTest.dir/HostCssTest.cpp.o.d"
+  "HostCssTest"
+  "HostCssTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HostCssTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
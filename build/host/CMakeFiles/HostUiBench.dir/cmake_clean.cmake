@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HostUiBench.dir/AppFonts.cpp.o"
+  "CMakeFiles/HostUiBench.dir/AppFonts.cpp.o.d"
+  "CMakeFiles/HostUiBench.dir/HostUiBench.cpp.o"
+  "CMakeFiles/HostUiBench.dir/HostUiBench.cpp.o.d"
+  "HostUiBench"
+  "HostUiBench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HostUiBench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
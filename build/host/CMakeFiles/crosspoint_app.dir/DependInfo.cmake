@@ -0,0 +1,58 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/KOReaderSync/KOReaderCredentialStore.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/lib/KOReaderSync/KOReaderCredentialStore.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/lib/KOReaderSync/KOReaderCredentialStore.cpp.o.d"
+  "/root/repo/src/CrossPointSettings.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/CrossPointSettings.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/CrossPointSettings.cpp.o.d"
+  "/root/repo/src/CrossPointState.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/CrossPointState.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/CrossPointState.cpp.o.d"
+  "/root/repo/src/MappedInputManager.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/MappedInputManager.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/MappedInputManager.cpp.o.d"
+  "/root/repo/src/RecentBooksStore.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/RecentBooksStore.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/RecentBooksStore.cpp.o.d"
+  "/root/repo/src/WifiCredentialStore.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/WifiCredentialStore.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/WifiCredentialStore.cpp.o.d"
+  "/root/repo/src/WorkerService.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/WorkerService.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/WorkerService.cpp.o.d"
+  "/root/repo/src/activities/ActivityWithSubactivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/ActivityWithSubactivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/ActivityWithSubactivity.cpp.o.d"
+  "/root/repo/src/activities/DisplayTask.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/DisplayTask.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/DisplayTask.cpp.o.d"
+  "/root/repo/src/activities/boot_sleep/BootActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/boot_sleep/BootActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/boot_sleep/BootActivity.cpp.o.d"
+  "/root/repo/src/activities/boot_sleep/SleepActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/boot_sleep/SleepActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/boot_sleep/SleepActivity.cpp.o.d"
+  "/root/repo/src/activities/home/HomeActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/HomeActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/HomeActivity.cpp.o.d"
+  "/root/repo/src/activities/home/MyLibraryActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/MyLibraryActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/MyLibraryActivity.cpp.o.d"
+  "/root/repo/src/activities/home/RecentBooksActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/RecentBooksActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/RecentBooksActivity.cpp.o.d"
+  "/root/repo/src/activities/network/NetworkModeSelectionActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/network/NetworkModeSelectionActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/network/NetworkModeSelectionActivity.cpp.o.d"
+  "/root/repo/src/activities/reader/EpubReaderActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderActivity.cpp.o.d"
+  "/root/repo/src/activities/reader/EpubReaderChapterSelectionActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderChapterSelectionActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderChapterSelectionActivity.cpp.o.d"
+  "/root/repo/src/activities/reader/EpubReaderMenuActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderMenuActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderMenuActivity.cpp.o.d"
+  "/root/repo/src/activities/reader/EpubReaderPercentSelectionActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderPercentSelectionActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderPercentSelectionActivity.cpp.o.d"
+  "/root/repo/src/activities/reader/ReaderActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/ReaderActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/ReaderActivity.cpp.o.d"
+  "/root/repo/src/activities/reader/ReaderRefreshScheduler.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/ReaderRefreshScheduler.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/ReaderRefreshScheduler.cpp.o.d"
+  "/root/repo/src/activities/reader/TxtReaderActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/TxtReaderActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/TxtReaderActivity.cpp.o.d"
+  "/root/repo/src/activities/reader/XtcReaderActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/XtcReaderActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/XtcReaderActivity.cpp.o.d"
+  "/root/repo/src/activities/reader/XtcReaderChapterSelectionActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/XtcReaderChapterSelectionActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/XtcReaderChapterSelectionActivity.cpp.o.d"
+  "/root/repo/src/activities/settings/ButtonRemapActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/ButtonRemapActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/ButtonRemapActivity.cpp.o.d"
+  "/root/repo/src/activities/settings/CalibreSettingsActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/CalibreSettingsActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/CalibreSettingsActivity.cpp.o.d"
+  "/root/repo/src/activities/settings/ClearCacheActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/ClearCacheActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/ClearCacheActivity.cpp.o.d"
+  "/root/repo/src/activities/settings/KOReaderSettingsActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/KOReaderSettingsActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/KOReaderSettingsActivity.cpp.o.d"
+  "/root/repo/src/activities/settings/SettingsActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/SettingsActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/SettingsActivity.cpp.o.d"
+  "/root/repo/src/activities/util/FullScreenMessageActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/util/FullScreenMessageActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/util/FullScreenMessageActivity.cpp.o.d"
+  "/root/repo/src/activities/util/KeyboardEntryActivity.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/util/KeyboardEntryActivity.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/util/KeyboardEntryActivity.cpp.o.d"
+  "/root/repo/src/components/UITheme.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/components/UITheme.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/components/UITheme.cpp.o.d"
+  "/root/repo/src/components/themes/BaseTheme.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/components/themes/BaseTheme.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/components/themes/BaseTheme.cpp.o.d"
+  "/root/repo/src/components/themes/lyra/LyraTheme.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/components/themes/lyra/LyraTheme.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/components/themes/lyra/LyraTheme.cpp.o.d"
+  "/root/repo/src/util/ButtonNavigator.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/util/ButtonNavigator.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/util/ButtonNavigator.cpp.o.d"
+  "/root/repo/src/util/StringUtils.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/util/StringUtils.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/util/StringUtils.cpp.o.d"
+  "/root/repo/src/util/UrlUtils.cpp" "CMakeFiles/crosspoint_app.dir/root/repo/src/util/UrlUtils.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/root/repo/src/util/UrlUtils.cpp.o.d"
+  "/root/repo/host/src/MD5Builder.cpp" "CMakeFiles/crosspoint_app.dir/src/MD5Builder.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/src/MD5Builder.cpp.o.d"
+  "/root/repo/host/src/NetworkActivities.cpp" "CMakeFiles/crosspoint_app.dir/src/NetworkActivities.cpp.o" "gcc" "CMakeFiles/crosspoint_app.dir/src/NetworkActivities.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/host/CMakeFiles/crosspoint_host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
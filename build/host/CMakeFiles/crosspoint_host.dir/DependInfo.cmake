@@ -0,0 +1,71 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/expat/xmlparse.c" "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmlparse.c.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmlparse.c.o.d"
+  "/root/repo/lib/expat/xmlrole.c" "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmlrole.c.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmlrole.c.o.d"
+  "/root/repo/lib/expat/xmltok.c" "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmltok.c.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmltok.c.o.d"
+  "/root/repo/lib/miniz/miniz.c" "CMakeFiles/crosspoint_host.dir/root/repo/lib/miniz/miniz.c.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/miniz/miniz.c.o.d"
+  "/root/repo/lib/picojpeg/picojpeg.c" "CMakeFiles/crosspoint_host.dir/root/repo/lib/picojpeg/picojpeg.c.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/picojpeg/picojpeg.c.o.d"
+  "/root/repo/lib/EpdFont/EpdFont.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/EpdFont/EpdFont.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/EpdFont/EpdFont.cpp.o.d"
+  "/root/repo/lib/EpdFont/EpdFontFamily.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/EpdFont/EpdFontFamily.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/EpdFont/EpdFontFamily.cpp.o.d"
+  "/root/repo/lib/Epub/Epub.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/BookMetadataCache.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/BookMetadataCache.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/BookMetadataCache.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/Page.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/Page.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/Page.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/ParsedText.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/ParsedText.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/ParsedText.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/Section.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/Section.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/Section.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/css/CssParser.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/htmlEntities.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/htmlEntities.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/htmlEntities.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/htmlTags.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/htmlTags.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/htmlTags.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/hyphenation/Hyphenator.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/Hyphenator.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/Hyphenator.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/hyphenation/SdHyphenationTrie.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/SdHyphenationTrie.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/SdHyphenationTrie.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/hyphenation/TrieBlockCache.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/TrieBlockCache.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/TrieBlockCache.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/parsers/ContainerParser.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ContainerParser.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ContainerParser.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/parsers/ContentOpfParser.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ContentOpfParser.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ContentOpfParser.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/parsers/TocNavParser.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/TocNavParser.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/TocNavParser.cpp.o.d"
+  "/root/repo/lib/Epub/Epub/parsers/TocNcxParser.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/TocNcxParser.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/TocNcxParser.cpp.o.d"
+  "/root/repo/lib/FsHelpers/FsHelpers.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/FsHelpers/FsHelpers.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/FsHelpers/FsHelpers.cpp.o.d"
+  "/root/repo/lib/GfxRenderer/Bitmap.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/Bitmap.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/Bitmap.cpp.o.d"
+  "/root/repo/lib/GfxRenderer/BitmapHelpers.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/BitmapHelpers.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/BitmapHelpers.cpp.o.d"
+  "/root/repo/lib/GfxRenderer/DirtyRegion.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/DirtyRegion.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/DirtyRegion.cpp.o.d"
+  "/root/repo/lib/GfxRenderer/FontRegistry.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/FontRegistry.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/FontRegistry.cpp.o.d"
+  "/root/repo/lib/GfxRenderer/GfxRenderer.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/GfxRenderer.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/GfxRenderer.cpp.o.d"
+  "/root/repo/lib/GfxRenderer/GlyphCache.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/GlyphCache.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/GlyphCache.cpp.o.d"
+  "/root/repo/lib/JpegToBmpConverter/JpegToBmpConverter.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/JpegToBmpConverter/JpegToBmpConverter.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/JpegToBmpConverter/JpegToBmpConverter.cpp.o.d"
+  "/root/repo/lib/Logging/HeapAccounting.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/HeapAccounting.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/HeapAccounting.cpp.o.d"
+  "/root/repo/lib/Logging/Logging.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/Logging.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/Logging.cpp.o.d"
+  "/root/repo/lib/Logging/Trace.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/Trace.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/Trace.cpp.o.d"
+  "/root/repo/lib/Txt/Txt.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Txt/Txt.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Txt/Txt.cpp.o.d"
+  "/root/repo/lib/Txt/TxtPaginator.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Txt/TxtPaginator.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Txt/TxtPaginator.cpp.o.d"
+  "/root/repo/lib/Utf8/Utf8.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Utf8/Utf8.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Utf8/Utf8.cpp.o.d"
+  "/root/repo/lib/Xtc/Xtc.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Xtc/Xtc.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Xtc/Xtc.cpp.o.d"
+  "/root/repo/lib/Xtc/Xtc/XtcParser.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Xtc/Xtc/XtcParser.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/Xtc/Xtc/XtcParser.cpp.o.d"
+  "/root/repo/lib/ZipFile/ZipFile.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/ZipFile/ZipFile.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/ZipFile/ZipFile.cpp.o.d"
+  "/root/repo/lib/hal/HalDisplay.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalDisplay.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalDisplay.cpp.o.d"
+  "/root/repo/lib/hal/HalGPIO.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalGPIO.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalGPIO.cpp.o.d"
+  "/root/repo/lib/hal/HalStorage.cpp" "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalStorage.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalStorage.cpp.o.d"
+  "/root/repo/host/src/Arduino.cpp" "CMakeFiles/crosspoint_host.dir/src/Arduino.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/src/Arduino.cpp.o.d"
+  "/root/repo/host/src/EInkDisplay.cpp" "CMakeFiles/crosspoint_host.dir/src/EInkDisplay.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/src/EInkDisplay.cpp.o.d"
+  "/root/repo/host/src/FreeRTOS.cpp" "CMakeFiles/crosspoint_host.dir/src/FreeRTOS.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/src/FreeRTOS.cpp.o.d"
+  "/root/repo/host/src/HalGPIO.cpp" "CMakeFiles/crosspoint_host.dir/src/HalGPIO.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/src/HalGPIO.cpp.o.d"
+  "/root/repo/host/src/HostStats.cpp" "CMakeFiles/crosspoint_host.dir/src/HostStats.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/src/HostStats.cpp.o.d"
+  "/root/repo/host/src/SDCardManager.cpp" "CMakeFiles/crosspoint_host.dir/src/SDCardManager.cpp.o" "gcc" "CMakeFiles/crosspoint_host.dir/src/SDCardManager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,115 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/EpdFont/EpdFont.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/EpdFont/EpdFont.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/EpdFont/EpdFontFamily.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/EpdFont/EpdFontFamily.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/BookMetadataCache.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/BookMetadataCache.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/Page.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/Page.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/ParsedText.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/ParsedText.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/Section.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/Section.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/css/CssParser.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/htmlEntities.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/htmlEntities.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/htmlTags.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/htmlTags.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/Hyphenator.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/Hyphenator.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/SdHyphenationTrie.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/SdHyphenationTrie.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/TrieBlockCache.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/hyphenation/TrieBlockCache.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ContainerParser.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ContainerParser.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ContentOpfParser.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/ContentOpfParser.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/TocNavParser.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/TocNavParser.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/TocNcxParser.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Epub/Epub/parsers/TocNcxParser.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/FsHelpers/FsHelpers.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/FsHelpers/FsHelpers.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/Bitmap.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/Bitmap.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/BitmapHelpers.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/BitmapHelpers.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/DirtyRegion.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/DirtyRegion.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/FontRegistry.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/FontRegistry.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/GfxRenderer.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/GfxRenderer.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/GlyphCache.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/GfxRenderer/GlyphCache.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/JpegToBmpConverter/JpegToBmpConverter.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/JpegToBmpConverter/JpegToBmpConverter.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/HeapAccounting.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/HeapAccounting.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/Logging.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/Logging.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/Trace.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Logging/Trace.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Txt/Txt.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Txt/Txt.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Txt/TxtPaginator.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Txt/TxtPaginator.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Utf8/Utf8.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Utf8/Utf8.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Xtc/Xtc.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Xtc/Xtc.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Xtc/Xtc/XtcParser.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/Xtc/Xtc/XtcParser.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/ZipFile/ZipFile.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/ZipFile/ZipFile.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmlparse.c.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmlparse.c.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmlrole.c.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmlrole.c.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmltok.c.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/expat/xmltok.c.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalDisplay.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalDisplay.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalGPIO.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalGPIO.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalStorage.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/hal/HalStorage.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/miniz/miniz.c.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/miniz/miniz.c.o.d"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/picojpeg/picojpeg.c.o"
+  "CMakeFiles/crosspoint_host.dir/root/repo/lib/picojpeg/picojpeg.c.o.d"
+  "CMakeFiles/crosspoint_host.dir/src/Arduino.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/src/Arduino.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/src/EInkDisplay.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/src/EInkDisplay.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/src/FreeRTOS.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/src/FreeRTOS.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/src/HalGPIO.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/src/HalGPIO.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/src/HostStats.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/src/HostStats.cpp.o.d"
+  "CMakeFiles/crosspoint_host.dir/src/SDCardManager.cpp.o"
+  "CMakeFiles/crosspoint_host.dir/src/SDCardManager.cpp.o.d"
+  "libcrosspoint_host.a"
+  "libcrosspoint_host.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/crosspoint_host.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/host/AppFonts.cpp" "CMakeFiles/HostApp.dir/AppFonts.cpp.o" "gcc" "CMakeFiles/HostApp.dir/AppFonts.cpp.o.d"
+  "/root/repo/host/HostApp.cpp" "CMakeFiles/HostApp.dir/HostApp.cpp.o" "gcc" "CMakeFiles/HostApp.dir/HostApp.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/hostw/CMakeFiles/crosspoint_app.dir/DependInfo.cmake"
+  "/root/repo/build/hostw/CMakeFiles/crosspoint_host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
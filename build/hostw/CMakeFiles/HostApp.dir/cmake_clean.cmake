@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HostApp.dir/AppFonts.cpp.o"
+  "CMakeFiles/HostApp.dir/AppFonts.cpp.o.d"
+  "CMakeFiles/HostApp.dir/HostApp.cpp.o"
+  "CMakeFiles/HostApp.dir/HostApp.cpp.o.d"
+  "HostApp"
+  "HostApp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HostApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/host/HostReader.cpp" "CMakeFiles/HostReader.dir/HostReader.cpp.o" "gcc" "CMakeFiles/HostReader.dir/HostReader.cpp.o.d"
+  "/root/repo/host/ReaderDefaults.cpp" "CMakeFiles/HostReader.dir/ReaderDefaults.cpp.o" "gcc" "CMakeFiles/HostReader.dir/ReaderDefaults.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/hostw/CMakeFiles/crosspoint_host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HostReader.dir/HostReader.cpp.o"
+  "CMakeFiles/HostReader.dir/HostReader.cpp.o.d"
+  "CMakeFiles/HostReader.dir/ReaderDefaults.cpp.o"
+  "CMakeFiles/HostReader.dir/ReaderDefaults.cpp.o.d"
+  "HostReader"
+  "HostReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HostReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
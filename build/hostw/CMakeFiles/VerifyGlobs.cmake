@@ -0,0 +1,200 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/EpdFont/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/EpdFont/EpdFont.cpp"
+  "/root/repo/lib/EpdFont/EpdFontFamily.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/Epub/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/Epub/Epub.cpp"
+  "/root/repo/lib/Epub/Epub/BookMetadataCache.cpp"
+  "/root/repo/lib/Epub/Epub/Page.cpp"
+  "/root/repo/lib/Epub/Epub/ParsedText.cpp"
+  "/root/repo/lib/Epub/Epub/Section.cpp"
+  "/root/repo/lib/Epub/Epub/blocks/TextBlock.cpp"
+  "/root/repo/lib/Epub/Epub/css/CssParser.cpp"
+  "/root/repo/lib/Epub/Epub/htmlEntities.cpp"
+  "/root/repo/lib/Epub/Epub/htmlTags.cpp"
+  "/root/repo/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "/root/repo/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "/root/repo/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "/root/repo/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "/root/repo/lib/Epub/Epub/hyphenation/SdHyphenationTrie.cpp"
+  "/root/repo/lib/Epub/Epub/hyphenation/TrieBlockCache.cpp"
+  "/root/repo/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp"
+  "/root/repo/lib/Epub/Epub/parsers/ContainerParser.cpp"
+  "/root/repo/lib/Epub/Epub/parsers/ContentOpfParser.cpp"
+  "/root/repo/lib/Epub/Epub/parsers/TocNavParser.cpp"
+  "/root/repo/lib/Epub/Epub/parsers/TocNcxParser.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/FsHelpers/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/FsHelpers/FsHelpers.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/GfxRenderer/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/GfxRenderer/Bitmap.cpp"
+  "/root/repo/lib/GfxRenderer/BitmapHelpers.cpp"
+  "/root/repo/lib/GfxRenderer/DirtyRegion.cpp"
+  "/root/repo/lib/GfxRenderer/FontRegistry.cpp"
+  "/root/repo/lib/GfxRenderer/GfxRenderer.cpp"
+  "/root/repo/lib/GfxRenderer/GlyphCache.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/JpegToBmpConverter/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/JpegToBmpConverter/JpegToBmpConverter.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/Logging/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/Logging/HeapAccounting.cpp"
+  "/root/repo/lib/Logging/Logging.cpp"
+  "/root/repo/lib/Logging/Trace.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/Txt/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/Txt/Txt.cpp"
+  "/root/repo/lib/Txt/TxtPaginator.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/Utf8/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/Utf8/Utf8.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/Xtc/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/Xtc/Xtc.cpp"
+  "/root/repo/lib/Xtc/Xtc/XtcParser.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/ZipFile/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/ZipFile/ZipFile.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# LIB_SOURCES at CMakeLists.txt:21 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/lib/hal/*.cpp")
+set(OLD_GLOB
+  "/root/repo/lib/hal/HalDisplay.cpp"
+  "/root/repo/lib/hal/HalGPIO.cpp"
+  "/root/repo/lib/hal/HalStorage.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
+
+# APP_SOURCES at CMakeLists.txt:95 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/src/*.cpp")
+set(OLD_GLOB
+  "/root/repo/src/CrossPointSettings.cpp"
+  "/root/repo/src/CrossPointState.cpp"
+  "/root/repo/src/MappedInputManager.cpp"
+  "/root/repo/src/RecentBooksStore.cpp"
+  "/root/repo/src/WifiCredentialStore.cpp"
+  "/root/repo/src/WorkerService.cpp"
+  "/root/repo/src/activities/ActivityWithSubactivity.cpp"
+  "/root/repo/src/activities/DisplayTask.cpp"
+  "/root/repo/src/activities/boot_sleep/BootActivity.cpp"
+  "/root/repo/src/activities/boot_sleep/SleepActivity.cpp"
+  "/root/repo/src/activities/browser/OpdsBookBrowserActivity.cpp"
+  "/root/repo/src/activities/home/HomeActivity.cpp"
+  "/root/repo/src/activities/home/MyLibraryActivity.cpp"
+  "/root/repo/src/activities/home/RecentBooksActivity.cpp"
+  "/root/repo/src/activities/network/CalibreConnectActivity.cpp"
+  "/root/repo/src/activities/network/CrossPointWebServerActivity.cpp"
+  "/root/repo/src/activities/network/NetworkModeSelectionActivity.cpp"
+  "/root/repo/src/activities/network/WifiSelectionActivity.cpp"
+  "/root/repo/src/activities/reader/EpubReaderActivity.cpp"
+  "/root/repo/src/activities/reader/EpubReaderChapterSelectionActivity.cpp"
+  "/root/repo/src/activities/reader/EpubReaderMenuActivity.cpp"
+  "/root/repo/src/activities/reader/EpubReaderPercentSelectionActivity.cpp"
+  "/root/repo/src/activities/reader/KOReaderSyncActivity.cpp"
+  "/root/repo/src/activities/reader/ReaderActivity.cpp"
+  "/root/repo/src/activities/reader/ReaderRefreshScheduler.cpp"
+  "/root/repo/src/activities/reader/TxtReaderActivity.cpp"
+  "/root/repo/src/activities/reader/XtcReaderActivity.cpp"
+  "/root/repo/src/activities/reader/XtcReaderChapterSelectionActivity.cpp"
+  "/root/repo/src/activities/settings/ButtonRemapActivity.cpp"
+  "/root/repo/src/activities/settings/CalibreSettingsActivity.cpp"
+  "/root/repo/src/activities/settings/ClearCacheActivity.cpp"
+  "/root/repo/src/activities/settings/KOReaderAuthActivity.cpp"
+  "/root/repo/src/activities/settings/KOReaderSettingsActivity.cpp"
+  "/root/repo/src/activities/settings/OtaUpdateActivity.cpp"
+  "/root/repo/src/activities/settings/SettingsActivity.cpp"
+  "/root/repo/src/activities/util/FullScreenMessageActivity.cpp"
+  "/root/repo/src/activities/util/KeyboardEntryActivity.cpp"
+  "/root/repo/src/components/UITheme.cpp"
+  "/root/repo/src/components/themes/BaseTheme.cpp"
+  "/root/repo/src/components/themes/lyra/LyraTheme.cpp"
+  "/root/repo/src/main.cpp"
+  "/root/repo/src/network/CrossPointWebServer.cpp"
+  "/root/repo/src/network/HttpDownloader.cpp"
+  "/root/repo/src/network/OtaUpdater.cpp"
+  "/root/repo/src/util/ButtonNavigator.cpp"
+  "/root/repo/src/util/StringUtils.cpp"
+  "/root/repo/src/util/UrlUtils.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/build/hostw/CMakeFiles/cmake.verify_globs")
+endif()
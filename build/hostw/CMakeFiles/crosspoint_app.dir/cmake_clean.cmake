@@ -0,0 +1,87 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/crosspoint_app.dir/root/repo/lib/KOReaderSync/KOReaderCredentialStore.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/lib/KOReaderSync/KOReaderCredentialStore.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/CrossPointSettings.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/CrossPointSettings.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/CrossPointState.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/CrossPointState.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/MappedInputManager.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/MappedInputManager.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/RecentBooksStore.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/RecentBooksStore.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/WifiCredentialStore.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/WifiCredentialStore.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/WorkerService.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/WorkerService.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/ActivityWithSubactivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/ActivityWithSubactivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/DisplayTask.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/DisplayTask.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/boot_sleep/BootActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/boot_sleep/BootActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/boot_sleep/SleepActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/boot_sleep/SleepActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/HomeActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/HomeActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/MyLibraryActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/MyLibraryActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/RecentBooksActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/home/RecentBooksActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/network/NetworkModeSelectionActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/network/NetworkModeSelectionActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderChapterSelectionActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderChapterSelectionActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderMenuActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderMenuActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderPercentSelectionActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/EpubReaderPercentSelectionActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/ReaderActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/ReaderActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/ReaderRefreshScheduler.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/ReaderRefreshScheduler.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/TxtReaderActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/TxtReaderActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/XtcReaderActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/XtcReaderActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/XtcReaderChapterSelectionActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/reader/XtcReaderChapterSelectionActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/ButtonRemapActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/ButtonRemapActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/CalibreSettingsActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/CalibreSettingsActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/ClearCacheActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/ClearCacheActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/KOReaderSettingsActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/KOReaderSettingsActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/SettingsActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/settings/SettingsActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/util/FullScreenMessageActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/util/FullScreenMessageActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/util/KeyboardEntryActivity.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/activities/util/KeyboardEntryActivity.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/components/UITheme.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/components/UITheme.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/components/themes/BaseTheme.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/components/themes/BaseTheme.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/components/themes/lyra/LyraTheme.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/components/themes/lyra/LyraTheme.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/util/ButtonNavigator.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/util/ButtonNavigator.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/util/StringUtils.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/util/StringUtils.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/util/UrlUtils.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/root/repo/src/util/UrlUtils.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/src/MD5Builder.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/src/MD5Builder.cpp.o.d"
+  "CMakeFiles/crosspoint_app.dir/src/NetworkActivities.cpp.o"
+  "CMakeFiles/crosspoint_app.dir/src/NetworkActivities.cpp.o.d"
+  "libcrosspoint_app.a"
+  "libcrosspoint_app.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/crosspoint_app.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
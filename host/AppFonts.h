@@ -0,0 +1,8 @@
+#pragma once
+
+#include <GfxRenderer.h>
+
+// The fonts main.cpp registers, for the host tools that run the activities
+namespace AppFonts {
+void insert(GfxRenderer& renderer);
+}  // namespace AppFonts
@@ -0,0 +1,239 @@
+// Runs the firmware's activities on the host the way main.cpp does: boot to the home screen (or straight into a book),
+// then feed the activities buttons from a HostInput script until it has been played. Every refresh is written to
+// $CROSSPOINT_FRAME_DIR, the activities that need WiFi leave immediately (see src/NetworkActivities.cpp).
+//
+//   HostApp [--book /books/book.epub] [--input script.txt] [--keys "DOWN;CONFIRM"] [--settle ms] [--trace trace.txt]
+//   [--heap] [--storage]
+//
+// Settings, reading progress and caches live on the emulated SD card ($CROSSPOINT_SD_ROOT, default ./sdcard) like on
+// the device. After the script the activities keep running for --settle ms (default 1000) so their display task and
+// background jobs can finish. --trace, --heap and --storage work like HostReader's.
+
+#include <EInkDisplay.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalGPIO.h>
+#include <HalStorage.h>
+#include <HeapAccounting.h>
+#include <HostInput.h>
+#include <Logging.h>
+#include <Trace.h>
+
+#include <cstring>
+#include <string>
+
+#include "AppFonts.h"
+#include "CrossPointSettings.h"
+#include "CrossPointState.h"
+#include "KOReaderCredentialStore.h"
+#include "MappedInputManager.h"
+#include "RecentBooksStore.h"
+#include "WorkerService.h"
+#include "activities/boot_sleep/BootActivity.h"
+#include "activities/boot_sleep/SleepActivity.h"
+#include "activities/home/HomeActivity.h"
+#include "activities/home/MyLibraryActivity.h"
+#include "activities/home/RecentBooksActivity.h"
+#include "activities/reader/ReaderActivity.h"
+#include "activities/settings/SettingsActivity.h"
+#include "components/UITheme.h"
+#include "util/ButtonNavigator.h"
+
+namespace {
+HalDisplay display;
+HalGPIO gpio;
+MappedInputManager mappedInputManager(gpio);
+GfxRenderer renderer(display);
+Activity* currentActivity = nullptr;
+bool asleep = false;
+
+unsigned long activitySwitchStart = 0;
+
+void exitActivity() {
+  activitySwitchStart = millis();
+  if (currentActivity) {
+    currentActivity->onExit();
+    delete currentActivity;
+    currentActivity = nullptr;
+  }
+}
+
+void enterNewActivity(Activity* activity) {
+  currentActivity = activity;
+  currentActivity->onEnter();
+  LOG_DBG("HOST", "Activity switch took %lums, free heap %lu bytes", millis() - activitySwitchStart,
+          static_cast<unsigned long>(ESP.getFreeHeap()));
+}
+
+// Like main.cpp's enterDeepSleep(), minus the deep sleep: the run ends on the sleep screen
+void enterSleep() {
+  APP_STATE.lastSleepFromReader = currentActivity && currentActivity->isReaderActivity();
+  APP_STATE.saveToFile();
+  exitActivity();
+  enterNewActivity(new SleepActivity(renderer, mappedInputManager));
+  asleep = true;
+}
+
+void onGoHome();
+void onGoToMyLibraryWithPath(const std::string& path);
+
+void onGoToReader(const std::string& initialEpubPath) {
+  exitActivity();
+  enterNewActivity(
+      new ReaderActivity(renderer, mappedInputManager, initialEpubPath, onGoHome, onGoToMyLibraryWithPath));
+}
+
+void onGoToSettings() {
+  exitActivity();
+  enterNewActivity(new SettingsActivity(renderer, mappedInputManager, onGoHome));
+}
+
+void onGoToMyLibrary() {
+  exitActivity();
+  enterNewActivity(new MyLibraryActivity(renderer, mappedInputManager, onGoHome, onGoToReader));
+}
+
+void onGoToRecentBooks() {
+  exitActivity();
+  enterNewActivity(new RecentBooksActivity(renderer, mappedInputManager, onGoHome, onGoToReader));
+}
+
+void onGoToMyLibraryWithPath(const std::string& path) {
+  exitActivity();
+  enterNewActivity(new MyLibraryActivity(renderer, mappedInputManager, onGoHome, onGoToReader, path));
+}
+
+// File transfer and the OPDS browser are network only, the home screen stays
+void onGoToNetworkOnly() { LOG_INF("EMU", "No network on the host"); }
+
+void onGoHome() {
+  exitActivity();
+  enterNewActivity(new HomeActivity(renderer, mappedInputManager, onGoToReader, onGoToMyLibrary, onGoToRecentBooks,
+                                    onGoToSettings, onGoToNetworkOnly, onGoToNetworkOnly));
+}
+
+// One iteration of main.cpp's loop(), without the serial commands and auto-sleep
+void loopOnce() {
+  gpio.update();
+  renderer.setFadingFix(SETTINGS.fadingFix);
+
+  if (gpio.isPressed(HalGPIO::BTN_POWER) && gpio.getHeldTime() > SETTINGS.getPowerButtonDuration()) {
+    enterSleep();
+    return;
+  }
+
+  const unsigned long start = millis();
+  if (currentActivity) {
+    currentActivity->loop();
+  }
+  const unsigned long duration = millis() - start;
+  if (duration > 50) {
+    LOG_DBG("HOST", "Activity loop took %lums", duration);
+  }
+  delay(10);
+}
+
+class FilePrint : public Print {
+  FILE* file;
+
+ public:
+  explicit FilePrint(FILE* file) : file(file) {}
+  size_t write(const uint8_t b) override { return fputc(b, file) == EOF ? 0 : 1; }
+  size_t write(const uint8_t* buffer, const size_t size) override { return fwrite(buffer, 1, size, file); }
+  using Print::write;
+};
+
+void usage() {
+  fprintf(stderr, "usage: HostApp [--book path] [--input script] [--keys \"DOWN;CONFIRM\"] [--settle ms] "
+                  "[--trace file] [--heap] [--storage]\n");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* bookPath = nullptr;
+  unsigned long settleMs = 1000;
+  const char* tracePath = nullptr;
+  bool heapReport = false;
+  bool storageReport = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--book") && i + 1 < argc) {
+      bookPath = argv[++i];
+    } else if (!strcmp(argv[i], "--input") && i + 1 < argc) {
+      if (!HostInput::loadScript(argv[++i])) {
+        return 2;
+      }
+    } else if (!strcmp(argv[i], "--keys") && i + 1 < argc) {
+      if (!HostInput::loadScriptText(argv[++i])) {
+        return 2;
+      }
+    } else if (!strcmp(argv[i], "--settle") && i + 1 < argc) {
+      settleMs = strtoul(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else if (!strcmp(argv[i], "--heap")) {
+      heapReport = true;
+    } else if (!strcmp(argv[i], "--storage")) {
+      storageReport = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  gpio.begin();
+  if (!Storage.begin()) {
+    return 1;
+  }
+  SETTINGS.loadFromFile();
+  KOREADER_STORE.loadFromFile();
+  UITheme::getInstance().reload();
+  ButtonNavigator::setMappedInputManager(mappedInputManager);
+
+  display.begin();
+  renderer.begin();
+  WORKER.begin();
+  AppFonts::insert(renderer);
+
+  exitActivity();
+  enterNewActivity(new BootActivity(renderer, mappedInputManager));
+  APP_STATE.loadFromFile();
+  RECENT_BOOKS.loadFromFile();
+  if (bookPath) {
+    onGoToReader(bookPath);
+  } else {
+    onGoHome();
+  }
+
+  [[maybe_unused]] const unsigned long runStart = millis();
+  while (!asleep && !HostInput::finished()) {
+    loopOnce();
+  }
+  const unsigned long settleStart = millis();
+  while (!asleep && millis() - settleStart < settleMs) {
+    loopOnce();
+  }
+  LOG_INF("HOST", "Played the input in %lums, %lu frames, %lu bytes of emulated heap free (min %lu)",
+          settleStart - runStart, static_cast<unsigned long>(EInkDisplay::getFrameCount()),
+          static_cast<unsigned long>(ESP.getFreeHeap()), static_cast<unsigned long>(ESP.getMinFreeHeap()));
+  exitActivity();
+
+  if (tracePath) {
+    FILE* traceFile = fopen(tracePath, "w");
+    if (!traceFile) {
+      LOG_ERR("HOST", "Can't write %s", tracePath);
+      return 1;
+    }
+    FilePrint out(traceFile);
+    Trace::dump(out);
+    fclose(traceFile);
+  }
+  if (heapReport) {
+    FilePrint out(stdout);
+    HeapAccounting::printReport(out);
+  }
+  if (storageReport) {
+    FilePrint out(stdout);
+    Storage.printStats(out);
+  }
+  return 0;
+}
@@ -0,0 +1,599 @@
+// Benchmarks the reading pipeline on a corpus of books and prints the results as JSON.
+//
+//   HostBench [--runs N] [--out results.json] /bench [/books/other.epub ...]
+//
+// Paths are on the emulated SD card ($CROSSPOINT_SD_ROOT), directories are expanded to the .epub, .txt, .xtc and
+// .xtch files in them. Every run starts from an empty book cache. Per book and stage the report has the median wall
+// time and, from the last run, the heap allocations, the peak heap above the stage's starting point, the heap the
+// stage left allocated and the SD card traffic. Stages:
+//   epub: index (book.bin), css (loading the index and parsing the stylesheets, like opening the book the first time),
+//         open (loading the index and the CSS rule cache, like opening the book again),
+//         style (resolving the CSS style of every element, STYLE_PASSES times over the book's "elements"),
+//         paginate (building every section file), pageLoad (reading every page back), rasterize (drawing every page),
+//         grayPasses (anti-aliasing every page with a BW, an LSB and an MSB render, the reader's fallback),
+//         grayCapture (anti-aliasing every page with a single 2bpp capture render). Both gray stages end with the
+//         gray planes handed to the display, a page where the two paths show different images fails the book.
+//   txt:  index, read (the whole file in the reader's 8KB chunks), paginate (the reader's page index of the file)
+//   xtc:  index, pageLoad, rasterize
+// Logs go to stderr, the JSON to stdout unless --out is given.
+
+#include <Epub.h>
+#include <Epub/Page.h>
+#include <Epub/Section.h>
+#include <Epub/css/CssAncestors.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+#include <HostStats.h>
+#include <Logging.h>
+#include <Txt.h>
+#include <TxtPaginator.h>
+#include <Xtc.h>
+#include <expat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ReaderDefaults.h"
+
+namespace {
+HalDisplay display;
+GfxRenderer renderer(display);
+
+using namespace ReaderDefaults;
+
+constexpr size_t TXT_CHUNK_SIZE = 8 * 1024;  // TxtReaderActivity's CHUNK_SIZE
+// Resolving a chapter's styles takes microseconds, repeat it to get above the timer's noise
+constexpr int STYLE_PASSES = 100;
+
+// One stage of one run. A stage can be measured in several slices (e.g. once per page), they add up.
+struct Stage {
+  std::vector<double> runMs;
+  double ms = 0;
+  uint64_t allocations = 0;
+  uint64_t allocatedBytes = 0;
+  uint64_t peakHeapBytes = 0;
+  uint64_t retainedHeapBytes = 0;
+  uint64_t sdOpens = 0;
+  uint64_t sdBytesRead = 0;
+  uint64_t sdBytesWritten = 0;
+
+  void resetCounters() {
+    ms = 0;
+    allocations = allocatedBytes = peakHeapBytes = retainedHeapBytes = sdOpens = sdBytesRead = sdBytesWritten = 0;
+  }
+};
+
+class Slice {
+  Stage& stage;
+  HostStats::Counters start;
+  std::chrono::steady_clock::time_point startTime;
+
+ public:
+  explicit Slice(Stage& stage) : stage(stage) {
+    HostStats::resetPeak();
+    start = HostStats::snapshot();
+    startTime = std::chrono::steady_clock::now();
+  }
+
+  ~Slice() {
+    const auto endTime = std::chrono::steady_clock::now();
+    const auto end = HostStats::snapshot();
+    stage.ms += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    stage.allocations += end.allocations - start.allocations;
+    stage.allocatedBytes += end.allocatedBytes - start.allocatedBytes;
+    stage.peakHeapBytes = std::max(stage.peakHeapBytes, end.peakLiveBytes - start.liveBytes);
+    stage.retainedHeapBytes += end.liveBytes > start.liveBytes ? end.liveBytes - start.liveBytes : 0;
+    stage.sdOpens += end.sdOpens - start.sdOpens;
+    stage.sdBytesRead += end.sdBytesRead - start.sdBytesRead;
+    stage.sdBytesWritten += end.sdBytesWritten - start.sdBytesWritten;
+  }
+};
+
+struct BookResult {
+  std::string path;
+  const char* format = "";
+  bool ok = true;
+  uint32_t pages = 0;
+  uint32_t elements = 0;  // EPUB elements styled per pass of the style stage
+  // A deque so references handed out by stage() stay valid
+  std::deque<std::pair<const char*, Stage>> stages;
+
+  Stage& stage(const char* name) {
+    for (auto& [stageName, stage] : stages) {
+      if (!strcmp(stageName, name)) {
+        return stage;
+      }
+    }
+    stages.emplace_back(name, Stage{});
+    return stages.back().second;
+  }
+};
+
+bool hasExtension(const std::string& path, const char* extension) {
+  const size_t length = strlen(extension);
+  if (path.size() < length) {
+    return false;
+  }
+  return std::equal(path.end() - length, path.end(), extension,
+                    [](const char a, const char b) { return tolower(a) == tolower(b); });
+}
+
+// Tag, class attribute and nesting depth of an element, as ChapterHtmlSlimParser::startElement sees them
+struct Element {
+  std::string tag;
+  std::string classAttr;
+  int depth;
+};
+
+struct ElementCollector {
+  std::vector<Element>& elements;
+  int depth = 0;
+};
+
+void XMLCALL collectElement(void* userData, const XML_Char* name, const XML_Char** atts) {
+  auto* collector = static_cast<ElementCollector*>(userData);
+  Element element{name, "", collector->depth++};
+  for (int i = 0; atts[i]; i += 2) {
+    if (!strcmp(atts[i], "class")) {
+      element.classAttr = atts[i + 1];
+    }
+  }
+  collector->elements.push_back(std::move(element));
+}
+
+void XMLCALL closeElement(void* userData, const XML_Char*) { static_cast<ElementCollector*>(userData)->depth--; }
+
+bool collectElements(const Epub& epub, std::vector<Element>& elements) {
+  for (int i = 0; i < epub.getSpineItemsCount(); i++) {
+    size_t size = 0;
+    uint8_t* content = epub.readItemContentsToBytes(epub.getSpineItem(i).href, &size);
+    if (!content) {
+      return false;
+    }
+    ElementCollector collector{elements};
+    const XML_Parser parser = XML_ParserCreate(nullptr);
+    XML_SetUserData(parser, &collector);
+    XML_SetElementHandler(parser, collectElement, closeElement);
+    const bool parsed = XML_Parse(parser, reinterpret_cast<const char*>(content), static_cast<int>(size), 1);
+    XML_ParserFree(parser);
+    free(content);
+    if (!parsed) {
+      LOG_ERR("BENCH", "Failed to parse spine item %d", i);
+      return false;
+    }
+  }
+  return true;
+}
+
+void removeCache(const std::string& cachePath) {
+  if (Storage.exists(cachePath.c_str())) {
+    Storage.removeDir(cachePath.c_str());
+  }
+}
+
+// Whether the panel shows the same image as the given BW frame and gray planes. Gray only applies to white pixels,
+// so the planes may differ under black ones (a glyph's light edge overlapping its neighbour's black stem).
+bool sameGrayImage(const std::vector<uint8_t>& bw, const std::vector<uint8_t>& lsb, const std::vector<uint8_t>& msb) {
+  const uint8_t* frame = renderer.getFrameBuffer();
+  const uint8_t* displayLsb = EInkDisplay::getGrayscaleLsbBuffer();
+  const uint8_t* displayMsb = EInkDisplay::getGrayscaleMsbBuffer();
+  for (size_t i = 0; i < bw.size(); i++) {
+    const uint8_t grayDiff = (lsb[i] ^ displayLsb[i]) | (msb[i] ^ displayMsb[i]);
+    if ((bw[i] ^ frame[i]) | (bw[i] & grayDiff)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// EpubReaderActivity::renderContents with anti-aliasing, minus the BW refresh. Returns false if the capture produces
+// different gray planes than the separate passes.
+bool renderGray(BookResult& result, const Page& page, const Margins& bookMargins) {
+  {
+    Slice slice(result.stage("grayPasses"));
+    renderer.clearScreen();
+    renderer.setTextEmbolden(1);
+    page.render(renderer, FONT_ID, bookMargins.left, bookMargins.top);
+    renderer.storeBwBuffer();
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    page.render(renderer, FONT_ID, bookMargins.left, bookMargins.top);
+    renderer.copyGrayscaleLsbBuffers();
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+    page.render(renderer, FONT_ID, bookMargins.left, bookMargins.top);
+    renderer.copyGrayscaleMsbBuffers();
+    renderer.setTextEmbolden(0);
+    renderer.displayGrayBuffer();
+    renderer.setRenderMode(GfxRenderer::BW);
+    renderer.restoreBwBuffer();
+  }
+  const std::vector<uint8_t> bw(renderer.getFrameBuffer(), renderer.getFrameBuffer() + EInkDisplay::BUFFER_SIZE);
+  const std::vector<uint8_t> lsb(EInkDisplay::getGrayscaleLsbBuffer(),
+                                 EInkDisplay::getGrayscaleLsbBuffer() + EInkDisplay::BUFFER_SIZE);
+  const std::vector<uint8_t> msb(EInkDisplay::getGrayscaleMsbBuffer(),
+                                 EInkDisplay::getGrayscaleMsbBuffer() + EInkDisplay::BUFFER_SIZE);
+
+  {
+    Slice slice(result.stage("grayCapture"));
+    renderer.clearScreen();
+    if (!renderer.beginGrayscaleCapture()) {
+      return false;
+    }
+    renderer.setTextEmbolden(1);
+    page.render(renderer, FONT_ID, bookMargins.left, bookMargins.top);
+    renderer.setTextEmbolden(0);
+    renderer.endGrayscaleCapture();
+    renderer.displayGrayscaleCapture();
+  }
+  return sameGrayImage(bw, lsb, msb);
+}
+
+bool runEpub(BookResult& result) {
+  const Margins bookMargins = ReaderDefaults::margins(renderer);
+  const uint16_t width = renderer.getScreenWidth() - bookMargins.left - bookMargins.right;
+  const uint16_t height = renderer.getScreenHeight() - bookMargins.top - bookMargins.bottom;
+
+  removeCache(Epub(result.path, CACHE_DIR).getCachePath());
+  {
+    Epub epub(result.path, CACHE_DIR);
+    Slice slice(result.stage("index"));
+    if (!epub.load(true, true)) {
+      return false;
+    }
+  }
+
+  {
+    Epub epub(result.path, CACHE_DIR);
+    Slice slice(result.stage("css"));
+    if (!epub.load(false, false)) {
+      return false;
+    }
+  }
+
+  // Kept open for the stages below, its retained heap is what an open book costs
+  auto epub = std::make_shared<Epub>(result.path, CACHE_DIR);
+  {
+    Slice slice(result.stage("open"));
+    if (!epub->load(false, false)) {
+      return false;
+    }
+  }
+
+  std::vector<Element> elements;
+  if (!collectElements(*epub, elements)) {
+    return false;
+  }
+  if (const CssParser* css = epub->getCssParser()) {
+    // Same steps as ChapterHtmlSlimParser::startElement
+    std::unique_ptr<CssAncestors> ancestors(css->hasAncestorSelectors() ? new CssAncestors() : nullptr);
+    Slice slice(result.stage("style"));
+    uint32_t defined = 0;
+    for (int pass = 0; pass < STYLE_PASSES; pass++) {
+      for (const auto& element : elements) {
+        CssParser::SelectorId classIds[CssParser::MAX_CLASSES];
+        const size_t classCount = CssParser::classIds(element.classAttr.c_str(), classIds);
+        const CssParser::SelectorId tagId = CssParser::selectorId(element.tag.c_str());
+        if (ancestors) {
+          ancestors->popTo(element.depth);
+        }
+        defined += css->resolveStyle(tagId, classIds, classCount, ancestors.get()).defined.anySet();
+        if (ancestors) {
+          ancestors->push(element.depth, tagId, classIds, classCount);
+        }
+      }
+    }
+    result.elements = static_cast<uint32_t>(elements.size());
+    LOG_DBG("BENCH", "%zu elements, %lu styled", elements.size(), static_cast<unsigned long>(defined / STYLE_PASSES));
+  }
+
+  const int spineCount = epub->getSpineItemsCount();
+  {
+    Slice slice(result.stage("paginate"));
+    for (int i = 0; i < spineCount; i++) {
+      Section section(epub, i, renderer);
+      if (!section.createSectionFile(FONT_ID, LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, PARAGRAPH_ALIGNMENT, width,
+                                     height, HYPHENATION, EMBEDDED_STYLE)) {
+        LOG_ERR("BENCH", "Failed to build section %d of %s", i, result.path.c_str());
+        return false;
+      }
+    }
+  }
+
+  Stage& pageLoad = result.stage("pageLoad");
+  Stage& rasterize = result.stage("rasterize");
+  result.pages = 0;
+  for (int i = 0; i < spineCount; i++) {
+    Section section(epub, i, renderer);
+    {
+      Slice slice(pageLoad);
+      if (!section.loadSectionFile(FONT_ID, LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, PARAGRAPH_ALIGNMENT, width,
+                                   height, HYPHENATION, EMBEDDED_STYLE)) {
+        return false;
+      }
+    }
+    for (section.currentPage = 0; section.currentPage < section.pageCount; section.currentPage++) {
+      std::unique_ptr<Page> page;
+      {
+        Slice slice(pageLoad);
+        page = section.loadPageFromSectionFile();
+      }
+      if (!page) {
+        LOG_ERR("BENCH", "Failed to load page %d of section %d", section.currentPage, i);
+        return false;
+      }
+      {
+        Slice slice(rasterize);
+        renderer.clearScreen();
+        page->render(renderer, FONT_ID, bookMargins.left, bookMargins.top);
+      }
+      if (!renderGray(result, *page, bookMargins)) {
+        LOG_ERR("BENCH", "Anti-aliased page %d of section %d differs between the gray paths", section.currentPage, i);
+        return false;
+      }
+      result.pages++;
+    }
+  }
+  return true;
+}
+
+bool runTxt(BookResult& result) {
+  Txt txt(result.path, CACHE_DIR);
+  {
+    Slice slice(result.stage("index"));
+    if (!txt.load()) {
+      return false;
+    }
+  }
+
+  HalFile file;
+  if (!Storage.openFileForRead("BENCH", result.path, file)) {
+    return false;
+  }
+  const size_t fileSize = file.size();
+  file.close();
+
+  std::vector<uint8_t> buffer(TXT_CHUNK_SIZE);
+  {
+    Slice slice(result.stage("read"));
+    for (size_t offset = 0; offset < fileSize; offset += TXT_CHUNK_SIZE) {
+      if (!txt.readContent(buffer.data(), offset, std::min(TXT_CHUNK_SIZE, fileSize - offset))) {
+        return false;
+      }
+    }
+  }
+
+  // The page index TxtReaderActivity builds in the background, with the book margins
+  const Margins bookMargins = ReaderDefaults::margins(renderer);
+  const int width = renderer.getScreenWidth() - bookMargins.left - bookMargins.right;
+  const int height = renderer.getScreenHeight() - bookMargins.top - bookMargins.bottom;
+  const EpdFontFamily* font = renderer.getFont(FONT_ID);
+  if (!font) {
+    return false;
+  }
+
+  Slice slice(result.stage("paginate"));
+  TxtPaginator paginator(*font, width, std::max(1, height / renderer.getLineHeight(FONT_ID)));
+  std::vector<size_t> pageOffsets = {0};
+  paginator.onPage = [&](const size_t nextPageOffset) {
+    if (nextPageOffset < fileSize) {
+      pageOffsets.push_back(nextPageOffset);
+    }
+    return true;
+  };
+  paginator.restart(0);
+  if (!Storage.openFileForRead("BENCH", result.path, file)) {
+    return false;
+  }
+  for (size_t offset = 0; offset < fileSize; offset += TXT_CHUNK_SIZE) {
+    const size_t length = std::min(TXT_CHUNK_SIZE, fileSize - offset);
+    if (file.read(buffer.data(), length) != static_cast<int>(length)) {
+      file.close();
+      return false;
+    }
+    paginator.feed(buffer.data(), length);
+  }
+  paginator.finish();
+  file.close();
+  result.pages = static_cast<uint32_t>(pageOffsets.size());
+  return true;
+}
+
+bool runXtc(BookResult& result) {
+  Xtc xtc(result.path, CACHE_DIR);
+  removeCache(xtc.getCachePath());
+  {
+    Slice slice(result.stage("index"));
+    if (!xtc.load()) {
+      return false;
+    }
+  }
+
+  const uint16_t pageWidth = xtc.getPageWidth();
+  const uint16_t pageHeight = xtc.getPageHeight();
+  const size_t bufferSize = xtc.getBitDepth() == 2 ? ((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8) * 2
+                                                    : ((pageWidth + 7) / 8) * pageHeight;
+  std::vector<uint8_t> buffer(bufferSize);
+  Stage& pageLoad = result.stage("pageLoad");
+  Stage& rasterize = result.stage("rasterize");
+  result.pages = xtc.getPageCount();
+  for (uint32_t i = 0; i < result.pages; i++) {
+    {
+      Slice slice(pageLoad);
+      if (xtc.loadPage(i, buffer.data(), buffer.size()) == 0) {
+        LOG_ERR("BENCH", "Failed to load page %lu of %s", static_cast<unsigned long>(i), result.path.c_str());
+        return false;
+      }
+    }
+    if (xtc.getBitDepth() != 1) {
+      continue;
+    }
+    // XtcReaderActivity's 1-bit path
+    Slice slice(rasterize);
+    renderer.clearScreen();
+    const size_t rowBytes = (pageWidth + 7) / 8;
+    const uint16_t maxY = std::min<uint16_t>(pageHeight, renderer.getScreenHeight());
+    for (uint16_t y = 0; y < maxY; y++) {
+      for (uint16_t x = 0; x < pageWidth; x++) {
+        if (!((buffer[y * rowBytes + x / 8] >> (7 - x % 8)) & 1)) {
+          renderer.drawPixel(x, y, true);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+void printStage(FILE* out, const char* name, Stage& stage, const bool last) {
+  std::sort(stage.runMs.begin(), stage.runMs.end());
+  const double median = stage.runMs.empty() ? 0 : stage.runMs[stage.runMs.size() / 2];
+  fprintf(out,
+          "        \"%s\": {\"ms\": %.3f, \"allocations\": %llu, \"allocatedBytes\": %llu, \"peakHeapBytes\": %llu, "
+          "\"retainedHeapBytes\": %llu, \"sdOpens\": %llu, \"sdBytesRead\": %llu, "
+          "\"sdBytesWritten\": %llu}%s\n",
+          name, median, static_cast<unsigned long long>(stage.allocations),
+          static_cast<unsigned long long>(stage.allocatedBytes), static_cast<unsigned long long>(stage.peakHeapBytes),
+          static_cast<unsigned long long>(stage.retainedHeapBytes), static_cast<unsigned long long>(stage.sdOpens), static_cast<unsigned long long>(stage.sdBytesRead),
+          static_cast<unsigned long long>(stage.sdBytesWritten), last ? "" : ",");
+}
+
+// JSON string escaping for paths
+std::string quoted(const std::string& text) {
+  std::string result = "\"";
+  for (const char c : text) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result + "\"";
+}
+
+void usage() {
+  fprintf(stderr, "usage: HostBench [--runs N] [--out results.json] <book or directory on SD card>...\n");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  int runs = 3;
+  const char* outPath = nullptr;
+  // The gray stages refresh the emulated panel, writing every frame out would dominate their time
+  setenv("CROSSPOINT_FRAME_FORMAT", "none", 0);
+  std::vector<std::string> inputs;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--runs") && i + 1 < argc) {
+      runs = std::max(1, atoi(argv[++i]));
+    } else if (!strcmp(argv[i], "--out") && i + 1 < argc) {
+      outPath = argv[++i];
+    } else if (argv[i][0] == '-') {
+      usage();
+      return 2;
+    } else {
+      inputs.emplace_back(argv[i]);
+    }
+  }
+  if (inputs.empty()) {
+    usage();
+    return 2;
+  }
+
+  // Frames aren't looked at, don't spend time encoding them
+  setenv("CROSSPOINT_FRAME_FORMAT", "none", 0);
+  if (!Storage.begin()) {
+    return 1;
+  }
+  display.begin();
+  renderer.begin();
+  insertFonts(renderer);
+  Storage.mkdir(CACHE_DIR);
+
+  std::vector<BookResult> books;
+  for (const auto& input : inputs) {
+    HalFile entry = Storage.open(input.c_str());
+    const bool isDirectory = entry && entry.isDirectory();
+    entry.close();
+    std::vector<std::string> paths;
+    if (isDirectory) {
+      for (const auto& name : Storage.listFiles(input.c_str(), 1000)) {
+        paths.push_back(input + (input.back() == '/' ? "" : "/") + name.c_str());
+      }
+      std::sort(paths.begin(), paths.end());
+    } else {
+      paths.push_back(input);
+    }
+    for (const auto& path : paths) {
+      BookResult book;
+      book.path = path;
+      if (hasExtension(path, ".epub")) {
+        book.format = "epub";
+      } else if (hasExtension(path, ".txt")) {
+        book.format = "txt";
+      } else if (hasExtension(path, ".xtc") || hasExtension(path, ".xtch")) {
+        book.format = "xtc";
+      } else {
+        continue;
+      }
+      books.push_back(std::move(book));
+    }
+  }
+  if (books.empty()) {
+    LOG_ERR("BENCH", "No books found");
+    return 1;
+  }
+
+  for (auto& book : books) {
+    LOG_INF("BENCH", "%s (%d runs)", book.path.c_str(), runs);
+    for (int run = 0; run < runs && book.ok; run++) {
+      for (auto& [name, stage] : book.stages) {
+        stage.resetCounters();
+      }
+      if (!strcmp(book.format, "epub")) {
+        book.ok = runEpub(book);
+      } else if (!strcmp(book.format, "txt")) {
+        book.ok = runTxt(book);
+      } else {
+        book.ok = runXtc(book);
+      }
+      for (auto& [name, stage] : book.stages) {
+        stage.runMs.push_back(stage.ms);
+      }
+    }
+    if (!book.ok) {
+      LOG_ERR("BENCH", "Failed to benchmark %s", book.path.c_str());
+    }
+  }
+
+  FILE* out = outPath ? fopen(outPath, "w") : stdout;
+  if (!out) {
+    LOG_ERR("BENCH", "Can't write %s", outPath);
+    return 1;
+  }
+  fprintf(out, "{\n  \"version\": \"%s\",\n  \"runs\": %d,\n  \"books\": [\n", CROSSPOINT_VERSION, runs);
+  for (size_t i = 0; i < books.size(); i++) {
+    auto& book = books[i];
+    fprintf(out,
+            "    {\n      \"path\": %s,\n      \"format\": \"%s\",\n      \"ok\": %s,\n      \"pages\": %lu,\n"
+            "      \"elements\": %lu,\n",
+            quoted(book.path).c_str(), book.format, book.ok ? "true" : "false", static_cast<unsigned long>(book.pages),
+            static_cast<unsigned long>(book.elements));
+    fprintf(out, "      \"stages\": {\n");
+    for (size_t s = 0; s < book.stages.size(); s++) {
+      printStage(out, book.stages[s].first, book.stages[s].second, s + 1 == book.stages.size());
+    }
+    fprintf(out, "      }\n    }%s\n", i + 1 == books.size() ? "" : ",");
+  }
+  fprintf(out, "  ]\n}\n");
+  if (out != stdout) {
+    fclose(out);
+  }
+
+  const bool allOk = std::all_of(books.begin(), books.end(), [](const BookResult& book) { return book.ok; });
+  return allOk ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+// Checks the CSS cascade of elements that more rules match than CssParser keeps per element.
+//
+//   HostCssTest
+//
+// Every case parses a stylesheet with more than MAX_MATCHES (24) rules for one element and resolves the element's
+// style, once from the parsed rules and once from the rule cache written by saveToCache(). The more specific and the
+// later rules have to win no matter how many less specific or earlier rules come before them. Exits with 1 if a case
+// resolves to the wrong style.
+
+#include <Epub/css/CssAncestors.h>
+#include <Epub/css/CssParser.h>
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace {
+// More than the matches kept per element
+constexpr int RULE_COUNT = 30;
+constexpr const char* CACHE_PATH = "/css_cascade_test.bin";
+
+struct Case {
+  const char* name;
+  std::string css;
+  const char* ancestorTag;  // Element the styled <p class="lead"> is nested in, or nullptr
+  CssTextAlign textAlign;
+  CssFontStyle fontStyle;
+  CssFontWeight fontWeight;
+  float textIndent;
+};
+
+std::string repeated(const char* rule) {
+  std::string css;
+  for (int i = 0; i < RULE_COUNT; i++) {
+    css += rule;
+    css += '\n';
+  }
+  return css;
+}
+
+std::string numberedIndents(const char* selector) {
+  std::string css;
+  for (int i = 1; i <= RULE_COUNT; i++) {
+    css += std::string(selector) + " { text-indent: " + std::to_string(i) + "px; }\n";
+  }
+  return css;
+}
+
+// Tag rules are collected before class rules, a class rule past the cap still beats them
+Case classAfterTagRules() {
+  return {"class rule after many tag rules", ".lead { text-align: right; }\n" + numberedIndents("p"), nullptr,
+          CssTextAlign::Right, CssFontStyle::Normal, CssFontWeight::Normal, RULE_COUNT};
+}
+
+// Rules of one selector all match, the last of them has to win
+Case duplicateSelectors() {
+  return {"duplicate selectors", repeated("p.lead { text-align: left; }") + "p.lead { text-align: center; }\n", nullptr,
+          CssTextAlign::Center, CssFontStyle::Normal, CssFontWeight::Normal, 0};
+}
+
+// A later rule of the same specificity past the cap
+Case lastTagRule() {
+  return {"last tag rule", numberedIndents("p") + "p { font-weight: bold; }\n", nullptr, CssTextAlign::Left,
+          CssFontStyle::Normal, CssFontWeight::Bold, RULE_COUNT};
+}
+
+// Descendant selectors are more specific than the tag rules before them
+Case descendantAfterTagRules() {
+  return {"descendant rule after many tag rules",
+          numberedIndents("p") + "div p { font-style: italic; }\nsection p { font-weight: bold; }\n",
+          "div",
+          CssTextAlign::Left,
+          CssFontStyle::Italic,
+          CssFontWeight::Normal,
+          RULE_COUNT};
+}
+
+bool parse(CssParser& parser, const std::string& css) {
+  CssParser::Loader loader(parser);
+  loader.write(reinterpret_cast<const uint8_t*>(css.data()), css.size());
+  loader.finish();
+  return !parser.empty();
+}
+
+bool check(const Case& test, const char* source, const CssParser& parser) {
+  CssAncestors ancestors;
+  if (test.ancestorTag) {
+    ancestors.push(0, CssParser::selectorId(test.ancestorTag), nullptr, 0);
+  }
+  CssParser::SelectorId classIds[CssParser::MAX_CLASSES];
+  const size_t classCount = CssParser::classIds("lead", classIds);
+  const CssStyle style = parser.resolveStyle(CssParser::selectorId("p"), classIds, classCount, &ancestors);
+
+  const bool ok = style.textAlign == test.textAlign && style.fontStyle == test.fontStyle &&
+                  style.fontWeight == test.fontWeight && style.textIndent.value == test.textIndent;
+  if (!ok) {
+    fprintf(stderr,
+            "%s (%s): text-align %d, font-style %d, font-weight %d, text-indent %g, expected %d, %d, %d, %g\n",
+            test.name, source, static_cast<int>(style.textAlign), static_cast<int>(style.fontStyle),
+            static_cast<int>(style.fontWeight), style.textIndent.value, static_cast<int>(test.textAlign),
+            static_cast<int>(test.fontStyle), static_cast<int>(test.fontWeight), test.textIndent);
+  }
+  return ok;
+}
+
+int runCase(const Case& test) {
+  CssParser parsed;
+  if (!parse(parsed, test.css)) {
+    fprintf(stderr, "%s: no rules parsed\n", test.name);
+    return 1;
+  }
+  int failures = check(test, "parsed", parsed) ? 0 : 1;
+
+  HalFile file;
+  if (!Storage.openFileForWrite("CSS", CACHE_PATH, file) || !parsed.saveToCache(file)) {
+    fprintf(stderr, "%s: can't write the rule cache\n", test.name);
+    return failures + 1;
+  }
+  file.close();
+  CssParser cached;
+  if (!cached.loadFromCache(CACHE_PATH)) {
+    fprintf(stderr, "%s: can't load the rule cache\n", test.name);
+    failures++;
+  } else if (!check(test, "cached", cached)) {
+    failures++;
+  }
+  Storage.remove(CACHE_PATH);
+  return failures;
+}
+}  // namespace
+
+int main(int argc, char**) {
+  if (argc > 1) {
+    fprintf(stderr, "usage: HostCssTest\n");
+    return 2;
+  }
+  if (!Storage.begin()) {
+    return 1;
+  }
+
+  int failures = 0;
+  const Case cases[] = {classAfterTagRules(), duplicateSelectors(), lastTagRule(), descendantAfterTagRules()};
+  for (const Case& test : cases) {
+    const int caseFailures = runCase(test);
+    printf("%-40s %s\n", test.name, caseFailures == 0 ? "ok" : "FAILED");
+    failures += caseFailures;
+  }
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,246 @@
+// Reads an EPUB on the host the way the reader activity does: index the book, build each chapter's section file and
+// render pages through GfxRenderer into the emulated panel. Buttons come from a HostInput script, without one every
+// page of the book is rendered in order.
+//
+//   HostReader /books/book.epub [--input script.txt] [--keys "RIGHT 5;LEFT"] [--pages N] [--trace trace.txt]
+//   [--heap] [--storage]
+//
+// The book path is on the emulated SD card ($CROSSPOINT_SD_ROOT, default ./sdcard). --trace writes the trace buffer
+// in the CMD:TRACE format at exit, scripts/trace_to_chrome.py turns it into Chrome trace JSON.
+// --heap and --storage print the heap and SD card reports of CMD:HEAP and CMD:STORAGE at exit.
+
+#include <Epub.h>
+#include <Epub/Page.h>
+#include <Epub/Section.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalGPIO.h>
+#include <HalStorage.h>
+#include <HeapAccounting.h>
+#include <HostInput.h>
+#include <Logging.h>
+#include <Trace.h>
+
+#include <cstring>
+#include <memory>
+
+#include "ReaderDefaults.h"
+
+namespace {
+HalDisplay display;
+HalGPIO gpio;
+GfxRenderer renderer(display);
+
+using namespace ReaderDefaults;
+
+struct Reader {
+  std::shared_ptr<Epub> epub;
+  std::unique_ptr<Section> section;
+  int spineIndex = 0;
+  Margins margins;
+  uint32_t pagesRendered = 0;
+
+  bool openSection(const bool fromEnd) {
+    section.reset(new Section(epub, spineIndex, renderer));
+    const uint16_t viewportWidth = renderer.getScreenWidth() - margins.left - margins.right;
+    const uint16_t viewportHeight = renderer.getScreenHeight() - margins.top - margins.bottom;
+    [[maybe_unused]] const unsigned long start = millis();
+    if (!section->loadSectionFile(FONT_ID, LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, PARAGRAPH_ALIGNMENT,
+                                  viewportWidth, viewportHeight, HYPHENATION, EMBEDDED_STYLE)) {
+      if (!section->createSectionFile(FONT_ID, LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, PARAGRAPH_ALIGNMENT,
+                                      viewportWidth, viewportHeight, HYPHENATION, EMBEDDED_STYLE)) {
+        LOG_ERR("HOST", "Failed to build section %d", spineIndex);
+        section.reset();
+        return false;
+      }
+      LOG_INF("HOST", "Built section %d (%d pages) in %lums", spineIndex, section->pageCount, millis() - start);
+    } else {
+      LOG_INF("HOST", "Loaded section %d (%d pages) in %lums", spineIndex, section->pageCount, millis() - start);
+    }
+    section->currentPage = fromEnd && section->pageCount > 0 ? section->pageCount - 1 : 0;
+    return true;
+  }
+
+  void renderPage() {
+    [[maybe_unused]] const unsigned long start = millis();
+    renderer.clearScreen();
+    if (section->pageCount == 0) {
+      renderer.drawCenteredText(SMALL_FONT_ID, 300, "Empty chapter", true);
+    } else {
+      const auto page = section->loadPageFromSectionFile();
+      [[maybe_unused]] const unsigned long loaded = millis();
+      if (!page) {
+        LOG_ERR("HOST", "Failed to load page %d of section %d", section->currentPage, spineIndex);
+        return;
+      }
+      page->render(renderer, FONT_ID, margins.left, margins.top);
+      char status[32];
+      snprintf(status, sizeof(status), "%d/%d", section->currentPage + 1, section->pageCount);
+      // Placed like the reader activity's status bar
+      const int statusX = renderer.getScreenWidth() - margins.right - renderer.getTextWidth(SMALL_FONT_ID, status);
+      renderer.drawText(SMALL_FONT_ID, statusX, renderer.getScreenHeight() - margins.bottom - 4, status);
+      LOG_DBG("HOST", "Page %d loaded in %lums, rendered in %lums", section->currentPage, loaded - start,
+              millis() - loaded);
+    }
+    renderer.displayBuffer();
+    pagesRendered++;
+  }
+
+  // Returns false at the end of the book
+  bool nextPage() {
+    if (section->currentPage + 1 < section->pageCount) {
+      section->currentPage++;
+      return true;
+    }
+    while (++spineIndex < epub->getSpineItemsCount()) {
+      if (openSection(false)) {
+        return true;
+      }
+    }
+    spineIndex = epub->getSpineItemsCount() - 1;
+    return false;
+  }
+
+  void previousPage() {
+    if (section->currentPage > 0) {
+      section->currentPage--;
+      return;
+    }
+    while (spineIndex > 0) {
+      spineIndex--;
+      if (openSection(true)) {
+        return;
+      }
+    }
+  }
+};
+
+class FilePrint : public Print {
+  FILE* file;
+
+ public:
+  explicit FilePrint(FILE* file) : file(file) {}
+  size_t write(const uint8_t b) override { return fputc(b, file) == EOF ? 0 : 1; }
+  size_t write(const uint8_t* buffer, const size_t size) override { return fwrite(buffer, 1, size, file); }
+  using Print::write;
+};
+
+void usage() {
+  fprintf(stderr, "usage: HostReader <book.epub on SD card> [--input script] [--keys \"RIGHT 3;LEFT\"] [--pages N] "
+                  "[--trace file] [--heap] [--storage]\n");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    usage();
+    return 2;
+  }
+  const char* bookPath = argv[1];
+  bool scripted = false;
+  long maxPages = -1;
+  const char* tracePath = nullptr;
+  bool heapReport = false;
+  bool storageReport = false;
+  for (int i = 2; i < argc; i++) {
+    if (!strcmp(argv[i], "--input") && i + 1 < argc) {
+      if (!HostInput::loadScript(argv[++i])) {
+        return 2;
+      }
+      scripted = true;
+    } else if (!strcmp(argv[i], "--keys") && i + 1 < argc) {
+      if (!HostInput::loadScriptText(argv[++i])) {
+        return 2;
+      }
+      scripted = true;
+    } else if (!strcmp(argv[i], "--pages") && i + 1 < argc) {
+      maxPages = strtol(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else if (!strcmp(argv[i], "--heap")) {
+      heapReport = true;
+    } else if (!strcmp(argv[i], "--storage")) {
+      storageReport = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  if (!Storage.begin()) {
+    return 1;
+  }
+  display.begin();
+  renderer.begin();
+  insertFonts(renderer);
+  gpio.begin();
+
+  Reader reader;
+  [[maybe_unused]] const unsigned long loadStart = millis();
+  reader.epub = std::make_shared<Epub>(bookPath, CACHE_DIR);
+  if (!reader.epub->load()) {
+    LOG_ERR("HOST", "Failed to load %s", bookPath);
+    return 1;
+  }
+  LOG_INF("HOST", "Loaded %s (%d spine items) in %lums", bookPath, reader.epub->getSpineItemsCount(),
+          millis() - loadStart);
+
+  reader.margins = ReaderDefaults::margins(renderer);
+
+  while (reader.spineIndex < reader.epub->getSpineItemsCount() && !reader.openSection(false)) {
+    reader.spineIndex++;
+  }
+  if (!reader.section) {
+    LOG_ERR("HOST", "No readable chapter in %s", bookPath);
+    return 1;
+  }
+  reader.renderPage();
+
+  [[maybe_unused]] const unsigned long readStart = millis();
+  while (maxPages < 0 || static_cast<long>(reader.pagesRendered) < maxPages) {
+    if (!scripted) {
+      if (!reader.nextPage()) {
+        break;
+      }
+      reader.renderPage();
+      continue;
+    }
+
+    gpio.update();
+    if (gpio.wasReleased(HalGPIO::BTN_RIGHT) || gpio.wasReleased(HalGPIO::BTN_DOWN)) {
+      if (reader.nextPage()) {
+        reader.renderPage();
+      }
+    } else if (gpio.wasReleased(HalGPIO::BTN_LEFT) || gpio.wasReleased(HalGPIO::BTN_UP)) {
+      reader.previousPage();
+      reader.renderPage();
+    } else if (gpio.wasReleased(HalGPIO::BTN_BACK) || HostInput::finished()) {
+      break;
+    }
+    delay(1);
+  }
+
+  LOG_INF("HOST", "Rendered %lu pages in %lums, %lu bytes of emulated heap free (min %lu)",
+          static_cast<unsigned long>(reader.pagesRendered), millis() - readStart,
+          static_cast<unsigned long>(ESP.getFreeHeap()), static_cast<unsigned long>(ESP.getMinFreeHeap()));
+
+  if (tracePath) {
+    FILE* traceFile = fopen(tracePath, "w");
+    if (!traceFile) {
+      LOG_ERR("HOST", "Can't write %s", tracePath);
+      return 1;
+    }
+    FilePrint out(traceFile);
+    Trace::dump(out);
+    fclose(traceFile);
+  }
+  if (heapReport) {
+    FilePrint out(stdout);
+    HeapAccounting::printReport(out);
+  }
+  if (storageReport) {
+    FilePrint out(stdout);
+    Storage.printStats(out);
+  }
+  return 0;
+}
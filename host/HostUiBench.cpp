@@ -0,0 +1,264 @@
+// Times the home and settings screens of both UI themes in the four renderer orientations.
+//
+//   HostUiBench [--renders N]
+//
+// Every screen is opened on a fresh activity and navigated with N DOWN presses (default 20, at most 32), one render
+// each. The renders are timed by their DisplayTask trace spans, from taking the activity's mutex to handing the frame
+// to the display, so they cover the drawing and the frame buffer work but not the panel refresh. Prints the mean
+// render time per theme, screen and orientation.
+//
+// The screens refresh with GfxRenderer::displayChanges(), which only sends the window that changed. After every
+// render, and after each step of a random sequence of drawing and refreshes, the emulated panel must show exactly the
+// frame buffer a full refresh would send. Exits with 1 if it doesn't or a screen didn't render.
+
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalGPIO.h>
+#include <EInkDisplay.h>
+#include <HalStorage.h>
+#include <HostInput.h>
+#include <Logging.h>
+#include <Trace.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "AppFonts.h"
+#include "CrossPointSettings.h"
+#include "MappedInputManager.h"
+#include "WorkerService.h"
+#include "activities/home/HomeActivity.h"
+#include "activities/settings/SettingsActivity.h"
+#include "components/UITheme.h"
+#include "util/ButtonNavigator.h"
+
+namespace {
+HalDisplay display;
+HalGPIO gpio;
+MappedInputManager mappedInputManager(gpio);
+GfxRenderer renderer(display);
+
+// Longest wait for the render of a press
+constexpr unsigned long RENDER_TIMEOUT_MS = 200;
+constexpr int RANDOM_STEPS = 500;
+// A render leaves about six events in the trace buffer (worker job, render, refresh), keep them all in it
+constexpr int MAX_RENDERS = TRACE_BUFFER_EVENTS / 8;
+
+constexpr const char* ORIENTATION_NAMES[] = {"portrait", "landscapeCW", "inverted", "landscapeCCW"};
+constexpr GfxRenderer::Orientation ORIENTATIONS[] = {
+    GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise, GfxRenderer::PortraitInverted,
+    GfxRenderer::LandscapeCounterClockwise};
+
+class StringPrint : public Print {
+ public:
+  std::string text;
+  size_t write(const uint8_t b) override {
+    text += static_cast<char>(b);
+    return 1;
+  }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    text.append(reinterpret_cast<const char*>(buffer), size);
+    return size;
+  }
+  using Print::write;
+};
+
+struct Timing {
+  uint32_t renders = 0;
+  uint64_t totalUs = 0;
+};
+
+// Adds up the render spans of `task` in the trace buffer
+// (dump lines are TRACE:<us>,<phase>,<module>,<task>,<arg>,<name>)
+Timing renderTimes(const char* task) {
+  StringPrint dump;
+  Trace::dump(dump);
+
+  Timing timing;
+  unsigned long beginUs = 0;
+  bool open = false;
+  size_t lineStart = 0;
+  while (lineStart < dump.text.size()) {
+    size_t lineEnd = dump.text.find('\n', lineStart);
+    if (lineEnd == std::string::npos) {
+      lineEnd = dump.text.size();
+    }
+    const std::string line = dump.text.substr(lineStart, lineEnd - lineStart);
+    lineStart = lineEnd + 1;
+
+    unsigned long us = 0;
+    char phase = 0;
+    char module[16] = {};
+    if (sscanf(line.c_str(), "TRACE:%lu,%c,%15[^,]", &us, &phase, module) != 3 || strcmp(module, "display") != 0 ||
+        line.compare(line.rfind(',') + 1, std::string::npos, task) != 0) {
+      continue;
+    }
+    if (phase == 'B') {
+      beginUs = us;
+      open = true;
+    } else if (phase == 'E' && open) {
+      timing.renders++;
+      timing.totalUs += static_cast<uint32_t>(us - beginUs);
+      open = false;
+    }
+  }
+  return timing;
+}
+
+// The frame buffer is what a full refresh would show
+bool panelShowsFrame() {
+  return memcmp(EInkDisplay::getPanelBuffer(), display.getFrameBuffer(), HalDisplay::BUFFER_SIZE) == 0;
+}
+
+// Random rectangles drawn over or after a cleared screen in random orientations, refreshed with displayChanges() and
+// now and then with a full refresh. Returns the number of steps where the panel differs from the frame buffer.
+int checkRandomChanges() {
+  std::mt19937 rng(1);
+  int mismatches = 0;
+  renderer.clearScreen();
+  renderer.displayBuffer();
+  for (int step = 0; step < RANDOM_STEPS; step++) {
+    renderer.setOrientation(ORIENTATIONS[rng() % 4]);
+    if (rng() % 4 == 0) {
+      renderer.clearScreen();
+    }
+    const int rects = static_cast<int>(rng() % 4);
+    for (int i = 0; i < rects; i++) {
+      const int width = 1 + static_cast<int>(rng() % 120);
+      const int height = 1 + static_cast<int>(rng() % 120);
+      const int x = static_cast<int>(rng() % renderer.getScreenWidth()) - width / 2;
+      const int y = static_cast<int>(rng() % renderer.getScreenHeight()) - height / 2;
+      renderer.fillRect(x, y, width, height, rng() % 2 == 0);
+    }
+    if (rng() % 16 == 0) {
+      renderer.displayBuffer();
+    } else {
+      renderer.displayChanges();
+    }
+    if (!panelShowsFrame()) {
+      mismatches++;
+    }
+  }
+  renderer.setOrientation(GfxRenderer::Portrait);
+  return mismatches;
+}
+
+void noop() {}
+void noopPath(const std::string&) {}
+
+Activity* openScreen(const bool home) {
+  if (home) {
+    return new HomeActivity(renderer, mappedInputManager, noopPath, noop, noop, noop, noop, noop);
+  }
+  return new SettingsActivity(renderer, mappedInputManager, noop);
+}
+
+// Runs the activity until the script has been played and the render it asked for has been shown
+void playAndRender(Activity* activity) {
+  const uint32_t frames = EInkDisplay::getFrameCount();
+  while (!HostInput::finished()) {
+    gpio.update();
+    activity->loop();
+    delay(1);
+  }
+  const unsigned long start = millis();
+  while (EInkDisplay::getFrameCount() == frames && millis() - start < RENDER_TIMEOUT_MS) {
+    delay(1);
+  }
+}
+
+// Opens the screen, plays the DOWN presses and returns the timing of its renders. Counts the renders after which the
+// panel doesn't show the frame buffer in panelMismatches.
+Timing benchScreen(const bool home, const GfxRenderer::Orientation orientation, const int renders,
+                   int& panelMismatches) {
+  renderer.setOrientation(orientation);
+  Trace::clear();
+
+  Activity* activity = openScreen(home);
+  activity->onEnter();
+  playAndRender(activity);
+  for (int i = 0; i < renders; i++) {
+    // One press at a time so every press renders on its own instead of being coalesced with the next one
+    HostInput::loadScriptText("DOWN");
+    playAndRender(activity);
+    if (!panelShowsFrame()) {
+      panelMismatches++;
+    }
+  }
+  activity->onExit();
+  delete activity;
+
+  return renderTimes(home ? "HomeActivityTask" : "SettingsActivityTask");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  int renders = 20;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--renders") && i + 1 < argc) {
+      renders = std::clamp(atoi(argv[++i]), 1, MAX_RENDERS);
+    } else {
+      fprintf(stderr, "usage: HostUiBench [--renders N]\n");
+      return 2;
+    }
+  }
+
+  setenv("CROSSPOINT_FRAME_FORMAT", "none", 0);
+  gpio.begin();
+  if (!Storage.begin()) {
+    return 1;
+  }
+  SETTINGS.loadFromFile();
+  ButtonNavigator::setMappedInputManager(mappedInputManager);
+  display.begin();
+  renderer.begin();
+  WORKER.begin();
+  AppFonts::insert(renderer);
+
+  int failures = 0;
+  const int randomMismatches = checkRandomChanges();
+  if (randomMismatches > 0) {
+    fprintf(stderr, "Random changes: the panel differs from a full refresh after %d of %d steps\n", randomMismatches,
+            RANDOM_STEPS);
+    failures++;
+  }
+
+  printf("%-8s %-9s %-13s %8s %10s\n", "theme", "screen", "orientation", "renders", "mean us");
+  for (const uint8_t theme : {CrossPointSettings::CLASSIC, CrossPointSettings::LYRA}) {
+    SETTINGS.uiTheme = theme;
+    UITheme::getInstance().reload();
+    const char* themeName = theme == CrossPointSettings::CLASSIC ? "classic" : "lyra";
+
+    for (const bool home : {true, false}) {
+      uint64_t screenUs = 0;
+      uint32_t screenRenders = 0;
+      for (size_t o = 0; o < sizeof(ORIENTATIONS) / sizeof(ORIENTATIONS[0]); o++) {
+        int panelMismatches = 0;
+        const Timing timing = benchScreen(home, ORIENTATIONS[o], renders, panelMismatches);
+        if (panelMismatches > 0) {
+          fprintf(stderr, "%s %s %s: the panel differs from a full refresh after %d renders\n", themeName,
+                  home ? "home" : "settings", ORIENTATION_NAMES[o], panelMismatches);
+          failures++;
+        }
+        if (timing.renders == 0) {
+          fprintf(stderr, "%s %s %s: no renders\n", themeName, home ? "home" : "settings", ORIENTATION_NAMES[o]);
+          failures++;
+          continue;
+        }
+        printf("%-8s %-9s %-13s %8lu %10.1f\n", themeName, home ? "home" : "settings", ORIENTATION_NAMES[o],
+               static_cast<unsigned long>(timing.renders), static_cast<double>(timing.totalUs) / timing.renders);
+        screenUs += timing.totalUs;
+        screenRenders += timing.renders;
+      }
+      if (screenRenders > 0) {
+        printf("%-8s %-9s %-13s %8lu %10.1f\n", themeName, home ? "home" : "settings", "all",
+               static_cast<unsigned long>(screenRenders), static_cast<double>(screenUs) / screenRenders);
+      }
+    }
+  }
+  return failures > 0 ? 1 : 0;
+}
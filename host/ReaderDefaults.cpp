@@ -0,0 +1,33 @@
+#include "ReaderDefaults.h"
+
+#include <builtinFonts/all.h>
+
+namespace {
+constexpr int SCREEN_MARGIN = 5;
+constexpr int STATUS_BAR_HEIGHT = 19;
+
+EpdFont bookerly14RegularFont(&bookerly_14_regular);
+EpdFont bookerly14BoldFont(&bookerly_14_bold);
+EpdFont bookerly14ItalicFont(&bookerly_14_italic);
+EpdFont bookerly14BoldItalicFont(&bookerly_14_bolditalic);
+EpdFontFamily bookerly14FontFamily(&bookerly14RegularFont, &bookerly14BoldFont, &bookerly14ItalicFont,
+                                   &bookerly14BoldItalicFont);
+EpdFont smallFont(&notosans_8_regular);
+EpdFontFamily smallFontFamily(&smallFont);
+}  // namespace
+
+void ReaderDefaults::insertFonts(GfxRenderer& renderer) {
+  renderer.insertFont(FONT_ID, bookerly14FontFamily);
+  renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
+}
+
+ReaderDefaults::Margins ReaderDefaults::margins(GfxRenderer& renderer) {
+  Margins margins;
+  renderer.setOrientation(GfxRenderer::Orientation::Portrait);
+  renderer.getOrientedViewableTRBL(&margins.top, &margins.right, &margins.bottom, &margins.left);
+  margins.top += SCREEN_MARGIN;
+  margins.left += SCREEN_MARGIN;
+  margins.right += SCREEN_MARGIN;
+  margins.bottom += STATUS_BAR_HEIGHT;
+  return margins;
+}
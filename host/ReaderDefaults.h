@@ -0,0 +1,25 @@
+#pragma once
+
+#include <GfxRenderer.h>
+
+#include "fontIds.h"
+
+// Reader setup shared by the host tools, the defaults of CrossPointSettings with the built-in Bookerly 14
+namespace ReaderDefaults {
+constexpr int FONT_ID = BOOKERLY_14_FONT_ID;
+constexpr float LINE_COMPRESSION = 1.0f;
+constexpr bool EXTRA_PARAGRAPH_SPACING = true;
+constexpr uint8_t PARAGRAPH_ALIGNMENT = 0;  // Justified
+constexpr bool HYPHENATION = false;
+constexpr bool EMBEDDED_STYLE = true;
+constexpr const char* CACHE_DIR = "/.crosspoint";
+
+struct Margins {
+  int top = 0, right = 0, bottom = 0, left = 0;
+};
+
+// Registers the reader font and SMALL_FONT_ID
+void insertFonts(GfxRenderer& renderer);
+// Portrait margins of the reader activity, the status bar included
+Margins margins(GfxRenderer& renderer);
+}  // namespace ReaderDefaults
@@ -0,0 +1,56 @@
+#pragma once
+
+// Host stand-in for the Arduino core, enough to build lib/ on a workstation (CROSSPOINT_EMULATED builds)
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "HardwareSerial.h"
+#include "esp32-hal.h"
+#include "Print.h"
+#include "WString.h"
+
+// Like the ESP32 core
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t*>(addr))
+#define pgm_read_word(addr) (*reinterpret_cast<const uint16_t*>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t*>(addr))
+
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+// There are no pins on the host, every input reads HIGH (USB connected, display never busy)
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline uint16_t analogRead(uint8_t) { return 0; }
+inline uint32_t analogReadMilliVolts(uint8_t) { return 0; }
+
+// Arduino's random(max) and random(min, max), overloads of the C library's random()
+inline long random(const long howBig) { return howBig > 0 ? ::random() % howBig : 0; }
+inline long random(const long howSmall, const long howBig) {
+  return howSmall < howBig ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+// Heap figures of an emulated ESP32-C3 heap: a fixed size minus what the host process has allocated
+class EspClass {
+ public:
+  uint32_t getHeapSize();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  void restart();
+};
+
+extern EspClass ESP;
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+// Host stand-in for the SDK's battery monitor, the emulated battery is always full
+class BatteryMonitor {
+ public:
+  explicit BatteryMonitor(uint8_t) {}
+  uint16_t readPercentage() const { return 100; }
+};
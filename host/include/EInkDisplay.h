@@ -0,0 +1,59 @@
+#pragma once
+
+// Host stand-in for the SDK's e-ink panel driver. The frame buffer lives in RAM and every refresh is written as an
+// image to $CROSSPOINT_FRAME_DIR (default ./frames), rotated to portrait like the device is held.
+// $CROSSPOINT_FRAME_FORMAT selects png (default), pbm or none. $CROSSPOINT_REFRESH_DELAY=1 sleeps for the typical
+// panel refresh durations, otherwise refreshes are instant. The panel keeps its own copy of what it shows, updated by
+// each refresh (displayWindow() only updates its window), so partial refreshes can be checked against a full one.
+
+#include <Arduino.h>
+
+#include <atomic>
+
+class EInkDisplay {
+ public:
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  EInkDisplay(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t rst, int8_t busy) {}
+
+  void begin();
+  void clearScreen(uint8_t color = 0xFF) const;
+  void drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 bool fromProgmem = false) const;
+
+  void displayBuffer(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
+  void refreshDisplay(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
+  void deepSleep() {}
+
+  uint8_t* getFrameBuffer() const { return frameBuffer; }
+
+  void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer);
+  void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer);
+  void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer);
+  void cleanupGrayscaleBuffers(const uint8_t* bwBuffer) {}
+  void displayGrayBuffer(bool turnOffScreen = false);
+
+  // Number of refreshes so far, also the number of the next frame file
+  static uint32_t getFrameCount() { return frameCount; }
+
+  // Gray planes of the last displayGrayBuffer(), for comparing render paths
+  static const uint8_t* getGrayscaleLsbBuffer() { return lsbBuffer; }
+  static const uint8_t* getGrayscaleMsbBuffer() { return msbBuffer; }
+  // BW image the panel shows after the refreshes so far
+  static const uint8_t* getPanelBuffer() { return panelBuffer; }
+
+ private:
+  static uint8_t frameBuffer[BUFFER_SIZE];
+  static uint8_t lsbBuffer[BUFFER_SIZE];
+  static uint8_t msbBuffer[BUFFER_SIZE];
+  static uint8_t panelBuffer[BUFFER_SIZE];
+  static std::atomic<uint32_t> frameCount;
+
+  void dumpFrame(const char* kind, bool gray);
+};
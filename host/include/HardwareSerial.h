@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdio>
+
+#include "Print.h"
+#include "esp32-hal.h"
+
+// Host stand-in for the USB CDC serial port. Output goes to stderr, so stdout stays free for tool output.
+class HWCDC : public Print {
+ public:
+  void begin(unsigned long) {}
+  void end() {}
+  operator bool() const { return true; }
+  int available() { return 0; }
+  int read() { return -1; }
+
+  size_t write(const uint8_t b) override { return fputc(b, stderr) == EOF ? 0 : 1; }
+  size_t write(const uint8_t* buffer, const size_t size) override { return fwrite(buffer, 1, size, stderr); }
+  using Print::write;
+  void flush() override { fflush(stderr); }
+};
+
+extern HWCDC Serial;
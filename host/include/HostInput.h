@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// Scripted button input for the host build, read by HalGPIO::update().
+//
+// A script has one step per line, '#' starts a comment:
+//   RIGHT            press and release a button (BACK, CONFIRM, LEFT, RIGHT, UP, DOWN, POWER)
+//   RIGHT 10         ... 10 times
+//   CONFIRM hold 1000  keep it pressed for 1000ms
+//   wait 500         no input for 500ms
+namespace HostInput {
+// Appends the steps of a script file. Returns false if it can't be read or has an unknown step.
+bool loadScript(const char* path);
+// Appends the steps of a script given inline, lines separated by '\n' or ';'
+bool loadScriptText(const char* text);
+void press(uint8_t buttonIndex, uint32_t holdMs = 0, int count = 1);
+void wait(uint32_t ms);
+// True once every step has been played
+bool finished();
+}  // namespace HostInput
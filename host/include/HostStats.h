@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+// Process-wide counters of the host build, read by the benchmarks. Heap counters cover every malloc family call
+// (operator new included) on glibc hosts and stay 0 elsewhere. SD counters cover the emulated card.
+namespace HostStats {
+struct Counters {
+  uint64_t allocations = 0;
+  uint64_t allocatedBytes = 0;
+  uint64_t liveBytes = 0;
+  uint64_t peakLiveBytes = 0;  // Since the last resetPeak()
+  uint64_t sdOpens = 0;
+  uint64_t sdBytesRead = 0;
+  uint64_t sdBytesWritten = 0;
+};
+
+Counters snapshot();
+// Starts a new peak window at the current live size
+void resetPeak();
+
+void countSdOpen();
+void countSdRead(uint64_t bytes);
+void countSdWrite(uint64_t bytes);
+}  // namespace HostStats
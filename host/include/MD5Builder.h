@@ -0,0 +1,24 @@
+#pragma once
+
+#include <WString.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Host stand-in for the ESP32 core's MD5Builder, only the calls the firmware makes
+class MD5Builder {
+  uint32_t state[4] = {};
+  uint64_t length = 0;
+  uint8_t block[64] = {};
+  uint8_t digest[16] = {};
+
+  void transform(const uint8_t* data);
+
+ public:
+  void begin();
+  void add(const uint8_t* data, size_t size);
+  void add(const char* text);
+  void calculate();
+  void getBytes(uint8_t* output) const;
+  String toString() const;
+};
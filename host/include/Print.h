@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "WString.h"
+
+// Host stand-in for the Arduino Print interface
+class Print {
+ public:
+  virtual ~Print() = default;
+
+  virtual size_t write(uint8_t b) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (written < size && write(buffer[written])) {
+      written++;
+    }
+    return written;
+  }
+  size_t write(const char* str) { return str ? write(reinterpret_cast<const uint8_t*>(str), strlen(str)) : 0; }
+  size_t write(const char* buffer, const size_t size) { return write(reinterpret_cast<const uint8_t*>(buffer), size); }
+  virtual void flush() {}
+
+  size_t print(const char* str) { return write(str); }
+  size_t print(const String& str) { return write(str.c_str()); }
+  size_t print(const char c) { return write(static_cast<uint8_t>(c)); }
+  size_t print(const int value) { return printf("%d", value); }
+  size_t print(const unsigned int value) { return printf("%u", value); }
+  size_t print(const long value) { return printf("%ld", value); }
+  size_t print(const unsigned long value) { return printf("%lu", value); }
+  size_t print(const double value, const int digits = 2) { return printf("%.*f", digits, value); }
+
+  template <typename T>
+  size_t println(const T& value) {
+    return print(value) + println();
+  }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    const int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (len < 0) {
+      return 0;
+    }
+    return write(reinterpret_cast<const uint8_t*>(buf), std::min<size_t>(len, sizeof(buf) - 1));
+  }
+};
+
+// Host stand-in for the Arduino Stream interface
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  size_t readBytes(uint8_t* buffer, const size_t length) {
+    size_t count = 0;
+    while (count < length) {
+      const int c = read();
+      if (c < 0) {
+        break;
+      }
+      buffer[count++] = static_cast<uint8_t>(c);
+    }
+    return count;
+  }
+  size_t readBytes(char* buffer, const size_t length) { return readBytes(reinterpret_cast<uint8_t*>(buffer), length); }
+};
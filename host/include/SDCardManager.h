@@ -0,0 +1,99 @@
+#pragma once
+
+// Host stand-in for the SDK's SD card manager and SdFat's FsFile. The card is a directory on the workstation,
+// $CROSSPOINT_SD_ROOT or ./sdcard, and firmware paths ("/.crosspoint/...") are resolved below it.
+
+#include <Arduino.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef int oflag_t;
+#define O_RDONLY 0x00
+#define O_WRONLY 0x01
+#define O_RDWR 0x02
+#define O_ACCMODE (O_RDONLY | O_WRONLY | O_RDWR)
+#define O_APPEND 0x08
+#define O_CREAT 0x10
+#define O_TRUNC 0x20
+#define O_EXCL 0x40
+#define O_READ O_RDONLY
+#define O_WRITE O_WRONLY
+#define O_AT_END 0x4000
+
+class FsFile : public Stream {
+  struct Impl;
+  // Copies share the open file, like SdFat handles
+  std::shared_ptr<Impl> impl;
+
+  explicit FsFile(std::shared_ptr<Impl> impl) : impl(std::move(impl)) {}
+  friend class SDCardManager;
+
+ public:
+  FsFile() = default;
+
+  bool isOpen() const;
+  operator bool() const { return isOpen(); }
+  void close();
+
+  int read() override;
+  int read(void* buffer, size_t size);
+  int peek() override;
+  int available() override;
+  using Print::write;
+  size_t write(uint8_t b) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  size_t write(const void* buffer, const size_t size) { return write(static_cast<const uint8_t*>(buffer), size); }
+  void flush() override;
+
+  bool seek(size_t position) { return seekSet(position); }
+  bool seekSet(size_t position);
+  bool seekCur(int64_t offset);
+  bool seekEnd(int64_t offset = 0);
+  size_t position() const;
+  size_t curPosition() const { return position(); }
+  size_t size() const;
+  size_t fileSize() const { return size(); }
+
+  bool isDirectory() const;
+  bool isDir() const { return isDirectory(); }
+  FsFile openNextFile(oflag_t oflag = O_RDONLY);
+  void rewindDirectory();
+  size_t getName(char* name, size_t size) const;
+  bool rename(const char* newPath);
+};
+
+class SDCardManager {
+  static SDCardManager instance;
+
+  std::string root;
+  bool initialized = false;
+
+ public:
+  static SDCardManager& getInstance() { return instance; }
+
+  bool begin();
+  bool ready() const { return initialized; }
+  // Host path of a firmware path
+  std::string hostPath(const char* path) const;
+
+  std::vector<String> listFiles(const char* path = "/", int maxFiles = 200);
+  String readFile(const char* path);
+  bool readFileToStream(const char* path, Print& out, size_t chunkSize = 256);
+  size_t readFileToBuffer(const char* path, char* buffer, size_t bufferSize, size_t maxBytes = 0);
+  bool writeFile(const char* path, const String& content);
+  bool ensureDirectoryExists(const char* path);
+
+  FsFile open(const char* path, oflag_t oflag = O_RDONLY);
+  bool mkdir(const char* path, bool pFlag = true);
+  bool exists(const char* path);
+  bool remove(const char* path);
+  bool rmdir(const char* path);
+  bool removeDir(const char* path);
+
+  bool openFileForRead(const char* moduleName, const char* path, FsFile& file);
+  bool openFileForWrite(const char* moduleName, const char* path, FsFile& file);
+};
+
+#define SdMan SDCardManager::getInstance()
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <strings.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Host stand-in for the Arduino String class, backed by std::string. Only covers what the firmware uses.
+class String {
+  std::string s;
+
+ public:
+  String() = default;
+  String(const char* str) : s(str ? str : "") {}
+  String(const char* str, size_t len) : s(str, len) {}
+  explicit String(char c) : s(1, c) {}
+  explicit String(int value) : s(std::to_string(value)) {}
+  explicit String(unsigned int value) : s(std::to_string(value)) {}
+  explicit String(long value) : s(std::to_string(value)) {}
+  explicit String(unsigned long value) : s(std::to_string(value)) {}
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  bool reserve(unsigned int size) {
+    s.reserve(size);
+    return true;
+  }
+
+  char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char& operator[](unsigned int index) { return s[index]; }
+
+  String& operator+=(const String& other) {
+    s += other.s;
+    return *this;
+  }
+  String& operator+=(const char* other) {
+    s += other ? other : "";
+    return *this;
+  }
+  String& operator+=(const char c) {
+    s += c;
+    return *this;
+  }
+  bool concat(const String& other) {
+    s += other.s;
+    return true;
+  }
+  bool concat(const char* other) {
+    s += other ? other : "";
+    return true;
+  }
+  bool concat(const char c) {
+    s += c;
+    return true;
+  }
+
+  friend String operator+(String lhs, const String& rhs) { return lhs += rhs; }
+  friend String operator+(String lhs, const char* rhs) { return lhs += rhs; }
+  friend String operator+(const char* lhs, const String& rhs) { return String(lhs) += rhs; }
+
+  bool operator==(const String& other) const { return s == other.s; }
+  bool operator==(const char* other) const { return s == (other ? other : ""); }
+  bool operator!=(const String& other) const { return s != other.s; }
+  bool operator!=(const char* other) const { return !(*this == other); }
+  bool operator<(const String& other) const { return s < other.s; }
+  bool equals(const String& other) const { return s == other.s; }
+  bool equalsIgnoreCase(const String& other) const { return strcasecmp(c_str(), other.c_str()) == 0; }
+
+  bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+  bool endsWith(const String& suffix) const {
+    return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+  }
+  int indexOf(const char c, const unsigned int from = 0) const {
+    const auto pos = s.find(c, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+  }
+  int indexOf(const String& str, const unsigned int from = 0) const {
+    const auto pos = s.find(str.s, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+  }
+  int lastIndexOf(const char c) const {
+    const auto pos = s.rfind(c);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+  }
+  String substring(const unsigned int from) const { return from < s.size() ? String(s.c_str() + from) : String(); }
+  String substring(const unsigned int from, const unsigned int to) const {
+    if (from >= to || from >= s.size()) {
+      return String();
+    }
+    return String(s.c_str() + from, std::min<size_t>(to, s.size()) - from);
+  }
+
+  void toLowerCase() {
+    for (auto& c : s) {
+      c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    }
+  }
+  void toUpperCase() {
+    for (auto& c : s) {
+      c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+    }
+  }
+  void trim() {
+    const auto first = s.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+      s.clear();
+      return;
+    }
+    s = s.substr(first, s.find_last_not_of(" \t\r\n") - first + 1);
+  }
+  void replace(const String& from, const String& to) {
+    if (from.s.empty()) {
+      return;
+    }
+    for (size_t pos = s.find(from.s); pos != std::string::npos; pos = s.find(from.s, pos + to.s.size())) {
+      s.replace(pos, from.s.size(), to.s);
+    }
+  }
+  long toInt() const { return strtol(s.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(s.c_str(), nullptr); }
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+// Host stand-in for the ESP32 core's timing functions, which every core header pulls in
+
+#include <cstdint>
+
+// Milliseconds and microseconds since the emulator started
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+inline void yield() {}
@@ -0,0 +1,19 @@
+#pragma once
+
+// Host stand-in for FreeRTOS: tasks are threads, ticks are milliseconds
+
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY static_cast<TickType_t>(0xffffffffUL)
+#define pdMS_TO_TICKS(ms) static_cast<TickType_t>(ms)
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
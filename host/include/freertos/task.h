@@ -0,0 +1,22 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+struct HostTask;
+typedef HostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+// Stack size and priority are ignored, each task gets a default host thread
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackSize, void* param, UBaseType_t priority,
+                       TaskHandle_t* handle);
+// Only deleting the calling task (nullptr) is supported, threads can't be killed from outside
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+
+// Host threads don't report their stack usage
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }
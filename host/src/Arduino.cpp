@@ -0,0 +1,55 @@
+#include <Arduino.h>
+#include <HostStats.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+HWCDC Serial;
+EspClass ESP;
+
+namespace {
+const auto startTime = std::chrono::steady_clock::now();
+
+// Free heap of an ESP32-C3 after the firmware's static allocations, the budget lib/ code is written against
+constexpr uint32_t EMULATED_HEAP_SIZE = 320 * 1024;
+std::atomic<uint32_t> minFreeHeap{EMULATED_HEAP_SIZE};
+}  // namespace
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(const uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+void delayMicroseconds(const uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+
+uint32_t EspClass::getHeapSize() { return EMULATED_HEAP_SIZE; }
+
+// Called from the allocator hooks of HeapAccounting, so it must neither allocate nor lock
+uint32_t EspClass::getFreeHeap() {
+  const uint64_t used = HostStats::snapshot().liveBytes;
+  const uint32_t free = used < EMULATED_HEAP_SIZE ? EMULATED_HEAP_SIZE - used : 0;
+  uint32_t minFree = minFreeHeap.load(std::memory_order_relaxed);
+  while (free < minFree && !minFreeHeap.compare_exchange_weak(minFree, free, std::memory_order_relaxed)) {
+  }
+  return free;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+  getFreeHeap();
+  return minFreeHeap.load(std::memory_order_relaxed);
+}
+
+// The host heap doesn't fragment the way the device's does, the whole free heap counts as one block
+uint32_t EspClass::getMaxAllocHeap() { return getFreeHeap(); }
+
+void EspClass::restart() {
+  Serial.flush();
+  std::exit(0);
+}
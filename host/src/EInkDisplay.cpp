@@ -0,0 +1,171 @@
+#include <EInkDisplay.h>
+#include <Logging.h>
+#include <miniz.h>
+
+#include <filesystem>
+#include <vector>
+
+uint8_t EInkDisplay::frameBuffer[BUFFER_SIZE];
+uint8_t EInkDisplay::lsbBuffer[BUFFER_SIZE];
+uint8_t EInkDisplay::msbBuffer[BUFFER_SIZE];
+uint8_t EInkDisplay::panelBuffer[BUFFER_SIZE];
+std::atomic<uint32_t> EInkDisplay::frameCount{0};
+
+namespace {
+// Typical durations of the panel waveforms
+uint32_t refreshDuration(const EInkDisplay::RefreshMode mode) {
+  switch (mode) {
+    case EInkDisplay::FULL_REFRESH:
+      return 3000;
+    case EInkDisplay::HALF_REFRESH:
+      return 1720;
+    case EInkDisplay::FAST_REFRESH:
+    default:
+      return 400;
+  }
+}
+
+bool emulateRefreshTime() {
+  const char* env = getenv("CROSSPOINT_REFRESH_DELAY");
+  return env && *env == '1';
+}
+
+bool isWhite(const uint8_t* buffer, const int x, const int y) {
+  return buffer[y * EInkDisplay::DISPLAY_WIDTH_BYTES + x / 8] & (0x80 >> (x % 8));
+}
+}  // namespace
+
+void EInkDisplay::begin() {
+  clearScreen(0xFF);
+  memcpy(panelBuffer, frameBuffer, BUFFER_SIZE);
+}
+
+void EInkDisplay::clearScreen(const uint8_t color) const { memset(frameBuffer, color, BUFFER_SIZE); }
+
+void EInkDisplay::drawImage(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+                            const uint16_t h, bool) const {
+  // Byte aligned copy, the same restriction as the panel driver
+  const uint16_t rowBytes = w / 8;
+  for (uint16_t row = 0; row < h && y + row < DISPLAY_HEIGHT; row++) {
+    const uint16_t dstOffset = (y + row) * DISPLAY_WIDTH_BYTES + x / 8;
+    const uint16_t bytes = std::min<uint16_t>(rowBytes, DISPLAY_WIDTH_BYTES - x / 8);
+    memcpy(frameBuffer + dstOffset, imageData + row * rowBytes, bytes);
+  }
+}
+
+void EInkDisplay::displayBuffer(const RefreshMode mode, bool) {
+  if (emulateRefreshTime()) {
+    delay(refreshDuration(mode));
+  }
+  memcpy(panelBuffer, frameBuffer, BUFFER_SIZE);
+  dumpFrame(mode == FULL_REFRESH ? "full" : mode == HALF_REFRESH ? "half" : "fast", false);
+}
+
+void EInkDisplay::displayWindow(const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h, bool) {
+  if (emulateRefreshTime()) {
+    delay(refreshDuration(FAST_REFRESH));
+  }
+  // The panel takes whole bytes, round the window out to them
+  const uint16_t firstByte = std::min<uint16_t>(x / 8, DISPLAY_WIDTH_BYTES);
+  const uint16_t lastByte = std::min<uint16_t>((x + w + 7) / 8, DISPLAY_WIDTH_BYTES);
+  for (uint16_t row = y; row < y + h && row < DISPLAY_HEIGHT; row++) {
+    const uint32_t offset = row * DISPLAY_WIDTH_BYTES + firstByte;
+    memcpy(panelBuffer + offset, frameBuffer + offset, lastByte - firstByte);
+  }
+  dumpFrame("window", false);
+}
+
+void EInkDisplay::refreshDisplay(const RefreshMode mode, bool) {
+  if (emulateRefreshTime()) {
+    delay(refreshDuration(mode));
+  }
+  memcpy(panelBuffer, frameBuffer, BUFFER_SIZE);
+  dumpFrame("refresh", false);
+}
+
+void EInkDisplay::copyGrayscaleBuffers(const uint8_t* lsb, const uint8_t* msb) {
+  copyGrayscaleLsbBuffers(lsb);
+  copyGrayscaleMsbBuffers(msb);
+}
+
+void EInkDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsb) { memcpy(lsbBuffer, lsb, BUFFER_SIZE); }
+
+void EInkDisplay::copyGrayscaleMsbBuffers(const uint8_t* msb) { memcpy(msbBuffer, msb, BUFFER_SIZE); }
+
+void EInkDisplay::displayGrayBuffer(bool) {
+  if (emulateRefreshTime()) {
+    delay(refreshDuration(FAST_REFRESH));
+  }
+  memcpy(panelBuffer, frameBuffer, BUFFER_SIZE);
+  dumpFrame("gray", true);
+}
+
+void EInkDisplay::dumpFrame(const char* kind, const bool gray) {
+  const uint32_t frame = frameCount++;
+
+  const char* formatEnv = getenv("CROSSPOINT_FRAME_FORMAT");
+  const std::string format = formatEnv && *formatEnv ? formatEnv : "png";
+  if (format == "none") {
+    return;
+  }
+  const char* dirEnv = getenv("CROSSPOINT_FRAME_DIR");
+  const std::filesystem::path dir = dirEnv && *dirEnv ? dirEnv : "frames";
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+
+  // Portrait as the device is held, the inverse of GfxRenderer's Portrait rotation
+  constexpr int width = DISPLAY_HEIGHT;
+  constexpr int height = DISPLAY_WIDTH;
+  std::vector<uint8_t> pixels(width * height);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const int phyX = y;
+      const int phyY = DISPLAY_HEIGHT - 1 - x;
+      uint8_t value = isWhite(frameBuffer, phyX, phyY) ? 255 : 0;
+      // Gray passes mark dark gray in both planes and light gray in the MSB plane only
+      if (gray && value) {
+        if (isWhite(msbBuffer, phyX, phyY)) {
+          value = isWhite(lsbBuffer, phyX, phyY) ? 85 : 170;
+        }
+      }
+      pixels[y * width + x] = value;
+    }
+  }
+
+  char name[64];
+  const bool pbm = format == "pbm";
+  snprintf(name, sizeof(name), "frame_%04lu_%s.%s", static_cast<unsigned long>(frame), kind,
+           pbm ? (gray ? "pgm" : "pbm") : "png");
+  const std::string path = (dir / name).string();
+  FILE* fp = fopen(path.c_str(), "wb");
+  if (!fp) {
+    LOG_ERR("EMU", "Can't write frame %s", path.c_str());
+    return;
+  }
+
+  if (pbm && gray) {
+    fprintf(fp, "P5\n%d %d\n255\n", width, height);
+    fwrite(pixels.data(), 1, pixels.size(), fp);
+  } else if (pbm) {
+    fprintf(fp, "P4\n%d %d\n", width, height);
+    std::vector<uint8_t> row(width / 8);
+    for (int y = 0; y < height; y++) {
+      std::fill(row.begin(), row.end(), 0);
+      for (int x = 0; x < width; x++) {
+        if (pixels[y * width + x] == 0) {
+          row[x / 8] |= 0x80 >> (x % 8);
+        }
+      }
+      fwrite(row.data(), 1, row.size(), fp);
+    }
+  } else {
+    size_t pngSize = 0;
+    void* png = tdefl_write_image_to_png_file_in_memory(pixels.data(), width, height, 1, &pngSize);
+    if (png) {
+      fwrite(png, 1, pngSize, fp);
+      mz_free(png);
+    }
+  }
+  fclose(fp);
+  LOG_DBG("EMU", "Frame %lu (%s) written to %s", static_cast<unsigned long>(frame), kind, path.c_str());
+}
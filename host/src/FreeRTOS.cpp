@@ -0,0 +1,132 @@
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct HostTask {
+  std::string name;
+  std::mutex lock;
+  std::condition_variable notified;
+  uint32_t notifications = 0;
+};
+
+struct HostSemaphore {
+  std::mutex lock;
+  std::condition_variable available;
+  bool taken;
+};
+
+namespace {
+// Thrown by vTaskDelete(nullptr) to unwind the task's thread
+struct TaskDeleted {};
+
+thread_local HostTask* currentTask = nullptr;
+
+template <typename Predicate>
+bool waitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock, const TickType_t ticks,
+             Predicate predicate) {
+  if (ticks == portMAX_DELAY) {
+    cv.wait(lock, predicate);
+    return true;
+  }
+  return cv.wait_for(lock, std::chrono::milliseconds(ticks), predicate);
+}
+}  // namespace
+
+BaseType_t xTaskCreate(const TaskFunction_t fn, const char* name, uint32_t, void* param, UBaseType_t,
+                       TaskHandle_t* handle) {
+  auto* task = new HostTask();
+  task->name = name;
+  if (handle) {
+    *handle = task;
+  }
+  std::thread([fn, param, task] {
+    currentTask = task;
+    try {
+      fn(param);
+    } catch (const TaskDeleted&) {
+    }
+  }).detach();
+  return pdPASS;
+}
+
+void vTaskDelete(const TaskHandle_t task) {
+  if (task == nullptr || task == currentTask) {
+    throw TaskDeleted();
+  }
+}
+
+void vTaskDelay(const TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+TickType_t xTaskGetTickCount() { return millis(); }
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  if (!currentTask) {
+    // The main thread, or any thread not created through xTaskCreate
+    currentTask = new HostTask();
+    currentTask->name = "main";
+  }
+  return currentTask;
+}
+
+uint32_t ulTaskNotifyTake(const BaseType_t clearOnExit, const TickType_t ticksToWait) {
+  HostTask* task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->lock);
+  if (!waitFor(task->notified, lock, ticksToWait, [task] { return task->notifications > 0; })) {
+    return 0;
+  }
+  const uint32_t count = task->notifications;
+  task->notifications = clearOnExit ? 0 : count - 1;
+  return count;
+}
+
+BaseType_t xTaskNotifyGive(const TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> lock(task->lock);
+    task->notifications++;
+  }
+  task->notified.notify_one();
+  return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  auto* semaphore = new HostSemaphore();
+  semaphore->taken = false;
+  return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  // Binary semaphores start empty, the first take waits for a give
+  auto* semaphore = new HostSemaphore();
+  semaphore->taken = true;
+  return semaphore;
+}
+
+void vSemaphoreDelete(const SemaphoreHandle_t semaphore) { delete semaphore; }
+
+BaseType_t xSemaphoreTake(const SemaphoreHandle_t semaphore, const TickType_t ticksToWait) {
+  std::unique_lock<std::mutex> lock(semaphore->lock);
+  if (!waitFor(semaphore->available, lock, ticksToWait, [semaphore] { return !semaphore->taken; })) {
+    return pdFALSE;
+  }
+  semaphore->taken = true;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(const SemaphoreHandle_t semaphore) {
+  {
+    std::lock_guard<std::mutex> lock(semaphore->lock);
+    if (!semaphore->taken) {
+      return pdFALSE;
+    }
+    semaphore->taken = false;
+  }
+  semaphore->available.notify_one();
+  return pdTRUE;
+}
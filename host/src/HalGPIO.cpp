@@ -0,0 +1,177 @@
+// Host backend of HalGPIO, buttons come from a HostInput script
+#include <HalGPIO.h>
+#include <HostInput.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+struct Step {
+  int button;  // -1 for a wait
+  uint32_t durationMs;
+};
+
+std::deque<Step> steps;
+
+// State of the button being played, mirrors InputManager's edge semantics
+int activeButton = -1;
+int releasedButton = -1;
+bool pressedEdge = false;
+bool releasedEdge = false;
+unsigned long stepStart = 0;
+unsigned long lastHeldTime = 0;
+bool waiting = false;
+
+constexpr const char* BUTTON_NAMES[] = {"BACK", "CONFIRM", "LEFT", "RIGHT", "UP", "DOWN", "POWER"};
+
+int buttonIndex(const std::string& name) {
+  for (int i = 0; i < static_cast<int>(std::size(BUTTON_NAMES)); i++) {
+    if (name == BUTTON_NAMES[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool parseLine(std::string line, const int lineNumber) {
+  line = line.substr(0, line.find('#'));
+  std::istringstream words(line);
+  std::string word;
+  if (!(words >> word)) {
+    return true;
+  }
+
+  if (word == "wait") {
+    uint32_t ms = 0;
+    if (!(words >> ms)) {
+      LOG_ERR("EMU", "Input script line %d: wait needs a duration", lineNumber);
+      return false;
+    }
+    HostInput::wait(ms);
+    return true;
+  }
+
+  const int button = buttonIndex(word);
+  if (button < 0) {
+    LOG_ERR("EMU", "Input script line %d: unknown button %s", lineNumber, word.c_str());
+    return false;
+  }
+  int count = 1;
+  uint32_t holdMs = 0;
+  while (words >> word) {
+    if (word == "hold") {
+      words >> holdMs;
+    } else if ((count = atoi(word.c_str())) <= 0) {
+      LOG_ERR("EMU", "Input script line %d: bad count %s", lineNumber, word.c_str());
+      return false;
+    }
+  }
+  HostInput::press(button, holdMs, count);
+  return true;
+}
+
+bool parseStream(std::istream& in, const char separator) {
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(in, line, separator)) {
+    if (!parseLine(line, ++lineNumber)) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+bool HostInput::loadScript(const char* path) {
+  std::ifstream in(path);
+  if (!in) {
+    LOG_ERR("EMU", "Can't read input script %s", path);
+    return false;
+  }
+  return parseStream(in, '\n');
+}
+
+bool HostInput::loadScriptText(const char* text) {
+  std::string script(text);
+  std::replace(script.begin(), script.end(), ';', '\n');
+  std::istringstream in(script);
+  return parseStream(in, '\n');
+}
+
+void HostInput::press(const uint8_t buttonIndex, const uint32_t holdMs, const int count) {
+  for (int i = 0; i < count; i++) {
+    steps.push_back({buttonIndex, holdMs});
+  }
+}
+
+void HostInput::wait(const uint32_t ms) { steps.push_back({-1, ms}); }
+
+bool HostInput::finished() { return steps.empty() && activeButton < 0 && !waiting; }
+
+void HalGPIO::begin() {}
+
+void HalGPIO::update() {
+  pressedEdge = false;
+  releasedEdge = false;
+  const unsigned long now = millis();
+
+  if (activeButton >= 0) {
+    // Released on the first update after the hold time, so every press is seen pressed for at least one update
+    if (now - stepStart >= steps.front().durationMs) {
+      lastHeldTime = now - stepStart;
+      releasedEdge = true;
+      releasedButton = activeButton;
+      steps.pop_front();
+      activeButton = -1;
+    }
+    return;
+  }
+  if (waiting) {
+    if (now - stepStart >= steps.front().durationMs) {
+      steps.pop_front();
+      waiting = false;
+    }
+    return;
+  }
+  if (steps.empty()) {
+    return;
+  }
+
+  stepStart = now;
+  if (steps.front().button < 0) {
+    waiting = true;
+    return;
+  }
+  activeButton = steps.front().button;
+  pressedEdge = true;
+  LOG_DBG("EMU", "Pressed %s", BUTTON_NAMES[activeButton]);
+}
+
+bool HalGPIO::isPressed(const uint8_t buttonIndex) const { return activeButton == buttonIndex; }
+
+bool HalGPIO::wasPressed(const uint8_t buttonIndex) const { return pressedEdge && activeButton == buttonIndex; }
+
+bool HalGPIO::wasAnyPressed() const { return pressedEdge; }
+
+bool HalGPIO::wasReleased(const uint8_t buttonIndex) const { return releasedEdge && releasedButton == buttonIndex; }
+
+bool HalGPIO::wasAnyReleased() const { return releasedEdge; }
+
+unsigned long HalGPIO::getHeldTime() const { return activeButton >= 0 ? millis() - stepStart : lastHeldTime; }
+
+void HalGPIO::startDeepSleep() {
+  // Nothing wakes the emulator up again
+  LOG_INF("EMU", "Deep sleep, exiting");
+  logSerial.flush();
+  std::exit(0);
+}
+
+int HalGPIO::getBatteryPercentage() const { return 100; }
+
+bool HalGPIO::isUsbConnected() const { return true; }
+
+HalGPIO::WakeupReason HalGPIO::getWakeupReason() const { return WakeupReason::AfterFlash; }
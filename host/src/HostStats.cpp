@@ -0,0 +1,108 @@
+#include <HeapAccounting.h>
+#include <HostStats.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace {
+std::atomic<uint64_t> allocations{0};
+std::atomic<uint64_t> allocatedBytes{0};
+std::atomic<uint64_t> liveBytes{0};
+std::atomic<uint64_t> peakLiveBytes{0};
+std::atomic<uint64_t> sdOpens{0};
+std::atomic<uint64_t> sdBytesRead{0};
+std::atomic<uint64_t> sdBytesWritten{0};
+}  // namespace
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+
+// Wrap glibc's allocator. Sizes are taken from malloc_usable_size() on both sides so frees balance allocations
+// whatever the allocator rounded them up to.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+void* counted(void* ptr) {
+  if (!ptr) {
+    return ptr;
+  }
+  const uint64_t size = malloc_usable_size(ptr);
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  const uint64_t live = liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+  uint64_t peak = peakLiveBytes.load(std::memory_order_relaxed);
+  while (live > peak && !peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+  HeapAccounting::onAllocation(size);
+  return ptr;
+}
+
+void uncounted(void* ptr) {
+  if (ptr) {
+    liveBytes.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+  }
+}
+}  // namespace
+
+extern "C" {
+void* malloc(const size_t size) { return counted(__libc_malloc(size)); }
+
+void* calloc(const size_t count, const size_t size) { return counted(__libc_calloc(count, size)); }
+
+void* realloc(void* ptr, const size_t size) {
+  uncounted(ptr);
+  void* result = __libc_realloc(ptr, size);
+  if (!result && ptr && size > 0) {
+    // Failed, the old block is still live
+    return counted(ptr);
+  }
+  return counted(result);
+}
+
+void* memalign(const size_t alignment, const size_t size) { return counted(__libc_memalign(alignment, size)); }
+
+void* aligned_alloc(const size_t alignment, const size_t size) { return memalign(alignment, size); }
+
+int posix_memalign(void** result, const size_t alignment, const size_t size) {
+  void* ptr = memalign(alignment, size);
+  if (!ptr) {
+    return 12;  // ENOMEM
+  }
+  *result = ptr;
+  return 0;
+}
+
+void free(void* ptr) {
+  uncounted(ptr);
+  __libc_free(ptr);
+}
+}
+#endif
+
+HostStats::Counters HostStats::snapshot() {
+  Counters counters;
+  counters.allocations = allocations.load(std::memory_order_relaxed);
+  counters.allocatedBytes = allocatedBytes.load(std::memory_order_relaxed);
+  counters.liveBytes = liveBytes.load(std::memory_order_relaxed);
+  counters.peakLiveBytes = peakLiveBytes.load(std::memory_order_relaxed);
+  counters.sdOpens = sdOpens.load(std::memory_order_relaxed);
+  counters.sdBytesRead = sdBytesRead.load(std::memory_order_relaxed);
+  counters.sdBytesWritten = sdBytesWritten.load(std::memory_order_relaxed);
+  return counters;
+}
+
+void HostStats::resetPeak() {
+  peakLiveBytes.store(liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void HostStats::countSdOpen() { sdOpens.fetch_add(1, std::memory_order_relaxed); }
+
+void HostStats::countSdRead(const uint64_t bytes) { sdBytesRead.fetch_add(bytes, std::memory_order_relaxed); }
+
+void HostStats::countSdWrite(const uint64_t bytes) { sdBytesWritten.fetch_add(bytes, std::memory_order_relaxed); }
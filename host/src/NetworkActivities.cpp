@@ -0,0 +1,44 @@
+// Host stand-ins for the activities that need WiFi. There is no network on the host, each of them logs that and
+// leaves on its first loop() the way it does when the connection fails or is cancelled.
+#include <Logging.h>
+
+#include "activities/network/WifiSelectionActivity.h"
+#include "activities/reader/KOReaderSyncActivity.h"
+#include "activities/settings/KOReaderAuthActivity.h"
+#include "activities/settings/OtaUpdateActivity.h"
+
+void WifiSelectionActivity::onEnter() {
+  ActivityWithSubactivity::onEnter();
+  LOG_INF("EMU", "No WiFi on the host");
+}
+
+void WifiSelectionActivity::onExit() { ActivityWithSubactivity::onExit(); }
+
+void WifiSelectionActivity::loop() { onComplete(false); }
+
+void KOReaderSyncActivity::onEnter() {
+  ActivityWithSubactivity::onEnter();
+  LOG_INF("EMU", "No KOReader sync on the host");
+}
+
+void KOReaderSyncActivity::onExit() { ActivityWithSubactivity::onExit(); }
+
+void KOReaderSyncActivity::loop() { onCancel(); }
+
+void KOReaderAuthActivity::onEnter() {
+  ActivityWithSubactivity::onEnter();
+  LOG_INF("EMU", "No KOReader sync on the host");
+}
+
+void KOReaderAuthActivity::onExit() { ActivityWithSubactivity::onExit(); }
+
+void KOReaderAuthActivity::loop() { onComplete(); }
+
+void OtaUpdateActivity::onEnter() {
+  ActivityWithSubactivity::onEnter();
+  LOG_INF("EMU", "No OTA updates on the host");
+}
+
+void OtaUpdateActivity::onExit() { ActivityWithSubactivity::onExit(); }
+
+void OtaUpdateActivity::loop() { goBack(); }
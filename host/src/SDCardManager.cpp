@@ -0,0 +1,360 @@
+#include <HostStats.h>
+#include <Logging.h>
+#include <SDCardManager.h>
+
+#include <cstdio>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+SDCardManager SDCardManager::instance;
+
+struct FsFile::Impl {
+  FILE* fp = nullptr;
+  fs::path path;
+  bool directory = false;
+  // Directory listing, taken when iteration starts
+  std::vector<fs::path> entries;
+  size_t nextEntry = 0;
+  bool listed = false;
+};
+
+bool FsFile::isOpen() const { return impl && (impl->fp || impl->directory); }
+
+void FsFile::close() {
+  if (!impl) {
+    return;
+  }
+  if (impl->fp) {
+    fclose(impl->fp);
+    impl->fp = nullptr;
+  }
+  impl->directory = false;
+  impl.reset();
+}
+
+int FsFile::read() {
+  if (!impl || !impl->fp) {
+    return -1;
+  }
+  const int c = fgetc(impl->fp);
+  if (c == EOF) {
+    return -1;
+  }
+  HostStats::countSdRead(1);
+  return c;
+}
+
+int FsFile::read(void* buffer, const size_t size) {
+  if (!impl || !impl->fp) {
+    return -1;
+  }
+  const size_t bytesRead = fread(buffer, 1, size, impl->fp);
+  HostStats::countSdRead(bytesRead);
+  return static_cast<int>(bytesRead);
+}
+
+int FsFile::peek() {
+  if (!impl || !impl->fp) {
+    return -1;
+  }
+  const int c = fgetc(impl->fp);
+  if (c == EOF) {
+    return -1;
+  }
+  ungetc(c, impl->fp);
+  return c;
+}
+
+int FsFile::available() {
+  if (!impl || !impl->fp) {
+    return 0;
+  }
+  const size_t remaining = size() - position();
+  return static_cast<int>(std::min<size_t>(remaining, INT32_MAX));
+}
+
+size_t FsFile::write(const uint8_t b) { return write(&b, 1); }
+
+size_t FsFile::write(const uint8_t* buffer, const size_t size) {
+  if (!impl || !impl->fp) {
+    return 0;
+  }
+  const size_t written = fwrite(buffer, 1, size, impl->fp);
+  HostStats::countSdWrite(written);
+  return written;
+}
+
+void FsFile::flush() {
+  if (impl && impl->fp) {
+    fflush(impl->fp);
+  }
+}
+
+bool FsFile::seekSet(const size_t position) {
+  return impl && impl->fp && fseeko(impl->fp, static_cast<off_t>(position), SEEK_SET) == 0;
+}
+
+bool FsFile::seekCur(const int64_t offset) {
+  return impl && impl->fp && fseeko(impl->fp, static_cast<off_t>(offset), SEEK_CUR) == 0;
+}
+
+bool FsFile::seekEnd(const int64_t offset) {
+  return impl && impl->fp && fseeko(impl->fp, static_cast<off_t>(offset), SEEK_END) == 0;
+}
+
+size_t FsFile::position() const {
+  if (!impl || !impl->fp) {
+    return 0;
+  }
+  const off_t pos = ftello(impl->fp);
+  return pos < 0 ? 0 : static_cast<size_t>(pos);
+}
+
+size_t FsFile::size() const {
+  if (!impl || !impl->fp) {
+    return 0;
+  }
+  // Written data may still sit in the stdio buffer
+  fflush(impl->fp);
+  std::error_code ec;
+  const auto fileSize = fs::file_size(impl->path, ec);
+  return ec ? 0 : static_cast<size_t>(fileSize);
+}
+
+bool FsFile::isDirectory() const { return impl && impl->directory; }
+
+FsFile FsFile::openNextFile(const oflag_t oflag) {
+  if (!isDirectory()) {
+    return {};
+  }
+  if (!impl->listed) {
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(impl->path, ec)) {
+      impl->entries.push_back(entry.path());
+    }
+    impl->listed = true;
+  }
+  while (impl->nextEntry < impl->entries.size()) {
+    const fs::path& entryPath = impl->entries[impl->nextEntry++];
+    auto entry = std::make_shared<Impl>();
+    entry->path = entryPath;
+    if (fs::is_directory(entryPath)) {
+      entry->directory = true;
+      return FsFile(entry);
+    }
+    entry->fp = fopen(entryPath.c_str(), (oflag & O_ACCMODE) == O_RDONLY ? "rb" : "r+b");
+    if (entry->fp) {
+      HostStats::countSdOpen();
+      return FsFile(entry);
+    }
+  }
+  return {};
+}
+
+void FsFile::rewindDirectory() {
+  if (isDirectory()) {
+    impl->entries.clear();
+    impl->nextEntry = 0;
+    impl->listed = false;
+  }
+}
+
+size_t FsFile::getName(char* name, const size_t size) const {
+  if (!impl || size == 0) {
+    return 0;
+  }
+  const std::string fileName = impl->path.filename().string();
+  const size_t len = std::min(fileName.size(), size - 1);
+  memcpy(name, fileName.data(), len);
+  name[len] = '\0';
+  return len;
+}
+
+bool FsFile::rename(const char* newPath) {
+  if (!impl) {
+    return false;
+  }
+  const fs::path target = SdMan.hostPath(newPath);
+  std::error_code ec;
+  fs::rename(impl->path, target, ec);
+  if (ec) {
+    return false;
+  }
+  impl->path = target;
+  return true;
+}
+
+bool SDCardManager::begin() {
+  const char* env = getenv("CROSSPOINT_SD_ROOT");
+  root = env && *env ? env : "sdcard";
+  std::error_code ec;
+  fs::create_directories(root, ec);
+  initialized = fs::is_directory(root);
+  if (initialized) {
+    LOG_INF("SD", "Emulated SD card at %s", fs::absolute(root).c_str());
+  } else {
+    LOG_ERR("SD", "Can't use %s as SD card", root.c_str());
+  }
+  return initialized;
+}
+
+std::string SDCardManager::hostPath(const char* path) const {
+  std::string result = root;
+  if (!path || *path != '/') {
+    result += '/';
+  }
+  return result + (path ? path : "");
+}
+
+std::vector<String> SDCardManager::listFiles(const char* path, const int maxFiles) {
+  std::vector<String> files;
+  std::error_code ec;
+  for (const auto& entry : fs::directory_iterator(hostPath(path), ec)) {
+    if (static_cast<int>(files.size()) >= maxFiles) {
+      break;
+    }
+    if (entry.is_regular_file()) {
+      files.emplace_back(entry.path().filename().c_str());
+    }
+  }
+  return files;
+}
+
+String SDCardManager::readFile(const char* path) {
+  FsFile file = open(path);
+  if (!file) {
+    return String();
+  }
+  String content;
+  char buffer[256];
+  int read;
+  while ((read = file.read(buffer, sizeof(buffer))) > 0) {
+    content += String(buffer, read);
+  }
+  return content;
+}
+
+bool SDCardManager::readFileToStream(const char* path, Print& out, const size_t chunkSize) {
+  FsFile file = open(path);
+  if (!file) {
+    return false;
+  }
+  std::vector<uint8_t> buffer(chunkSize);
+  int read;
+  while ((read = file.read(buffer.data(), buffer.size())) > 0) {
+    out.write(buffer.data(), read);
+  }
+  return true;
+}
+
+size_t SDCardManager::readFileToBuffer(const char* path, char* buffer, const size_t bufferSize, const size_t maxBytes) {
+  if (!buffer || bufferSize == 0) {
+    return 0;
+  }
+  FsFile file = open(path);
+  if (!file) {
+    buffer[0] = '\0';
+    return 0;
+  }
+  size_t limit = bufferSize - 1;
+  if (maxBytes > 0) {
+    limit = std::min(limit, maxBytes);
+  }
+  const int read = file.read(buffer, limit);
+  const size_t count = read > 0 ? read : 0;
+  buffer[count] = '\0';
+  return count;
+}
+
+bool SDCardManager::writeFile(const char* path, const String& content) {
+  FsFile file;
+  if (!openFileForWrite("SD", path, file)) {
+    return false;
+  }
+  return file.write(content.c_str(), content.length()) == content.length();
+}
+
+bool SDCardManager::ensureDirectoryExists(const char* path) { return mkdir(path, true); }
+
+FsFile SDCardManager::open(const char* path, const oflag_t oflag) {
+  auto impl = std::make_shared<FsFile::Impl>();
+  impl->path = hostPath(path);
+
+  if (fs::is_directory(impl->path)) {
+    impl->directory = true;
+    return FsFile(impl);
+  }
+
+  const char* mode = "rb";
+  if ((oflag & O_ACCMODE) != O_RDONLY) {
+    const bool exists = fs::exists(impl->path);
+    if (!exists && !(oflag & O_CREAT)) {
+      return {};
+    }
+    if (exists && (oflag & O_EXCL) && (oflag & O_CREAT)) {
+      return {};
+    }
+    mode = (oflag & O_TRUNC) || !exists ? "w+b" : "r+b";
+  }
+  impl->fp = fopen(impl->path.c_str(), mode);
+  if (!impl->fp) {
+    return {};
+  }
+  if (oflag & (O_APPEND | O_AT_END)) {
+    fseeko(impl->fp, 0, SEEK_END);
+  }
+  HostStats::countSdOpen();
+  return FsFile(impl);
+}
+
+bool SDCardManager::mkdir(const char* path, const bool pFlag) {
+  std::error_code ec;
+  const fs::path dir = hostPath(path);
+  if (fs::is_directory(dir)) {
+    return true;
+  }
+  return pFlag ? fs::create_directories(dir, ec) : fs::create_directory(dir, ec);
+}
+
+bool SDCardManager::exists(const char* path) { return fs::exists(hostPath(path)); }
+
+bool SDCardManager::remove(const char* path) {
+  std::error_code ec;
+  const fs::path file = hostPath(path);
+  return !fs::is_directory(file) && fs::remove(file, ec);
+}
+
+bool SDCardManager::rmdir(const char* path) {
+  std::error_code ec;
+  const fs::path dir = hostPath(path);
+  return fs::is_directory(dir) && fs::is_empty(dir) && fs::remove(dir, ec);
+}
+
+bool SDCardManager::removeDir(const char* path) {
+  std::error_code ec;
+  const fs::path dir = hostPath(path);
+  return fs::is_directory(dir) && fs::remove_all(dir, ec) > 0;
+}
+
+bool SDCardManager::openFileForRead(const char* moduleName, const char* path, FsFile& file) {
+  if (!exists(path)) {
+    LOG_ERR(moduleName, "File does not exist: %s", path);
+    return false;
+  }
+  file = open(path, O_RDONLY);
+  if (!file) {
+    LOG_ERR(moduleName, "Failed to open file for reading: %s", path);
+    return false;
+  }
+  return true;
+}
+
+bool SDCardManager::openFileForWrite(const char* moduleName, const char* path, FsFile& file) {
+  file = open(path, O_RDWR | O_CREAT | O_TRUNC);
+  if (!file) {
+    LOG_ERR(moduleName, "Failed to open file for writing: %s", path);
+    return false;
+  }
+  return true;
+}
@@ -1,9 +1,11 @@
 #include "ParsedText.h"
 
 #include <GfxRenderer.h>
+#include <HeapAccounting.h>
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -68,7 +70,8 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle,
 // Consumes data to minimize memory usage
 void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                                       const bool includeLastLine) {
+                                       const bool blockComplete) {
+  HEAP_SCOPE(HeapTag::Layout);
   if (words.empty()) {
     return;
   }
@@ -87,13 +90,43 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
   if (hyphenationEnabled) {
     // Use greedy layout that can split words mid-loop when a hyphenated prefix fits.
     lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
-  } else {
+    // Greedy breaks never look ahead, only the last line can still change
+    if (!blockComplete) {
+      lineBreakIndices.pop_back();
+    }
+  } else if (blockComplete) {
     lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+  } else {
+    lineBreakIndices = computeFinalLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
   }
-  const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
 
-  for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, spaceWidth, wordWidths, continuesVec, lineBreakIndices, processLine);
+  for (size_t i = 0; i < lineBreakIndices.size(); ++i) {
+    const bool isLastLine = blockComplete && i == lineBreakIndices.size() - 1;
+    extractLine(i, pageWidth, spaceWidth, wordWidths, continuesVec, lineBreakIndices, isLastLine, processLine);
+  }
+}
+
+int ParsedText::firstLineIndent() const {
+  // Only for left/justified text without extra paragraph spacing, and only until the first line has been extracted
+  return extractedLineCount == 0 && blockStyle.textIndent > 0 && !extraParagraphSpacing &&
+                 (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
+             ? blockStyle.textIndent
+             : 0;
+}
+
+// Ensure any word that would overflow even as the first entry on a line is split using fallback hyphenation.
+void ParsedText::splitOversizedWords(const GfxRenderer& renderer, const int fontId, const int pageWidth,
+                                     std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec) {
+  const int indent = firstLineIndent();
+  for (size_t i = 0; i < wordWidths.size(); ++i) {
+    // First word needs to fit in reduced width if there's an indent
+    const int effectiveWidth = i == 0 ? pageWidth - indent : pageWidth;
+    while (wordWidths[i] > effectiveWidth) {
+      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, fontId, wordWidths, /*allowFallbackBreaks=*/true,
+                                &continuesVec)) {
+        break;
+      }
+    }
   }
 }
 
@@ -123,24 +156,8 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
     return {};
   }
 
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const int firstLineIndent =
-      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
-
-  // Ensure any word that would overflow even as the first entry on a line is split using fallback hyphenation.
-  for (size_t i = 0; i < wordWidths.size(); ++i) {
-    // First word needs to fit in reduced width if there's an indent
-    const int effectiveWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
-    while (wordWidths[i] > effectiveWidth) {
-      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, fontId, wordWidths, /*allowFallbackBreaks=*/true,
-                                &continuesVec)) {
-        break;
-      }
-    }
-  }
+  const int indent = firstLineIndent();
+  splitOversizedWords(renderer, fontId, pageWidth, wordWidths, continuesVec);
 
   const size_t totalWordCount = words.size();
 
@@ -158,7 +175,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
     dp[i] = MAX_COST;
 
     // First line has reduced width due to text-indent
-    const int effectivePageWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
+    const int effectivePageWidth = i == 0 ? pageWidth - indent : pageWidth;
 
     for (size_t j = i; j < totalWordCount; ++j) {
       // Add space before word j, unless it's the first word on the line or a continuation
@@ -228,10 +245,123 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
   return lineBreakIndices;
 }
 
+// Breaks of the lines no later word can change, for a block whose words are still being read. A forward pass finds
+// the least badness of breaking before each buffered word, the same costs computeLineBreaks() minimizes. However the
+// block goes on, its best layout breaks at the end of the buffer or before a word whose line still has room for all
+// the buffered words after it, and reaches that break along the best path to it. The lines all those paths share
+// are final, the rest stay buffered.
+std::vector<size_t> ParsedText::computeFinalLineBreaks(const GfxRenderer& renderer, const int fontId,
+                                                       const int pageWidth, const int spaceWidth,
+                                                       std::vector<uint16_t>& wordWidths,
+                                                       std::vector<bool>& continuesVec) {
+  const int indent = firstLineIndent();
+  splitOversizedWords(renderer, fontId, pageWidth, wordWidths, continuesVec);
+
+  const size_t totalWordCount = wordWidths.size();
+  constexpr int64_t UNREACHED = std::numeric_limits<int64_t>::max();
+  // cost[k] is the least badness of the lines before word k, previous[k] the start of the last of those lines
+  std::vector<int64_t> cost(totalWordCount + 1, UNREACHED);
+  std::vector<size_t> previous(totalWordCount + 1, 0);
+  cost[0] = 0;
+
+  const auto relax = [&](const size_t end, const int64_t endCost, const size_t start) {
+    if (endCost < cost[end]) {
+      cost[end] = endCost;
+      previous[end] = start;
+    }
+  };
+
+  for (size_t i = 0; i < totalWordCount; ++i) {
+    if (cost[i] == UNREACHED) {
+      continue;
+    }
+    const int effectivePageWidth = i == 0 ? pageWidth - indent : pageWidth;
+    int currlen = 0;
+    bool fits = false;
+
+    for (size_t j = i; j < totalWordCount; ++j) {
+      const int gap = j > i && !continuesVec[j] ? spaceWidth : 0;
+      currlen += wordWidths[j] + gap;
+      if (currlen > effectivePageWidth) {
+        break;
+      }
+      // Cannot break after word j if the next word attaches to it. The word after the buffer isn't known yet, so
+      // the end of the buffer counts as a break.
+      if (j + 1 < totalWordCount && continuesVec[j + 1]) {
+        continue;
+      }
+      fits = true;
+      const int64_t remainingSpace = effectivePageWidth - currlen;
+      relax(j + 1, cost[i] + remainingSpace * remainingSpace, i);
+    }
+
+    // Oversized word on its own line, as in computeLineBreaks()
+    if (!fits) {
+      relax(i + 1, cost[i], i);
+    }
+  }
+
+  // Breaks the rest of the block can continue from, latest first: the end of the buffer, then every break whose line
+  // could take all the buffered words after it
+  std::vector<size_t> open;
+  if (cost[totalWordCount] != UNREACHED) {
+    open.push_back(totalWordCount);
+  }
+  int tailWidth = 0;
+  for (size_t k = totalWordCount; k-- > 0;) {
+    const bool nextContinues = k + 1 < totalWordCount && continuesVec[k + 1];
+    tailWidth += wordWidths[k] + (k + 1 < totalWordCount && !nextContinues ? spaceWidth : 0);
+    if (tailWidth > pageWidth) {
+      break;
+    }
+    if (cost[k] != UNREACHED && tailWidth <= (k == 0 ? pageWidth - indent : pageWidth)) {
+      open.push_back(k);
+    }
+  }
+
+  // Every path from the start passes through the common ancestor of the open breaks, previous[] always points back
+  size_t common = open.empty() ? 0 : open.front();
+  for (size_t k : open) {
+    while (k != common) {
+      if (k > common) {
+        k = previous[k];
+      } else {
+        common = previous[common];
+      }
+    }
+  }
+
+  // Keep the last line buffered even if it is final, the block isn't over
+  if (common == totalWordCount) {
+    common = previous[common];
+  }
+
+  if (common == 0) {
+    // The open breaks have nothing in common yet. Rather than buffer without bound, commit the cheapest of them that
+    // leaves words buffered.
+    size_t best = 0;
+    for (const size_t k : open) {
+      const size_t candidate = k == totalWordCount ? previous[k] : k;
+      if (candidate > 0 && (best == 0 || cost[candidate] < cost[best])) {
+        best = candidate;
+      }
+    }
+    common = best;
+  }
+
+  std::vector<size_t> lineBreakIndices;
+  for (size_t k = common; k > 0; k = previous[k]) {
+    lineBreakIndices.push_back(k);
+  }
+  std::reverse(lineBreakIndices.begin(), lineBreakIndices.end());
+  return lineBreakIndices;
+}
+
 void ParsedText::applyParagraphIndent() {
-  if (extraParagraphSpacing || words.empty()) {
+  if (extraParagraphSpacing || words.empty() || indentApplied) {
     return;
   }
+  indentApplied = true;
 
   if (blockStyle.textIndentDefined) {
     // CSS text-indent is explicitly set (even if 0) - don't use fallback EmSpace
@@ -247,12 +377,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
                                                             const int pageWidth, const int spaceWidth,
                                                             std::vector<uint16_t>& wordWidths,
                                                             std::vector<bool>& continuesVec) {
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const int firstLineIndent =
-      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
+  const int indent = firstLineIndent();
 
   std::vector<size_t> lineBreakIndices;
   size_t currentIndex = 0;
@@ -263,7 +388,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
     int lineWidth = 0;
 
     // First line has reduced width due to text-indent
-    const int effectivePageWidth = isFirstLine ? pageWidth - firstLineIndent : pageWidth;
+    const int effectivePageWidth = isFirstLine ? pageWidth - indent : pageWidth;
 
     // Consume as many words as possible for current line, splitting when prefixes fit
     while (currentIndex < wordWidths.size()) {
@@ -331,14 +456,17 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   const auto style = *styleIt;
 
   // Collect candidate breakpoints (byte offsets and hyphen requirements).
-  auto breakInfos = Hyphenator::breakOffsets(word, allowFallbackBreaks);
-  if (breakInfos.empty()) {
+  Hyphenator::Breaks breakInfos;
+  if (!Hyphenator::breakOffsets(word, allowFallbackBreaks, breakInfos)) {
     return false;
   }
 
   size_t chosenOffset = 0;
   int chosenWidth = -1;
   bool chosenNeedsHyphen = true;
+  // Every candidate prefix is measured from the same buffer
+  std::string prefix;
+  prefix.reserve(word.size() + 1);
 
   // Iterate over each legal breakpoint and retain the widest prefix that still fits.
   for (const auto& info : breakInfos) {
@@ -348,7 +476,11 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
     }
 
     const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
+    prefix.assign(word, 0, offset);
+    if (needsHyphen) {
+      prefix.push_back('-');
+    }
+    const int prefixWidth = measureWordWidth(renderer, fontId, prefix, style);
     if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
       continue;  // Skip if too wide or not an improvement
     }
@@ -401,19 +533,14 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
                              const std::vector<uint16_t>& wordWidths, const std::vector<bool>& continuesVec,
-                             const std::vector<size_t>& lineBreakIndices,
+                             const std::vector<size_t>& lineBreakIndices, const bool isLastLine,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
   const size_t lineWordCount = lineBreak - lastBreakAt;
 
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const bool isFirstLine = breakIndex == 0;
-  const int firstLineIndent =
-      isFirstLine && blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
+  // Non-zero only for the first line of the block
+  const int indent = firstLineIndent();
 
   // Calculate total word width for this line and count actual word gaps
   // (continuation words attach to previous word with no gap)
@@ -429,11 +556,10 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   }
 
   // Calculate spacing (account for indent reducing effective page width on first line)
-  const int effectivePageWidth = pageWidth - firstLineIndent;
+  const int effectivePageWidth = pageWidth - indent;
   const int spareSpace = effectivePageWidth - lineWordWidthSum;
 
   int spacing = spaceWidth;
-  const bool isLastLine = breakIndex == lineBreakIndices.size() - 1;
 
   // For justified text, calculate spacing based on actual gap count
   if (blockStyle.alignment == CssTextAlign::Justify && !isLastLine && actualGapCount >= 1) {
@@ -441,7 +567,7 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   }
 
   // Calculate initial x position (first line starts at indent for left/justified text)
-  auto xpos = static_cast<uint16_t>(firstLineIndent);
+  auto xpos = static_cast<uint16_t>(indent);
   if (blockStyle.alignment == CssTextAlign::Right) {
     xpos = spareSpace - static_cast<int>(actualGapCount) * spaceWidth;
   } else if (blockStyle.alignment == CssTextAlign::Center) {
@@ -487,6 +613,7 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
     }
   }
 
+  extractedLineCount++;
   processLine(
       std::make_shared<TextBlock>(std::move(lineWords), std::move(lineXPos), std::move(lineWordStyles), blockStyle));
 }
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Perfect hash tables over fixed sets of strings, built by the compiler (hash and displace). A key's 32-bit hash
+// picks a bucket, the bucket's displacement moves every key of the bucket to a slot of its own, so a lookup hashes
+// the string once and compares it against at most one key.
+namespace perfect_hash {
+
+constexpr uint32_t FNV_OFFSET = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+
+constexpr uint32_t step(const uint32_t hash, const char c) { return (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME; }
+
+constexpr uint32_t hash(const std::string_view key) {
+  uint32_t result = FNV_OFFSET;
+  for (const char c : key) {
+    result = step(result, c);
+  }
+  return result;
+}
+
+// Same as hash() for a NUL-terminated string
+inline uint32_t hash(const char* key) {
+  uint32_t result = FNV_OFFSET;
+  while (*key) {
+    result = step(result, *key++);
+  }
+  return result;
+}
+
+// Spreads a displaced hash over the slots, so displacements of a bucket land its keys in unrelated slots
+constexpr uint32_t mix(uint32_t value) {
+  value ^= value >> 16;
+  value *= 0x7feb352du;
+  value ^= value >> 15;
+  value *= 0x846ca68bu;
+  value ^= value >> 16;
+  return value;
+}
+
+template <size_t KeyCount, size_t SlotCount, size_t BucketCount>
+struct Table {
+  static_assert(KeyCount < 0xFF, "slots hold key indices in a byte");
+  static_assert((SlotCount & (SlotCount - 1)) == 0 && (BucketCount & (BucketCount - 1)) == 0,
+                "slot and bucket counts are powers of two");
+
+  static constexpr uint8_t EMPTY = 0xFF;
+
+  uint16_t displacements[BucketCount] = {};
+  uint8_t slots[SlotCount] = {};
+
+  static constexpr size_t slotOf(const uint32_t hash, const uint16_t displacement) {
+    return mix(hash ^ displacement * 0x9e3779b9u) & (SlotCount - 1);
+  }
+
+  // Index of the only key that can hash to `hash`, or KeyCount if there is none. The caller compares the strings.
+  constexpr size_t candidate(const uint32_t hash) const {
+    const uint8_t index = slots[slotOf(hash, displacements[hash & (BucketCount - 1)])];
+    return index == EMPTY ? KeyCount : index;
+  }
+};
+
+// Builds the table for the `key` members of `entries`, which have to be distinct. Meant for constexpr variables, a
+// set of keys that can't be placed fails to compile.
+template <size_t SlotCount, size_t BucketCount, typename Entry, size_t KeyCount>
+constexpr Table<KeyCount, SlotCount, BucketCount> build(const Entry (&entries)[KeyCount]) {
+  using Result = Table<KeyCount, SlotCount, BucketCount>;
+  Result table{};
+  for (auto& slot : table.slots) {
+    slot = Result::EMPTY;
+  }
+
+  uint32_t hashes[KeyCount] = {};
+  size_t bucketSizes[BucketCount] = {};
+  for (size_t i = 0; i < KeyCount; i++) {
+    hashes[i] = hash(std::string_view(entries[i].key));
+    bucketSizes[hashes[i] & (BucketCount - 1)]++;
+  }
+
+  // Largest buckets first, while most slots are still free
+  for (size_t size = KeyCount; size > 0; size--) {
+    for (size_t bucket = 0; bucket < BucketCount; bucket++) {
+      if (bucketSizes[bucket] != size) continue;
+
+      for (uint32_t displacement = 0;; displacement++) {
+        if (displacement > 0xFFFF) {
+          throw "keys can't be placed, two of them have the same hash";
+        }
+        size_t placed[KeyCount] = {};
+        size_t placedCount = 0;
+        bool fits = true;
+        for (size_t i = 0; i < KeyCount && fits; i++) {
+          if ((hashes[i] & (BucketCount - 1)) != bucket) continue;
+          const size_t slot = Result::slotOf(hashes[i], static_cast<uint16_t>(displacement));
+          if (table.slots[slot] != Result::EMPTY) {
+            fits = false;
+          } else {
+            table.slots[slot] = static_cast<uint8_t>(i);
+            placed[placedCount++] = slot;
+          }
+        }
+        if (fits) {
+          table.displacements[bucket] = static_cast<uint16_t>(displacement);
+          break;
+        }
+        for (size_t i = 0; i < placedCount; i++) {
+          table.slots[placed[i]] = Result::EMPTY;
+        }
+      }
+    }
+  }
+  return table;
+}
+
+}  // namespace perfect_hash
@@ -3,6 +3,7 @@
 #include <HalStorage.h>
 #include <Logging.h>
 #include <Serialization.h>
+#include <Trace.h>
 
 #include "Page.h"
 #include "hyphenation/Hyphenator.h"
@@ -129,6 +130,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
                                 const std::function<void()>& popupFn) {
+  TRACE_SCOPE(TraceModule::Section, "buildSection", spineIndex);
   const auto localPath = epub->getSpineItem(spineIndex).href;
   const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
 
@@ -152,7 +154,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
       Storage.remove(tmpHtmlPath.c_str());
     }
 
-    FsFile tmpHtml;
+    HalFile tmpHtml;
     if (!Storage.openFileForWrite("SCT", tmpHtmlPath, tmpHtml)) {
       continue;
     }
@@ -187,7 +189,12 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
       [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
       embeddedStyle, popupFn, embeddedStyle ? epub->getCssParser() : nullptr);
   Hyphenator::setPreferredLanguage(epub->getLanguage());
-  success = visitor.parseAndBuildPages();
+  {
+    const Hyphenator::ChapterCache hyphenationCache;
+    success = visitor.parseAndBuildPages();
+    LOG_DBG("SCT", "Hyphenation cache: %lu hits, %lu misses", static_cast<unsigned long>(hyphenationCache.hits),
+            static_cast<unsigned long>(hyphenationCache.misses));
+  }
 
   Storage.remove(tmpHtmlPath.c_str());
   if (!success) {
@@ -223,7 +230,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   return true;
 }
 
-std::unique_ptr<Page> Section::loadPageFromSectionFile() {
+std::unique_ptr<Page> Section::loadPageFromSectionFile(const int pageNumber) {
   if (!Storage.openFileForRead("SCT", filePath, file)) {
     return nullptr;
   }
@@ -231,7 +238,7 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   file.seek(HEADER_SIZE - sizeof(uint32_t));
   uint32_t lutOffset;
   serialization::readPod(file, lutOffset);
-  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
+  file.seek(lutOffset + sizeof(uint32_t) * pageNumber);
   uint32_t pagePos;
   serialization::readPod(file, pagePos);
   file.seek(pagePos);
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CssParser.h"
+
+/**
+ * The open elements above the element being styled, for matching descendant
+ * and child selectors (see CssParser::resolveStyle).
+ *
+ * Elements are pushed with the parser depth they were opened at and popped
+ * lazily when an element at the same or a lower depth starts. A counting bloom
+ * filter over the tag and class ids of all ancestors lets selectors whose
+ * ancestor parts name a tag or class that isn't open be rejected without
+ * walking the stack.
+ */
+class CssAncestors {
+ public:
+  // Ancestors nested deeper than this aren't tracked, selectors with ancestor parts don't match below them
+  static constexpr size_t MAX_DEPTH = 32;
+  // Classes of an ancestor beyond this many can't match ancestor parts of selectors
+  static constexpr size_t MAX_CLASSES = 4;
+
+  struct Element {
+    int depth;
+    CssParser::SelectorId tagId;
+    uint8_t classCount;
+    CssParser::SelectorId classIds[MAX_CLASSES];
+  };
+
+  // Drop the elements opened at `depth` or deeper, they are closed once an element at `depth` starts
+  void popTo(const int depth) {
+    while (count > 0 && elements[count - 1].depth >= depth) {
+      const Element& element = elements[--count];
+      removeFromFilter(element.tagId);
+      for (uint8_t i = 0; i < element.classCount; i++) {
+        removeFromFilter(element.classIds[i]);
+      }
+    }
+    if (truncatedDepth >= depth) {
+      truncatedDepth = INT32_MAX;
+    }
+  }
+
+  void push(const int depth, const CssParser::SelectorId tagId, const CssParser::SelectorId* classIds,
+            const size_t classCount) {
+    if (count == MAX_DEPTH) {
+      if (depth < truncatedDepth) {
+        truncatedDepth = depth;
+      }
+      return;
+    }
+    Element& element = elements[count++];
+    element.depth = depth;
+    element.tagId = tagId;
+    element.classCount = static_cast<uint8_t>(classCount < MAX_CLASSES ? classCount : MAX_CLASSES);
+    addToFilter(tagId);
+    for (uint8_t i = 0; i < element.classCount; i++) {
+      element.classIds[i] = classIds[i];
+      addToFilter(classIds[i]);
+    }
+  }
+
+  // False if some ancestor of the current element wasn't tracked
+  [[nodiscard]] bool complete() const { return truncatedDepth == INT32_MAX; }
+
+  // False if no open element has this tag or class, true if one probably has
+  [[nodiscard]] bool mayContain(const CssParser::SelectorId id) const {
+    return filter[id & 0xFF] != 0 && filter[(id >> 8) & 0xFF] != 0;
+  }
+
+  [[nodiscard]] size_t size() const { return count; }
+  // 0 is the outermost element
+  [[nodiscard]] const Element& operator[](const size_t index) const { return elements[index]; }
+
+ private:
+  void addToFilter(const CssParser::SelectorId id) {
+    filter[id & 0xFF]++;
+    filter[(id >> 8) & 0xFF]++;
+  }
+
+  void removeFromFilter(const CssParser::SelectorId id) {
+    filter[id & 0xFF]--;
+    filter[(id >> 8) & 0xFF]--;
+  }
+
+  Element elements[MAX_DEPTH] = {};
+  size_t count = 0;
+  // Depth of the outermost element that didn't fit, INT32_MAX if all did
+  int truncatedDepth = INT32_MAX;
+  // uint16_t so MAX_DEPTH elements of identical ids can't overflow a counter
+  uint16_t filter[256] = {};
+};
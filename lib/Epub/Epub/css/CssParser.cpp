@@ -4,6 +4,10 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <initializer_list>
+
+#include "CssAncestors.h"
 
 namespace {
 
@@ -13,132 +17,12 @@ constexpr size_t READ_BUFFER_SIZE = 512;
 // Maximum CSS file size we'll process (prevent memory issues)
 constexpr size_t MAX_CSS_SIZE = 64 * 1024;
 
+// Rules applied to one element at most, past it the lowest ranked matches are dropped
+constexpr size_t MAX_MATCHES = 24;
+
 // Check if character is CSS whitespace
 bool isCssWhitespace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'; }
 
-// Read entire file into string (with size limit)
-std::string readFileContent(FsFile& file) {
-  std::string content;
-  content.reserve(std::min(static_cast<size_t>(file.size()), MAX_CSS_SIZE));
-
-  char buffer[READ_BUFFER_SIZE];
-  while (file.available() && content.size() < MAX_CSS_SIZE) {
-    const int bytesRead = file.read(buffer, sizeof(buffer));
-    if (bytesRead <= 0) break;
-    content.append(buffer, bytesRead);
-  }
-  return content;
-}
-
-// Remove CSS comments (/* ... */) from content
-std::string stripComments(const std::string& css) {
-  std::string result;
-  result.reserve(css.size());
-
-  size_t pos = 0;
-  while (pos < css.size()) {
-    // Look for start of comment
-    if (pos + 1 < css.size() && css[pos] == '/' && css[pos + 1] == '*') {
-      // Find end of comment
-      const size_t endPos = css.find("*/", pos + 2);
-      if (endPos == std::string::npos) {
-        // Unterminated comment - skip rest of file
-        break;
-      }
-      pos = endPos + 2;
-    } else {
-      result.push_back(css[pos]);
-      ++pos;
-    }
-  }
-  return result;
-}
-
-// Skip @-rules (like @media, @import, @font-face)
-// Returns position after the @-rule
-size_t skipAtRule(const std::string& css, const size_t start) {
-  // Find the end - either semicolon (simple @-rule) or matching brace
-  size_t pos = start + 1;  // Skip the '@'
-
-  // Skip identifier
-  while (pos < css.size() && (std::isalnum(css[pos]) || css[pos] == '-')) {
-    ++pos;
-  }
-
-  // Look for { or ;
-  int braceDepth = 0;
-  while (pos < css.size()) {
-    const char c = css[pos];
-    if (c == '{') {
-      ++braceDepth;
-    } else if (c == '}') {
-      --braceDepth;
-      if (braceDepth == 0) {
-        return pos + 1;
-      }
-    } else if (c == ';' && braceDepth == 0) {
-      return pos + 1;
-    }
-    ++pos;
-  }
-  return css.size();
-}
-
-// Extract next rule from CSS content
-// Returns true if a rule was found, with selector and body filled
-bool extractNextRule(const std::string& css, size_t& pos, std::string& selector, std::string& body) {
-  selector.clear();
-  body.clear();
-
-  // Skip whitespace and @-rules until we find a regular rule
-  while (pos < css.size()) {
-    // Skip whitespace
-    while (pos < css.size() && isCssWhitespace(css[pos])) {
-      ++pos;
-    }
-
-    if (pos >= css.size()) return false;
-
-    // Handle @-rules iteratively (avoids recursion/stack overflow)
-    if (css[pos] == '@') {
-      pos = skipAtRule(css, pos);
-      continue;  // Try again after skipping the @-rule
-    }
-
-    break;  // Found start of a regular rule
-  }
-
-  if (pos >= css.size()) return false;
-
-  // Find opening brace
-  const size_t bracePos = css.find('{', pos);
-  if (bracePos == std::string::npos) return false;
-
-  // Extract selector (everything before the brace)
-  selector = css.substr(pos, bracePos - pos);
-
-  // Find matching closing brace
-  int depth = 1;
-  const size_t bodyStart = bracePos + 1;
-  size_t bodyEnd = bodyStart;
-
-  while (bodyEnd < css.size() && depth > 0) {
-    if (css[bodyEnd] == '{')
-      ++depth;
-    else if (css[bodyEnd] == '}')
-      --depth;
-    ++bodyEnd;
-  }
-
-  // Extract body (between braces)
-  if (bodyEnd > bodyStart) {
-    body = css.substr(bodyStart, bodyEnd - bodyStart - 1);
-  }
-
-  pos = bodyEnd;
-  return true;
-}
-
 }  // anonymous namespace
 
 // String utilities implementation
@@ -421,279 +305,647 @@ CssStyle CssParser::parseDeclarations(const std::string& declBlock) {
 
 // Rule processing
 
+bool CssParser::compoundKey(const char* compound, const size_t length, SelectorId& tagId, SelectorId& classId) {
+  // Only "tag", ".class" and "tag.class" can match, anything with an ID, an attribute, a pseudo-class, a sibling
+  // combinator or a second class is dropped
+  const char* dot = nullptr;
+  for (size_t i = 0; i < length; ++i) {
+    const char c = compound[i];
+    if (c == '#' || c == ':' || c == '[' || c == ']' || c == '*' || c == '(' || c == ')' || c == '+' || c == '~') {
+      return false;
+    }
+    if (c == '.') {
+      if (dot != nullptr) return false;
+      dot = compound + i;
+    }
+  }
+  if (length == 0 || dot == compound + length - 1) return false;
+
+  const size_t tagLength = dot != nullptr ? dot - compound : length;
+  tagId = tagLength > 0 ? selectorId(compound, tagLength) : 0;
+  classId = dot != nullptr ? selectorId(dot + 1, compound + length - dot - 1) : 0;
+  return true;
+}
+
+bool CssParser::addSelector(const std::string& selector, const CssStyle& style) {
+  // Split into parts at whitespace and '>', selectors are normalized so whitespace is single spaces
+  struct Part {
+    SelectorId tagId;
+    SelectorId classId;
+    bool child;  // The separator to the right was '>'
+  };
+  Part parts[MAX_SELECTOR_PARTS];
+  size_t partCount = 0;
+  size_t pos = 0;
+  while (pos < selector.size()) {
+    const size_t start = pos;
+    while (pos < selector.size() && selector[pos] != ' ' && selector[pos] != '>') ++pos;
+    if (partCount == MAX_SELECTOR_PARTS ||
+        !compoundKey(selector.data() + start, pos - start, parts[partCount].tagId, parts[partCount].classId)) {
+      return false;
+    }
+
+    bool child = false;
+    while (pos < selector.size() && (selector[pos] == ' ' || selector[pos] == '>')) {
+      if (selector[pos] == '>') {
+        if (child) return false;
+        child = true;
+      }
+      ++pos;
+    }
+    parts[partCount++].child = child;
+  }
+  if (partCount == 0 || parts[partCount - 1].child) return false;
+
+  Rule rule;
+  rule.key = static_cast<uint64_t>(parts[partCount - 1].tagId) << 32 | parts[partCount - 1].classId;
+  rule.order = nextOrder_++;
+  rule.specificity = 0;
+  rule.ancestorCount = static_cast<uint8_t>(partCount - 1);
+  rule.firstAncestor = static_cast<uint32_t>(ancestorParts_.size());
+  rule.style = style;
+  for (size_t i = partCount; i-- > 0;) {
+    rule.specificity += (parts[i].tagId != 0 ? 1 : 0) + (parts[i].classId != 0 ? 16 : 0);
+    if (i + 1 < partCount) {
+      ancestorParts_.push_back({parts[i].tagId, parts[i].classId, parts[i].child});
+    }
+  }
+  rules_.push_back(rule);
+  return true;
+}
+
 void CssParser::processRuleBlock(const std::string& selectorGroup, const std::string& declarations) {
   const CssStyle style = parseDeclarations(declarations);
 
   // Only store if any properties were set
   if (!style.defined.anySet()) return;
 
-  // Handle comma-separated selectors
+  // Handle comma-separated selectors (already normalized by splitOnChar)
   const auto selectors = splitOnChar(selectorGroup, ',');
 
   for (const auto& sel : selectors) {
-    // Normalize the selector
-    std::string key = normalized(sel);
-    if (key.empty()) continue;
-
-    // Store or merge with existing
-    auto it = rulesBySelector_.find(key);
-    if (it != rulesBySelector_.end()) {
-      it->second.applyOver(style);
-    } else {
-      rulesBySelector_[key] = style;
-    }
+    addSelector(sel, style);
   }
 }
 
+void CssParser::sortRules() {
+  // Rules of the same selector are kept apart, the cascade orders them among the others by appearance
+  std::sort(rules_.begin(), rules_.end(),
+            [](const Rule& a, const Rule& b) { return a.key < b.key || (a.key == b.key && a.order < b.order); });
+  rules_.shrink_to_fit();
+  ancestorParts_.shrink_to_fit();
+}
+
 // Main parsing entry point
 
-bool CssParser::loadFromStream(FsFile& source) {
-  if (!source) {
-    LOG_ERR("CSS", "Cannot read from invalid file");
-    return false;
+size_t CssParser::Loader::write(const uint8_t c) { return write(&c, 1); }
+
+size_t CssParser::Loader::write(const uint8_t* buffer, const size_t size) {
+  // Stylesheets are cut off at MAX_CSS_SIZE like they always were, the rest is accepted and dropped
+  for (size_t i = 0; i < size && bytesSeen < MAX_CSS_SIZE; ++i, ++bytesSeen) {
+    const char c = static_cast<char>(buffer[i]);
+
+    // Remove CSS comments (/* ... */), an unterminated one swallows the rest of the file
+    if (inComment) {
+      if (commentStar && c == '/') {
+        inComment = false;
+      }
+      commentStar = c == '*';
+      continue;
+    }
+    if (pendingSlash) {
+      pendingSlash = false;
+      if (c == '*') {
+        inComment = true;
+        commentStar = false;
+        continue;
+      }
+      consume('/');
+    }
+    if (c == '/') {
+      pendingSlash = true;
+      continue;
+    }
+    consume(c);
   }
+  return size;
+}
 
-  // Read file content
-  const std::string content = readFileContent(source);
-  if (content.empty()) {
-    return true;  // Empty file is valid
+void CssParser::Loader::consume(const char c) {
+  switch (state) {
+    case State::Selector:
+      // Skip whitespace before a rule, @-rules (like @media, @import, @font-face) are skipped whole
+      if (selector.empty() && isCssWhitespace(c)) return;
+      if (selector.empty() && c == '@') {
+        state = State::AtRule;
+        braceDepth = 0;
+        return;
+      }
+      if (c == '{') {
+        state = State::Body;
+        braceDepth = 1;
+        return;
+      }
+      selector.push_back(c);
+      return;
+
+    case State::Body:
+      if (c == '{') {
+        ++braceDepth;
+      } else if (c == '}' && --braceDepth == 0) {
+        parser.processRuleBlock(selector, body);
+        selector.clear();
+        body.clear();
+        state = State::Selector;
+        return;
+      }
+      body.push_back(c);
+      return;
+
+    case State::AtRule:
+      // Ends at a semicolon (simple @-rule) or the brace matching its block
+      if (c == '{') {
+        ++braceDepth;
+      } else if (c == '}') {
+        if (--braceDepth == 0) state = State::Selector;
+      } else if (c == ';' && braceDepth == 0) {
+        state = State::Selector;
+      }
+      return;
   }
+}
 
-  // Remove comments
-  const std::string cleaned = stripComments(content);
+void CssParser::Loader::finish() {
+  if (pendingSlash) {
+    pendingSlash = false;
+    consume('/');
+  }
+  // A rule cut off by the end of the file still counts, a selector without a body doesn't
+  if (state == State::Body) {
+    parser.processRuleBlock(selector, body);
+  }
+  selector.clear();
+  selector.shrink_to_fit();
+  body.clear();
+  body.shrink_to_fit();
+  state = State::Selector;
+  parser.sortRules();
 
-  // Parse rules
-  size_t pos = 0;
-  std::string selector, body;
+  LOG_DBG("CSS", "Parsed %zu rules", parser.rules_.size());
+}
 
-  while (extractNextRule(cleaned, pos, selector, body)) {
-    processRuleBlock(selector, body);
+bool CssParser::loadFromStream(HalFile& source) {
+  if (!source) {
+    LOG_ERR("CSS", "Cannot read from invalid file");
+    return false;
   }
 
-  LOG_DBG("CSS", "Parsed %zu rules", rulesBySelector_.size());
+  Loader loader(*this);
+  uint8_t buffer[READ_BUFFER_SIZE];
+  while (source.available()) {
+    const int bytesRead = source.read(buffer, sizeof(buffer));
+    if (bytesRead <= 0) break;
+    loader.write(buffer, bytesRead);
+  }
+  loader.finish();
   return true;
 }
 
 // Style resolution
 
-CssStyle CssParser::resolveStyle(const std::string& tagName, const std::string& classAttr) const {
-  CssStyle result;
-  const std::string tag = normalized(tagName);
+CssParser::SelectorId CssParser::selectorId(const char* name, const size_t length) {
+  // FNV-1a over the lowercased name
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; ++i) {
+    char c = name[i];
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+CssParser::SelectorId CssParser::selectorId(const char* name) { return selectorId(name, strlen(name)); }
 
-  // 1. Apply element-level style (lowest priority)
-  const auto tagIt = rulesBySelector_.find(tag);
-  if (tagIt != rulesBySelector_.end()) {
-    result.applyOver(tagIt->second);
+size_t CssParser::classIds(const char* classAttr, SelectorId (&out)[MAX_CLASSES]) {
+  size_t count = 0;
+  if (classAttr == nullptr) return 0;
+
+  const char* p = classAttr;
+  while (*p && count < MAX_CLASSES) {
+    while (isCssWhitespace(*p)) ++p;
+    const char* start = p;
+    while (*p && !isCssWhitespace(*p)) ++p;
+    if (p > start) {
+      out[count++] = selectorId(start, p - start);
+    }
   }
+  return count;
+}
 
-  // 2. Apply class styles (medium priority)
-  if (!classAttr.empty()) {
-    const auto classes = splitWhitespace(classAttr);
+bool CssParser::matchesAncestors(const AncestorPart* parts, const size_t partCount, const CssAncestors& ancestors,
+                                 const size_t below) {
+  if (partCount == 0) return true;
+
+  // Right to left: find an element below `below` for the nearest part, then the remaining parts above it
+  const AncestorPart& part = parts[0];
+  for (size_t i = below; i-- > 0;) {
+    const CssAncestors::Element& element = ancestors[i];
+    bool matched = part.tagId == 0 || element.tagId == part.tagId;
+    if (matched && part.classId != 0) {
+      matched = std::find(element.classIds, element.classIds + element.classCount, part.classId) !=
+                element.classIds + element.classCount;
+    }
+    if (matched && matchesAncestors(parts + 1, partCount - 1, ancestors, i)) return true;
+    if (part.child) return false;
+  }
+  return false;
+}
 
-    for (const auto& cls : classes) {
-      std::string classKey = "." + normalized(cls);
+void CssParser::collectMatches(const uint64_t key, const CssAncestors* ancestors, Match* matches,
+                               size_t& matchCount) const {
+  if (cacheFile_) {
+    if (const CachedSelector* selector = cachedSelector(key)) {
+      collectMatches(selector->rules.data(), selector->rules.data() + selector->rules.size(),
+                     selector->ancestorParts.data(), ancestors, matches, matchCount);
+    }
+    return;
+  }
+
+  const Rule* first = std::lower_bound(rules_.data(), rules_.data() + rules_.size(), key,
+                                       [](const Rule& rule, const uint64_t value) { return rule.key < value; });
+  const Rule* last = first;
+  while (last != rules_.data() + rules_.size() && last->key == key) {
+    ++last;
+  }
+  collectMatches(first, last, ancestorParts_.data(), ancestors, matches, matchCount);
+}
 
-      auto classIt = rulesBySelector_.find(classKey);
-      if (classIt != rulesBySelector_.end()) {
-        result.applyOver(classIt->second);
+void CssParser::collectMatches(const Rule* first, const Rule* last, const AncestorPart* ancestorParts,
+                               const CssAncestors* ancestors, Match* matches, size_t& matchCount) {
+  for (const Rule* it = first; it != last; ++it) {
+    if (it->ancestorCount > 0) {
+      if (ancestors == nullptr || !ancestors->complete()) continue;
+
+      // Reject on the bloom filter first, most rules name an ancestor that isn't open
+      const AncestorPart* parts = ancestorParts + it->firstAncestor;
+      bool possible = true;
+      for (uint8_t i = 0; i < it->ancestorCount && possible; ++i) {
+        possible = (parts[i].tagId == 0 || ancestors->mayContain(parts[i].tagId)) &&
+                   (parts[i].classId == 0 || ancestors->mayContain(parts[i].classId));
       }
+      if (!possible || !matchesAncestors(parts, it->ancestorCount, *ancestors, ancestors->size())) continue;
     }
+    const Match match = {static_cast<uint32_t>(it->specificity) << 24 | it->order, &it->style};
+    if (matchCount < MAX_MATCHES) {
+      matches[matchCount++] = match;
+      continue;
+    }
+    // Full: the lowest ranked match is the one the cascade overrides the most, a higher ranked one replaces it
+    Match* lowest = std::min_element(matches, matches + matchCount,
+                                     [](const Match& a, const Match& b) { return a.rank < b.rank; });
+    if (lowest->rank < match.rank) {
+      *lowest = match;
+    }
+  }
+}
 
-    // 3. Apply element.class styles (higher priority)
-    for (const auto& cls : classes) {
-      std::string combinedKey = tag + "." + normalized(cls);
+CssStyle CssParser::resolveStyle(const SelectorId tagId, const SelectorId* classIds, const size_t classCount,
+                                 const CssAncestors* ancestors) const {
+  CssStyle result;
+  if (empty()) return result;
+
+  // Rules for the element, each class and each element.class
+  Match matches[MAX_MATCHES];
+  size_t matchCount = 0;
+  collectMatches(static_cast<uint64_t>(tagId) << 32, ancestors, matches, matchCount);
+  for (size_t i = 0; i < classCount; ++i) {
+    collectMatches(classIds[i], ancestors, matches, matchCount);
+    collectMatches(static_cast<uint64_t>(tagId) << 32 | classIds[i], ancestors, matches, matchCount);
+  }
 
-      auto combinedIt = rulesBySelector_.find(combinedKey);
-      if (combinedIt != rulesBySelector_.end()) {
-        result.applyOver(combinedIt->second);
-      }
+  // Apply in cascade order, lowest specificity and earliest rule first. Insertion sort, there are only a few.
+  for (size_t i = 1; i < matchCount; ++i) {
+    const Match match = matches[i];
+    size_t j = i;
+    for (; j > 0 && matches[j - 1].rank > match.rank; --j) {
+      matches[j] = matches[j - 1];
     }
+    matches[j] = match;
+  }
+  for (size_t i = 0; i < matchCount; ++i) {
+    result.applyOver(*matches[i].style);
   }
 
   return result;
 }
 
+CssStyle CssParser::resolveStyle(const char* tagName, const char* classAttr) const {
+  SelectorId ids[MAX_CLASSES];
+  const size_t classCount = classIds(classAttr, ids);
+  return resolveStyle(selectorId(tagName), ids, classCount);
+}
+
 // Inline style parsing (static - doesn't need rule database)
 
 CssStyle CssParser::parseInlineStyle(const std::string& styleValue) { return parseDeclarations(styleValue); }
 
-// Cache serialization
+// Rule cache
+
+namespace {
 
 // Cache format version - increment when format changes
-constexpr uint8_t CSS_CACHE_VERSION = 2;
+constexpr uint8_t CSS_CACHE_VERSION = 5;
+
+// Version, rule count, key count and flags. Followed by the sorted selector keys, the file offset of each key's
+// rules plus the end of the last key's, then the rules of each key in cascade order.
+constexpr size_t CACHE_HEADER_SIZE = 1 + 4 + 4 + 1;
+constexpr uint8_t CACHE_HAS_ANCESTOR_SELECTORS = 1 << 0;
+
+// A rule is its order, specificity and ancestor part count, the ancestor parts, then its style
+constexpr size_t RULE_HEAD_SIZE = 4 + 2 + 1;
+constexpr size_t ANCESTOR_PART_SIZE = 4 + 4 + 1;
+constexpr size_t STYLE_SIZE = 4 + 9 * (4 + 1) + 2;
+constexpr size_t MAX_RULE_BODY_SIZE = (CssParser::MAX_SELECTOR_PARTS - 1) * ANCESTOR_PART_SIZE + STYLE_SIZE;
+
+template <typename T>
+uint8_t* put(uint8_t* out, const T& value) {
+  memcpy(out, &value, sizeof(T));
+  return out + sizeof(T);
+}
+
+template <typename T>
+const uint8_t* take(const uint8_t* in, T& value) {
+  memcpy(&value, in, sizeof(T));
+  return in + sizeof(T);
+}
+
+uint8_t* putStyle(uint8_t* out, const CssStyle& style) {
+  *out++ = static_cast<uint8_t>(style.textAlign);
+  *out++ = static_cast<uint8_t>(style.fontStyle);
+  *out++ = static_cast<uint8_t>(style.fontWeight);
+  *out++ = static_cast<uint8_t>(style.textDecoration);
+
+  for (const CssLength* length : {&style.textIndent, &style.marginTop, &style.marginBottom, &style.marginLeft,
+                                  &style.marginRight, &style.paddingTop, &style.paddingBottom, &style.paddingLeft,
+                                  &style.paddingRight}) {
+    out = put(out, length->value);
+    *out++ = static_cast<uint8_t>(length->unit);
+  }
+
+  uint16_t definedBits = 0;
+  if (style.defined.textAlign) definedBits |= 1 << 0;
+  if (style.defined.fontStyle) definedBits |= 1 << 1;
+  if (style.defined.fontWeight) definedBits |= 1 << 2;
+  if (style.defined.textDecoration) definedBits |= 1 << 3;
+  if (style.defined.textIndent) definedBits |= 1 << 4;
+  if (style.defined.marginTop) definedBits |= 1 << 5;
+  if (style.defined.marginBottom) definedBits |= 1 << 6;
+  if (style.defined.marginLeft) definedBits |= 1 << 7;
+  if (style.defined.marginRight) definedBits |= 1 << 8;
+  if (style.defined.paddingTop) definedBits |= 1 << 9;
+  if (style.defined.paddingBottom) definedBits |= 1 << 10;
+  if (style.defined.paddingLeft) definedBits |= 1 << 11;
+  if (style.defined.paddingRight) definedBits |= 1 << 12;
+  return put(out, definedBits);
+}
+
+const uint8_t* takeStyle(const uint8_t* in, CssStyle& style) {
+  style.textAlign = static_cast<CssTextAlign>(*in++);
+  style.fontStyle = static_cast<CssFontStyle>(*in++);
+  style.fontWeight = static_cast<CssFontWeight>(*in++);
+  style.textDecoration = static_cast<CssTextDecoration>(*in++);
+
+  for (CssLength* length : {&style.textIndent, &style.marginTop, &style.marginBottom, &style.marginLeft,
+                            &style.marginRight, &style.paddingTop, &style.paddingBottom, &style.paddingLeft,
+                            &style.paddingRight}) {
+    in = take(in, length->value);
+    length->unit = static_cast<CssUnit>(*in++);
+  }
+
+  uint16_t definedBits = 0;
+  in = take(in, definedBits);
+  style.defined.textAlign = (definedBits & 1 << 0) != 0;
+  style.defined.fontStyle = (definedBits & 1 << 1) != 0;
+  style.defined.fontWeight = (definedBits & 1 << 2) != 0;
+  style.defined.textDecoration = (definedBits & 1 << 3) != 0;
+  style.defined.textIndent = (definedBits & 1 << 4) != 0;
+  style.defined.marginTop = (definedBits & 1 << 5) != 0;
+  style.defined.marginBottom = (definedBits & 1 << 6) != 0;
+  style.defined.marginLeft = (definedBits & 1 << 7) != 0;
+  style.defined.marginRight = (definedBits & 1 << 8) != 0;
+  style.defined.paddingTop = (definedBits & 1 << 9) != 0;
+  style.defined.paddingBottom = (definedBits & 1 << 10) != 0;
+  style.defined.paddingLeft = (definedBits & 1 << 11) != 0;
+  style.defined.paddingRight = (definedBits & 1 << 12) != 0;
+  return in;
+}
 
-bool CssParser::saveToCache(FsFile& file) const {
+}  // anonymous namespace
+
+// One element looks up its tag, each class and each tag.class, all of them have to stay cached while it is resolved
+static_assert(CssParser::CACHED_SELECTORS > 1 + 2 * CssParser::MAX_CLASSES, "rule cache too small for one element");
+
+void CssParser::clear() {
+  rules_.clear();
+  rules_.shrink_to_fit();
+  ancestorParts_.clear();
+  ancestorParts_.shrink_to_fit();
+  nextOrder_ = 0;
+
+  cacheFile_.close();
+  cacheKeys_.clear();
+  cacheKeys_.shrink_to_fit();
+  cacheOffsets_.clear();
+  cacheOffsets_.shrink_to_fit();
+  cacheRuleCount_ = 0;
+  cacheAncestorSelectors_ = false;
+  for (auto& selector : cachedSelectors_) {
+    selector = CachedSelector();
+  }
+  cacheUseCounter_ = 0;
+}
+
+bool CssParser::saveToCache(HalFile& file) const {
   if (!file) {
     return false;
   }
 
-  // Write version
-  file.write(CSS_CACHE_VERSION);
-
-  // Write rule count
-  const auto ruleCount = static_cast<uint16_t>(rulesBySelector_.size());
-  file.write(reinterpret_cast<const uint8_t*>(&ruleCount), sizeof(ruleCount));
-
-  // Write each rule: selector string + CssStyle fields
-  for (const auto& pair : rulesBySelector_) {
-    // Write selector string (length-prefixed)
-    const auto selectorLen = static_cast<uint16_t>(pair.first.size());
-    file.write(reinterpret_cast<const uint8_t*>(&selectorLen), sizeof(selectorLen));
-    file.write(reinterpret_cast<const uint8_t*>(pair.first.data()), selectorLen);
-
-    // Write CssStyle fields (all are POD types)
-    const CssStyle& style = pair.second;
-    file.write(static_cast<uint8_t>(style.textAlign));
-    file.write(static_cast<uint8_t>(style.fontStyle));
-    file.write(static_cast<uint8_t>(style.fontWeight));
-    file.write(static_cast<uint8_t>(style.textDecoration));
-
-    // Write CssLength fields (value + unit)
-    auto writeLength = [&file](const CssLength& len) {
-      file.write(reinterpret_cast<const uint8_t*>(&len.value), sizeof(len.value));
-      file.write(static_cast<uint8_t>(len.unit));
-    };
-
-    writeLength(style.textIndent);
-    writeLength(style.marginTop);
-    writeLength(style.marginBottom);
-    writeLength(style.marginLeft);
-    writeLength(style.marginRight);
-    writeLength(style.paddingTop);
-    writeLength(style.paddingBottom);
-    writeLength(style.paddingLeft);
-    writeLength(style.paddingRight);
-
-    // Write defined flags as uint16_t
-    uint16_t definedBits = 0;
-    if (style.defined.textAlign) definedBits |= 1 << 0;
-    if (style.defined.fontStyle) definedBits |= 1 << 1;
-    if (style.defined.fontWeight) definedBits |= 1 << 2;
-    if (style.defined.textDecoration) definedBits |= 1 << 3;
-    if (style.defined.textIndent) definedBits |= 1 << 4;
-    if (style.defined.marginTop) definedBits |= 1 << 5;
-    if (style.defined.marginBottom) definedBits |= 1 << 6;
-    if (style.defined.marginLeft) definedBits |= 1 << 7;
-    if (style.defined.marginRight) definedBits |= 1 << 8;
-    if (style.defined.paddingTop) definedBits |= 1 << 9;
-    if (style.defined.paddingBottom) definedBits |= 1 << 10;
-    if (style.defined.paddingLeft) definedBits |= 1 << 11;
-    if (style.defined.paddingRight) definedBits |= 1 << 12;
-    file.write(reinterpret_cast<const uint8_t*>(&definedBits), sizeof(definedBits));
-  }
-
-  LOG_DBG("CSS", "Saved %u rules to cache", ruleCount);
+  // Index every distinct key with the offset of its first rule, rules_ is sorted by key
+  uint32_t keyCount = 0;
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    if (i == 0 || rules_[i].key != rules_[i - 1].key) keyCount++;
+  }
+  std::vector<uint64_t> keys;
+  std::vector<uint32_t> offsets;
+  keys.reserve(keyCount);
+  offsets.reserve(keyCount + 1);
+  uint32_t offset = CACHE_HEADER_SIZE + keyCount * (sizeof(uint64_t) + sizeof(uint32_t)) + sizeof(uint32_t);
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    if (i == 0 || rules_[i].key != rules_[i - 1].key) {
+      keys.push_back(rules_[i].key);
+      offsets.push_back(offset);
+    }
+    offset += RULE_HEAD_SIZE + rules_[i].ancestorCount * ANCESTOR_PART_SIZE + STYLE_SIZE;
+  }
+  offsets.push_back(offset);
+
+  size_t written = file.write(CSS_CACHE_VERSION);
+  const auto ruleCount = static_cast<uint32_t>(rules_.size());
+  written += file.write(reinterpret_cast<const uint8_t*>(&ruleCount), sizeof(ruleCount));
+  written += file.write(reinterpret_cast<const uint8_t*>(&keyCount), sizeof(keyCount));
+  written += file.write(static_cast<uint8_t>(hasAncestorSelectors() ? CACHE_HAS_ANCESTOR_SELECTORS : 0));
+  written += file.write(reinterpret_cast<const uint8_t*>(keys.data()), keys.size() * sizeof(uint64_t));
+  written += file.write(reinterpret_cast<const uint8_t*>(offsets.data()), offsets.size() * sizeof(uint32_t));
+
+  uint8_t record[RULE_HEAD_SIZE + MAX_RULE_BODY_SIZE];
+  for (const Rule& rule : rules_) {
+    uint8_t* out = put(record, rule.order);
+    out = put(out, rule.specificity);
+    out = put(out, rule.ancestorCount);
+    for (uint8_t j = 0; j < rule.ancestorCount; ++j) {
+      const AncestorPart& part = ancestorParts_[rule.firstAncestor + j];
+      out = put(out, part.tagId);
+      out = put(out, part.classId);
+      *out++ = static_cast<uint8_t>(part.child);
+    }
+    out = putStyle(out, rule.style);
+    written += file.write(record, out - record);
+  }
+
+  if (written != offset) {
+    LOG_ERR("CSS", "Failed to write rule cache");
+    return false;
+  }
+  LOG_DBG("CSS", "Saved %lu rules under %lu selector keys to cache", static_cast<unsigned long>(ruleCount),
+          static_cast<unsigned long>(keyCount));
   return true;
 }
 
-bool CssParser::loadFromCache(FsFile& file) {
-  if (!file) {
+bool CssParser::loadFromCache(const std::string& path) {
+  HalFile file;
+  if (!Storage.openFileForRead("CSS", path, file)) {
     return false;
   }
 
-  // Clear existing rules
-  clear();
-
   // Read and verify version
   uint8_t version = 0;
   if (file.read(&version, 1) != 1 || version != CSS_CACHE_VERSION) {
     LOG_DBG("CSS", "Cache version mismatch (got %u, expected %u)", version, CSS_CACHE_VERSION);
+    file.close();
     return false;
   }
 
-  // Read rule count
-  uint16_t ruleCount = 0;
-  if (file.read(&ruleCount, sizeof(ruleCount)) != sizeof(ruleCount)) {
+  uint32_t ruleCount = 0;
+  uint32_t keyCount = 0;
+  uint8_t flags = 0;
+  if (file.read(&ruleCount, sizeof(ruleCount)) != sizeof(ruleCount) ||
+      file.read(&keyCount, sizeof(keyCount)) != sizeof(keyCount) || file.read(&flags, 1) != 1 ||
+      keyCount > ruleCount) {
+    file.close();
     return false;
   }
 
-  // Read each rule
-  for (uint16_t i = 0; i < ruleCount; ++i) {
-    // Read selector string
-    uint16_t selectorLen = 0;
-    if (file.read(&selectorLen, sizeof(selectorLen)) != sizeof(selectorLen)) {
-      rulesBySelector_.clear();
-      return false;
-    }
+  std::vector<uint64_t> keys(keyCount);
+  std::vector<uint32_t> offsets(keyCount + 1);
+  const int keyBytes = static_cast<int>(keys.size() * sizeof(uint64_t));
+  const int offsetBytes = static_cast<int>(offsets.size() * sizeof(uint32_t));
+  // The keys have to be sorted and their rules have to tile the rest of the file, so lookups never read past it
+  bool valid = file.read(keys.data(), keyBytes) == keyBytes && file.read(offsets.data(), offsetBytes) == offsetBytes &&
+               offsets[0] == CACHE_HEADER_SIZE + static_cast<size_t>(keyBytes + offsetBytes) &&
+               offsets[keyCount] == file.size();
+  for (uint32_t i = 0; i < keyCount && valid; ++i) {
+    valid = offsets[i] + RULE_HEAD_SIZE + STYLE_SIZE <= offsets[i + 1] && (i == 0 || keys[i - 1] < keys[i]);
+  }
+  if (!valid) {
+    LOG_ERR("CSS", "Invalid rule cache: %s", path.c_str());
+    file.close();
+    return false;
+  }
 
-    std::string selector;
-    selector.resize(selectorLen);
-    if (file.read(&selector[0], selectorLen) != selectorLen) {
-      rulesBySelector_.clear();
-      return false;
-    }
+  clear();
+  // Nothing will be read from a cache without rules
+  if (keyCount > 0) {
+    cacheFile_ = file;
+  } else {
+    file.close();
+  }
+  cacheKeys_ = std::move(keys);
+  cacheOffsets_ = std::move(offsets);
+  cacheRuleCount_ = ruleCount;
+  cacheAncestorSelectors_ = (flags & CACHE_HAS_ANCESTOR_SELECTORS) != 0;
 
-    // Read CssStyle fields
-    CssStyle style;
-    uint8_t enumVal;
+  LOG_DBG("CSS", "Opened rule cache, %lu rules under %lu selector keys", static_cast<unsigned long>(ruleCount),
+          static_cast<unsigned long>(keyCount));
+  return true;
+}
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
-      return false;
-    }
-    style.textAlign = static_cast<CssTextAlign>(enumVal);
+const CssParser::CachedSelector* CssParser::cachedSelector(const uint64_t key) const {
+  const auto it = std::lower_bound(cacheKeys_.begin(), cacheKeys_.end(), key);
+  if (it == cacheKeys_.end() || *it != key) {
+    return nullptr;
+  }
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
-      return false;
+  CachedSelector* victim = &cachedSelectors_[0];
+  for (auto& selector : cachedSelectors_) {
+    if (selector.lastUse != 0 && selector.key == key) {
+      selector.lastUse = ++cacheUseCounter_;
+      return &selector;
     }
-    style.fontStyle = static_cast<CssFontStyle>(enumVal);
-
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
-      return false;
+    if (selector.lastUse < victim->lastUse) {
+      victim = &selector;
     }
-    style.fontWeight = static_cast<CssFontWeight>(enumVal);
+  }
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
-      return false;
-    }
-    style.textDecoration = static_cast<CssTextDecoration>(enumVal);
+  const size_t index = it - cacheKeys_.begin();
+  victim->key = key;
+  victim->lastUse = ++cacheUseCounter_;
+  victim->rules.clear();
+  victim->ancestorParts.clear();
+  if (!readCachedRules(cacheOffsets_[index], cacheOffsets_[index + 1], *victim)) {
+    // Left cached without rules, so a damaged entry is read and reported only once
+    LOG_ERR("CSS", "Failed to read cached rules at %lu", static_cast<unsigned long>(cacheOffsets_[index]));
+    victim->rules.clear();
+    victim->ancestorParts.clear();
+  }
+  return victim;
+}
 
-    // Read CssLength fields
-    auto readLength = [&file](CssLength& len) -> bool {
-      if (file.read(&len.value, sizeof(len.value)) != sizeof(len.value)) {
-        return false;
-      }
-      uint8_t unitVal;
-      if (file.read(&unitVal, 1) != 1) {
-        return false;
-      }
-      len.unit = static_cast<CssUnit>(unitVal);
-      return true;
-    };
-
-    if (!readLength(style.textIndent) || !readLength(style.marginTop) || !readLength(style.marginBottom) ||
-        !readLength(style.marginLeft) || !readLength(style.marginRight) || !readLength(style.paddingTop) ||
-        !readLength(style.paddingBottom) || !readLength(style.paddingLeft) || !readLength(style.paddingRight)) {
-      rulesBySelector_.clear();
+bool CssParser::readCachedRules(uint32_t offset, const uint32_t end, CachedSelector& selector) const {
+  if (!cacheFile_.seekSet(offset)) {
+    return false;
+  }
+
+  // Rules without ancestor parts are the smallest, reserving for that many keeps the vector from doubling past it
+  selector.rules.reserve((end - offset) / (RULE_HEAD_SIZE + STYLE_SIZE));
+  uint8_t record[MAX_RULE_BODY_SIZE];
+  while (offset < end) {
+    Rule rule;
+    rule.key = selector.key;
+    if (end - offset < RULE_HEAD_SIZE || cacheFile_.read(record, RULE_HEAD_SIZE) != static_cast<int>(RULE_HEAD_SIZE)) {
       return false;
     }
+    const uint8_t* in = take(record, rule.order);
+    in = take(in, rule.specificity);
+    take(in, rule.ancestorCount);
 
-    // Read defined flags
-    uint16_t definedBits = 0;
-    if (file.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
-      rulesBySelector_.clear();
+    const size_t bodySize = rule.ancestorCount * ANCESTOR_PART_SIZE + STYLE_SIZE;
+    if (rule.ancestorCount >= MAX_SELECTOR_PARTS || end - offset - RULE_HEAD_SIZE < bodySize ||
+        cacheFile_.read(record, bodySize) != static_cast<int>(bodySize)) {
       return false;
     }
-    style.defined.textAlign = (definedBits & 1 << 0) != 0;
-    style.defined.fontStyle = (definedBits & 1 << 1) != 0;
-    style.defined.fontWeight = (definedBits & 1 << 2) != 0;
-    style.defined.textDecoration = (definedBits & 1 << 3) != 0;
-    style.defined.textIndent = (definedBits & 1 << 4) != 0;
-    style.defined.marginTop = (definedBits & 1 << 5) != 0;
-    style.defined.marginBottom = (definedBits & 1 << 6) != 0;
-    style.defined.marginLeft = (definedBits & 1 << 7) != 0;
-    style.defined.marginRight = (definedBits & 1 << 8) != 0;
-    style.defined.paddingTop = (definedBits & 1 << 9) != 0;
-    style.defined.paddingBottom = (definedBits & 1 << 10) != 0;
-    style.defined.paddingLeft = (definedBits & 1 << 11) != 0;
-    style.defined.paddingRight = (definedBits & 1 << 12) != 0;
-
-    rulesBySelector_[selector] = style;
-  }
-
-  LOG_DBG("CSS", "Loaded %u rules from cache", ruleCount);
+    in = record;
+    rule.firstAncestor = static_cast<uint32_t>(selector.ancestorParts.size());
+    for (uint8_t j = 0; j < rule.ancestorCount; ++j) {
+      AncestorPart part{};
+      in = take(in, part.tagId);
+      in = take(in, part.classId);
+      part.child = *in++ != 0;
+      selector.ancestorParts.push_back(part);
+    }
+    takeStyle(in, rule.style);
+    selector.rules.push_back(rule);
+    offset += RULE_HEAD_SIZE + bodySize;
+  }
   return true;
 }
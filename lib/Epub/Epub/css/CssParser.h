@@ -1,34 +1,94 @@
 #pragma once
 
 #include <HalStorage.h>
+#include <Print.h>
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "CssStyle.h"
 
+class CssAncestors;
+
 /**
  * Lightweight CSS parser for EPUB stylesheets
  *
  * Parses CSS files and extracts styling information relevant for e-ink display.
- * Uses a two-phase approach: first tokenizes the CSS content, then builds
- * a rule database that can be queried during HTML parsing.
+ * Uses a two-phase approach: first tokenizes the CSS content as it streams in
+ * (see Loader), then builds a rule database that can be queried during HTML
+ * parsing.
+ *
+ * Tag and class names are interned into 32-bit ids (see selectorId()) when the
+ * stylesheets are loaded and rules are kept in an array sorted by the rightmost
+ * part of their selector, so resolving the style of an element is a few binary
+ * searches and never allocates. Matching rules are applied in order of
+ * specificity, then of appearance.
+ *
+ * Once saved, the rules don't have to be held in memory: loadFromCache() only
+ * reads the cache's index of selector keys and fetches the rules of a key from
+ * the file the first time an element needs them, keeping the most recently
+ * used ones (see CACHED_SELECTORS). Resolving styles then touches mutable
+ * cache state, so a parser must not be shared between threads.
  *
  * Supported selectors:
  *   - Element selectors: p, div, h1, etc.
  *   - Class selectors: .classname
  *   - Combined: element.classname
+ *   - Descendant and child: div.chapter p, blockquote > p (up to MAX_SELECTOR_PARTS
+ *     of the above, matched right to left against a CssAncestors stack)
  *   - Grouped: selector1, selector2 { }
  *
  * Not supported (silently ignored):
- *   - Descendant/child selectors
+ *   - ID, attribute and universal selectors, more than one class per selector
+ *   - Sibling combinators (+, ~)
  *   - Pseudo-classes and pseudo-elements
  *   - Media queries (content is skipped)
  *   - @import, @font-face, etc.
  */
 class CssParser {
  public:
+  // Interned tag or class name, 0 stands for none
+  using SelectorId = uint32_t;
+
+  // Classes of an element beyond this many don't take part in style resolution
+  static constexpr size_t MAX_CLASSES = 8;
+  // Longest descendant/child selector that is kept, counting the element itself
+  static constexpr size_t MAX_SELECTOR_PARTS = 4;
+  // Selector keys whose rules are kept in memory when reading rules from a cache file
+  static constexpr size_t CACHED_SELECTORS = 32;
+
+  /**
+   * Feeds one stylesheet into a CssParser. Bytes can be written in chunks of any size, e.g. straight out of a ZIP
+   * entry by ZipFile::readFileToStream, and each rule is added once its closing brace arrives, so only the rule
+   * being read is buffered. Call finish() after the last byte.
+   */
+  class Loader final : public Print {
+   public:
+    explicit Loader(CssParser& parser) : parser(parser) {}
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+    // Makes the rules of the stylesheet available for style resolution
+    void finish();
+
+   private:
+    enum class State : uint8_t { Selector, Body, AtRule };
+
+    void consume(char c);
+
+    CssParser& parser;
+    std::string selector;
+    std::string body;
+    size_t bytesSeen = 0;
+    int braceDepth = 0;
+    State state = State::Selector;
+    bool pendingSlash = false;  // Held back until the next byte shows whether it opens a comment
+    bool inComment = false;
+    bool commentStar = false;  // Inside a comment, the last byte was '*'
+  };
+
   CssParser() = default;
   ~CssParser() = default;
 
@@ -42,17 +102,44 @@ class CssParser {
    * @param source Open file handle to read from
    * @return true if parsing completed (even if no rules found)
    */
-  bool loadFromStream(FsFile& source);
+  bool loadFromStream(HalFile& source);
 
   /**
-   * Look up the style for an HTML element, considering tag name and class attributes.
-   * Applies CSS cascade: element style < class style < element.class style
+   * Intern a tag or class name. Case-insensitive, like the selectors it is matched against.
+   * @param name Name without the leading '.' of a class selector
+   * @param length Length of the name in bytes
+   * @return Id of the name, never 0
+   */
+  [[nodiscard]] static SelectorId selectorId(const char* name, size_t length);
+  [[nodiscard]] static SelectorId selectorId(const char* name);
+
+  /**
+   * Intern the space-separated classes of a class attribute.
+   * @param classAttr The class attribute value, may be nullptr
+   * @param out Receives up to MAX_CLASSES ids
+   * @return Number of ids written to out
+   */
+  static size_t classIds(const char* classAttr, SelectorId (&out)[MAX_CLASSES]);
+
+  /**
+   * Look up the style for an HTML element, considering tag name, class attributes and ancestors.
+   * Applies CSS cascade: rules of higher specificity (classes, then tags) win, later rules win ties
    *
+   * @param tagId Id of the HTML element name (e.g., "p", "div")
+   * @param classIds Ids of the element's classes
+   * @param classCount Number of entries in classIds
+   * @param ancestors Open elements around this one, nullptr matches no descendant/child selector
+   * @return Combined style with all applicable rules merged
+   */
+  [[nodiscard]] CssStyle resolveStyle(SelectorId tagId, const SelectorId* classIds, size_t classCount,
+                                      const CssAncestors* ancestors = nullptr) const;
+
+  /**
+   * Convenience overload of resolveStyle() that interns the names itself.
    * @param tagName The HTML element name (e.g., "p", "div")
    * @param classAttr The class attribute value (may contain multiple space-separated classes)
-   * @return Combined style with all applicable rules merged
    */
-  [[nodiscard]] CssStyle resolveStyle(const std::string& tagName, const std::string& classAttr) const;
+  [[nodiscard]] CssStyle resolveStyle(const char* tagName, const char* classAttr) const;
 
   /**
    * Parse an inline style attribute string.
@@ -61,42 +148,104 @@ class CssParser {
    */
   [[nodiscard]] static CssStyle parseInlineStyle(const std::string& styleValue);
 
+  /**
+   * Check if any descendant or child selectors have been loaded, only then are ancestors worth tracking
+   */
+  [[nodiscard]] bool hasAncestorSelectors() const { return cacheAncestorSelectors_ || !ancestorParts_.empty(); }
+
   /**
    * Check if any rules have been loaded
    */
-  [[nodiscard]] bool empty() const { return rulesBySelector_.empty(); }
+  [[nodiscard]] bool empty() const { return ruleCount() == 0; }
 
   /**
    * Get count of loaded rule sets
    */
-  [[nodiscard]] size_t ruleCount() const { return rulesBySelector_.size(); }
+  [[nodiscard]] size_t ruleCount() const { return rules_.size() + cacheRuleCount_; }
 
   /**
-   * Clear all loaded rules
+   * Clear all loaded rules and close the cache file
    */
-  void clear() { rulesBySelector_.clear(); }
+  void clear();
 
   /**
-   * Save parsed CSS rules to a cache file.
+   * Save CSS rules parsed from stylesheets to a cache file.
    * @param file Open file handle to write to
    * @return true if cache was written successfully
    */
-  bool saveToCache(FsFile& file) const;
+  bool saveToCache(HalFile& file) const;
 
   /**
-   * Load CSS rules from a cache file.
-   * Clears any existing rules before loading.
-   * @param file Open file handle to read from
-   * @return true if cache was loaded successfully
+   * Use the CSS rules of a cache file written by saveToCache().
+   * Only the index of the file is read, rules are read on first use, so the file stays open until clear().
+   * Replaces any existing rules.
+   * @param path Path of the cache file
+   * @return true if the cache is valid, the parser is left as it was otherwise
    */
-  bool loadFromCache(FsFile& file);
+  bool loadFromCache(const std::string& path);
 
  private:
-  // Storage: maps normalized selector -> style properties
-  std::unordered_map<std::string, CssStyle> rulesBySelector_;
+  // A part of a descendant or child selector left of the element it styles
+  struct AncestorPart {
+    SelectorId tagId;
+    SelectorId classId;
+    bool child;  // Has to be the parent of the part to its right rather than any ancestor
+  };
+
+  // A rule for one selector. The key is the tag id in the upper and the class id in the lower 32 bits of the
+  // selector's rightmost part, either can be 0 for parts without a tag or without a class.
+  struct Rule {
+    uint64_t key;
+    uint32_t order;          // Position in the stylesheets
+    uint16_t specificity;    // 16 per class plus 1 per tag
+    uint8_t ancestorCount;   // Parts left of the rightmost one, 0 for simple selectors
+    uint32_t firstAncestor;  // Their index in ancestorParts_, nearest first
+    CssStyle style;
+  };
+
+  // A rule that applies to the element being resolved
+  struct Match {
+    uint32_t rank;  // Specificity, then order
+    const CssStyle* style;
+  };
+
+  // The rules of one selector key, read from the cache file
+  struct CachedSelector {
+    uint64_t key = 0;
+    uint32_t lastUse = 0;  // 0 while the slot is unused
+    std::vector<Rule> rules;
+    std::vector<AncestorPart> ancestorParts;
+  };
+
+  // Storage: rules parsed from stylesheets sorted by key, then order, one per selector
+  std::vector<Rule> rules_;
+  std::vector<AncestorPart> ancestorParts_;
+  uint32_t nextOrder_ = 0;
+
+  // Rules read from a cache file: its sorted keys and the file offset of each key's rules, plus the end of the last
+  mutable HalFile cacheFile_;
+  std::vector<uint64_t> cacheKeys_;
+  std::vector<uint32_t> cacheOffsets_;
+  uint32_t cacheRuleCount_ = 0;
+  bool cacheAncestorSelectors_ = false;
+  // Least recently used slot is reused first. Holds more keys than one element looks up, so the rules matched for
+  // an element stay in memory until it is resolved.
+  mutable CachedSelector cachedSelectors_[CACHED_SELECTORS];
+  mutable uint32_t cacheUseCounter_ = 0;
+
+  const CachedSelector* cachedSelector(uint64_t key) const;
+  bool readCachedRules(uint32_t offset, uint32_t end, CachedSelector& selector) const;
+  void collectMatches(uint64_t key, const CssAncestors* ancestors, Match* matches, size_t& matchCount) const;
+  static void collectMatches(const Rule* first, const Rule* last, const AncestorPart* ancestorParts,
+                             const CssAncestors* ancestors, Match* matches, size_t& matchCount);
+  static bool matchesAncestors(const AncestorPart* parts, size_t partCount, const CssAncestors& ancestors,
+                               size_t below);
 
   // Internal parsing helpers
+  static bool compoundKey(const char* compound, size_t length, SelectorId& tagId, SelectorId& classId);
+  bool addSelector(const std::string& selector, const CssStyle& style);
   void processRuleBlock(const std::string& selectorGroup, const std::string& declarations);
+  void sortRules();
   static CssStyle parseDeclarations(const std::string& declBlock);
 
   // Individual property value parsers
@@ -3,14 +3,11 @@
 
 #include "htmlEntities.h"
 
-#include <cstring>
+#include <string_view>
 
-struct EntityPair {
-  const char* key;
-  const char* value;
-};
+#include "PerfectHash.h"
 
-static const EntityPair ENTITY_LOOKUP[] = {
+constexpr EntityPair ENTITY_LOOKUP[] = {
     {"&quot;", "\""},  {"&frasl;", "⁄"},   {"&amp;", "&"},         {"&lt;", "<"},     {"&gt;", ">"},
     {"&Agrave;", "À"}, {"&Aacute;", "Á"},  {"&Acirc;", "Â"},       {"&Atilde;", "Ã"}, {"&Auml;", "Ä"},
     {"&Aring;", "Å"},  {"&AElig;", "Æ"},   {"&Ccedil;", "Ç"},      {"&Egrave;", "È"}, {"&Eacute;", "É"},
@@ -60,16 +57,17 @@ static const EntityPair ENTITY_LOOKUP[] = {
     {"&crarr;", "↵"},  {"&lceil;", "⌈"},   {"&rceil;", "⌉"},       {"&lfloor;", "⌊"}, {"&rfloor;", "⌋"},
     {"&loz;", "◊"},    {"&spades;", "♠"},  {"&clubs;", "♣"},       {"&hearts;", "♥"}, {"&diams;", "♦"}};
 
-static const size_t ENTITY_LOOKUP_COUNT = sizeof(ENTITY_LOOKUP) / sizeof(ENTITY_LOOKUP[0]);
+constexpr size_t ENTITY_LOOKUP_COUNT = sizeof(ENTITY_LOOKUP) / sizeof(ENTITY_LOOKUP[0]);
+
+// Built at compile time, about 2 slots per entity
+static constexpr auto ENTITY_TABLE = perfect_hash::build<512, 128>(ENTITY_LOOKUP);
 
 // Lookup a single HTML entity and return its UTF-8 value
 const char* lookupHtmlEntity(const char* entity, int len) {
-  for (size_t i = 0; i < ENTITY_LOOKUP_COUNT; i++) {
-    const char* key = ENTITY_LOOKUP[i].key;
-    const size_t keyLen = strlen(key);
-    if (static_cast<size_t>(len) == keyLen && memcmp(entity, key, keyLen) == 0) {
-      return ENTITY_LOOKUP[i].value;
-    }
+  const std::string_view key(entity, len);
+  const size_t index = ENTITY_TABLE.candidate(perfect_hash::hash(key));
+  if (index < ENTITY_LOOKUP_COUNT && key == ENTITY_LOOKUP[index].key) {
+    return ENTITY_LOOKUP[index].value;
   }
 
   return nullptr;  // Entity not found
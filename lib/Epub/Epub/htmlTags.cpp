@@ -0,0 +1,35 @@
+#include "htmlTags.h"
+
+#include <cstring>
+
+#include "PerfectHash.h"
+
+namespace {
+
+struct TagEntry {
+  const char* key;
+  HtmlTagKind kind;
+};
+
+constexpr TagEntry TAG_LOOKUP[] = {
+    {"h1", HtmlTagKind::Header},   {"h2", HtmlTagKind::Header},     {"h3", HtmlTagKind::Header},
+    {"h4", HtmlTagKind::Header},   {"h5", HtmlTagKind::Header},     {"h6", HtmlTagKind::Header},
+    {"p", HtmlTagKind::Block},     {"div", HtmlTagKind::Block},     {"blockquote", HtmlTagKind::Block},
+    {"li", HtmlTagKind::ListItem}, {"br", HtmlTagKind::LineBreak},  {"b", HtmlTagKind::Bold},
+    {"strong", HtmlTagKind::Bold}, {"i", HtmlTagKind::Italic},      {"em", HtmlTagKind::Italic},
+    {"u", HtmlTagKind::Underline}, {"ins", HtmlTagKind::Underline}, {"img", HtmlTagKind::Image},
+    {"head", HtmlTagKind::Skip},   {"table", HtmlTagKind::Table}};
+
+constexpr size_t TAG_LOOKUP_COUNT = sizeof(TAG_LOOKUP) / sizeof(TAG_LOOKUP[0]);
+
+constexpr auto TAG_TABLE = perfect_hash::build<32, 8>(TAG_LOOKUP);
+
+}  // namespace
+
+HtmlTagKind lookupHtmlTag(const char* name) {
+  const size_t index = TAG_TABLE.candidate(perfect_hash::hash(name));
+  if (index < TAG_LOOKUP_COUNT && strcmp(name, TAG_LOOKUP[index].key) == 0) {
+    return TAG_LOOKUP[index].kind;
+  }
+  return HtmlTagKind::Other;
+}
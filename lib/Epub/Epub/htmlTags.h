@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+// How the chapter parser treats an element
+enum class HtmlTagKind : uint8_t {
+  Other,  // Inline, styled by CSS only
+  Header,
+  Block,
+  ListItem,
+  LineBreak,
+  Bold,
+  Italic,
+  Underline,
+  Image,
+  Skip,  // Dropped with its content
+  Table,
+};
+
+// Kind of the element named `name`, case-sensitive like XHTML. Other for tags without special handling.
+HtmlTagKind lookupHtmlTag(const char* name);
+
+inline bool isHeaderOrBlock(const HtmlTagKind kind) {
+  return kind == HtmlTagKind::Header || kind == HtmlTagKind::Block || kind == HtmlTagKind::ListItem ||
+         kind == HtmlTagKind::LineBreak;
+}
@@ -136,46 +136,57 @@ bool isExplicitHyphen(const uint32_t cp) {
 bool isSoftHyphen(const uint32_t cp) { return cp == 0x00AD; }
 
 void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
-  if (cps.empty()) {
+  size_t begin = 0;
+  size_t end = cps.size();
+  trimSurroundingPunctuationAndFootnote(cps.data(), begin, end);
+  cps.erase(cps.begin() + end, cps.end());
+  cps.erase(cps.begin(), cps.begin() + begin);
+}
+
+void trimSurroundingPunctuationAndFootnote(const CodepointInfo* cps, size_t& begin, size_t& end) {
+  if (begin >= end) {
     return;
   }
 
   // Remove trailing footnote references like [12], even if punctuation trails after the closing bracket.
-  if (cps.size() >= 3) {
-    int end = static_cast<int>(cps.size()) - 1;
-    while (end >= 0 && isPunctuation(cps[end].value)) {
-      --end;
+  if (end - begin >= 3) {
+    int last = static_cast<int>(end) - 1;
+    while (last >= static_cast<int>(begin) && isPunctuation(cps[last].value)) {
+      --last;
     }
-    int pos = end;
-    if (pos >= 0 && isAsciiDigit(cps[pos].value)) {
-      while (pos >= 0 && isAsciiDigit(cps[pos].value)) {
+    int pos = last;
+    if (pos >= static_cast<int>(begin) && isAsciiDigit(cps[pos].value)) {
+      while (pos >= static_cast<int>(begin) && isAsciiDigit(cps[pos].value)) {
         --pos;
       }
-      if (pos >= 0 && cps[pos].value == '[' && end - pos > 1) {
-        cps.erase(cps.begin() + pos, cps.end());
+      if (pos >= static_cast<int>(begin) && cps[pos].value == '[' && last - pos > 1) {
+        end = pos;
       }
     }
   }
 
-  while (!cps.empty() && isPunctuation(cps.front().value)) {
-    cps.erase(cps.begin());
+  while (begin < end && isPunctuation(cps[begin].value)) {
+    ++begin;
   }
-  while (!cps.empty() && isPunctuation(cps.back().value)) {
-    cps.pop_back();
+  while (begin < end && isPunctuation(cps[end - 1].value)) {
+    --end;
   }
 }
 
 std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
-  std::vector<CodepointInfo> cps;
-  cps.reserve(word.size());
+  std::vector<CodepointInfo> cps(word.size());
+  cps.resize(collectCodepoints(word, cps.data(), cps.size()));
+  return cps;
+}
 
+size_t collectCodepoints(const std::string& word, CodepointInfo* out, const size_t capacity) {
   const unsigned char* base = reinterpret_cast<const unsigned char*>(word.c_str());
   const unsigned char* ptr = base;
-  while (*ptr != 0) {
+  size_t count = 0;
+  while (*ptr != 0 && count < capacity) {
     const unsigned char* current = ptr;
     const uint32_t cp = utf8NextCodepoint(&ptr);
-    cps.push_back({cp, static_cast<size_t>(current - base)});
+    out[count++] = {cp, static_cast<size_t>(current - base)};
   }
-
-  return cps;
+  return count;
 }
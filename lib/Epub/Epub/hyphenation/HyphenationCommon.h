@@ -22,4 +22,8 @@ bool isAsciiDigit(uint32_t cp);
 bool isExplicitHyphen(uint32_t cp);
 bool isSoftHyphen(uint32_t cp);
 void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps);
+// Same on a fixed buffer: narrows [begin, end) instead of erasing
+void trimSurroundingPunctuationAndFootnote(const CodepointInfo* cps, size_t& begin, size_t& end);
 std::vector<CodepointInfo> collectCodepoints(const std::string& word);
+// Decodes at most `capacity` codepoints of `word` into `out` and returns how many it wrote
+size_t collectCodepoints(const std::string& word, CodepointInfo* out, size_t capacity);
@@ -1,11 +1,13 @@
 #include "Hyphenator.h"
 
-#include <vector>
+#include <new>
+#include <utility>
 
 #include "HyphenationCommon.h"
 #include "LanguageRegistry.h"
 
 const LanguageHyphenator* Hyphenator::cachedHyphenator_ = nullptr;
+Hyphenator::ChapterCache* Hyphenator::activeCache_ = nullptr;
 
 namespace {
 
@@ -26,72 +28,122 @@ const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
   return getLanguageHyphenatorForPrimaryTag(primary);
 }
 
-// Maps a codepoint index back to its byte offset inside the source word.
-size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t index) {
-  return (index < cps.size()) ? cps[index].byteOffset : (cps.empty() ? 0 : cps.back().byteOffset);
-}
-
-// Builds a vector of break information from explicit hyphen markers in the given codepoints.
-std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<CodepointInfo>& cps) {
-  std::vector<Hyphenator::BreakInfo> breaks;
+// One codepoint more than a break mask covers, so words too long for the patterns can be told apart.
+constexpr size_t kMaxCodepoints = kLiangMaxWordCodepoints + 1;
+static_assert(Hyphenator::Breaks::kMaxBreaks == kLiangMaxWordCodepoints, "a break mask must fit in Breaks");
+// Only the first kMaxCodepoints codepoints of a word are decoded and a UTF-8 codepoint takes at most 4 bytes, so break
+// offsets stay far below 64KB
+static_assert(kMaxCodepoints * 4 <= UINT16_MAX, "break offsets must fit BreakInfo::byteOffset");
 
+// Collects break information from explicit hyphen markers in the given codepoints.
+void collectExplicitBreaks(const CodepointInfo* cps, const size_t count, Hyphenator::Breaks& out) {
   // Scan every codepoint looking for explicit/soft hyphen markers that are surrounded by letters.
-  for (size_t i = 1; i + 1 < cps.size(); ++i) {
+  for (size_t i = 1; i + 1 < count && out.count < Hyphenator::Breaks::kMaxBreaks; ++i) {
     const uint32_t cp = cps[i].value;
     if (!isExplicitHyphen(cp) || !isAlphabetic(cps[i - 1].value) || !isAlphabetic(cps[i + 1].value)) {
       continue;
     }
     // Offset points to the next codepoint so rendering starts after the hyphen marker.
-    breaks.push_back({cps[i + 1].byteOffset, isSoftHyphen(cp)});
+    out.items[out.count++] = {static_cast<uint16_t>(cps[i + 1].byteOffset), isSoftHyphen(cp)};
   }
+}
 
-  return breaks;
+// FNV-1a over the word's bytes
+uint32_t hashBytes(const char* data, const size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(data[i])) * 16777619u;
+  }
+  return hash;
 }
 
 }  // namespace
 
-std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
+Hyphenator::ChapterCache::ChapterCache() { activeCache_ = this; }
+
+Hyphenator::ChapterCache::~ChapterCache() {
+  if (activeCache_ == this) {
+    activeCache_ = nullptr;
+  }
+}
+
+bool Hyphenator::breakOffsets(const std::string& word, const bool includeFallback, Breaks& out) {
+  out.count = 0;
   if (word.empty()) {
-    return {};
+    return false;
   }
 
-  // Convert to codepoints and normalize word boundaries.
-  auto cps = collectCodepoints(word);
-  trimSurroundingPunctuationAndFootnote(cps);
+  // Convert to codepoints and normalize word boundaries. Only the start of a long word is looked at, it can't break
+  // further in anyway; its end is unknown, so only leading punctuation is trimmed.
+  CodepointInfo cps[kMaxCodepoints];
+  const size_t decoded = collectCodepoints(word, cps, kMaxCodepoints);
+  const bool truncated = decoded == kMaxCodepoints;
+  size_t begin = 0;
+  size_t end = decoded;
+  if (truncated) {
+    while (begin < end && isPunctuation(cps[begin].value)) {
+      ++begin;
+    }
+  } else {
+    trimSurroundingPunctuationAndFootnote(cps, begin, end);
+  }
+  const CodepointInfo* trimmed = cps + begin;
+  const size_t count = end - begin;
   const auto* hyphenator = cachedHyphenator_;
 
   // Explicit hyphen markers (soft or hard) take precedence over language breaks.
-  auto explicitBreakInfos = buildExplicitBreakInfos(cps);
-  if (!explicitBreakInfos.empty()) {
-    return explicitBreakInfos;
+  collectExplicitBreaks(trimmed, count, out);
+  if (!out.empty()) {
+    return true;
   }
 
-  // Ask language hyphenator for legal break points.
-  std::vector<size_t> indexes;
-  if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
+  // Ask language hyphenator for legal break points, from the chapter cache if this word came up before.
+  uint64_t mask = 0;
+  if (hyphenator && !truncated && count > 0) {
+    const size_t byteStart = trimmed[0].byteOffset;
+    const size_t byteLength = (end < decoded ? cps[end].byteOffset : word.size()) - byteStart;
+    ChapterCache* cache = activeCache_;
+    if (cache && !cache->entries) {
+      cache->entries.reset(new (std::nothrow) ChapterCache::Entry[ChapterCache::kSets * 2]());
+    }
+    if (cache && cache->entries) {
+      // The length is folded into the tag, 0 marks unused entries
+      const uint32_t tag = (hashBytes(word.data() + byteStart, byteLength) ^ static_cast<uint32_t>(byteLength)) | 1u;
+      ChapterCache::Entry* set = &cache->entries[(tag >> 1) % ChapterCache::kSets * 2];
+      // The most recently used way is kept first
+      if (set[0].tag == tag) {
+        mask = set[0].maskLow | uint64_t{set[0].maskHigh} << 32;
+        cache->hits++;
+      } else if (set[1].tag == tag) {
+        mask = set[1].maskLow | uint64_t{set[1].maskHigh} << 32;
+        std::swap(set[0], set[1]);
+        cache->hits++;
+      } else {
+        mask = hyphenator->breakMask(trimmed, count);
+        set[1] = set[0];
+        set[0] = {tag, static_cast<uint32_t>(mask), static_cast<uint32_t>(mask >> 32)};
+        cache->misses++;
+      }
+    } else {
+      mask = hyphenator->breakMask(trimmed, count);
+    }
   }
 
   // Only add fallback breaks if needed
-  if (includeFallback && indexes.empty()) {
+  if (includeFallback && mask == 0) {
     const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
     const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
-    for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+    for (size_t idx = minPrefix; idx < Breaks::kMaxBreaks && (truncated || idx + minSuffix <= count); ++idx) {
+      mask |= uint64_t{1} << idx;
     }
   }
 
-  if (indexes.empty()) {
-    return {};
-  }
-
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
+  for (size_t idx = 0; idx < Breaks::kMaxBreaks && idx < count; ++idx) {
+    if (mask & (uint64_t{1} << idx)) {
+      out.items[out.count++] = {static_cast<uint16_t>(trimmed[idx].byteOffset), true};
+    }
   }
-
-  return breaks;
+  return !out.empty();
 }
 
 void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
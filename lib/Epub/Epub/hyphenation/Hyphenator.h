@@ -1,24 +1,67 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
-#include <vector>
 
 class LanguageHyphenator;
 
 class Hyphenator {
  public:
   struct BreakInfo {
-    size_t byteOffset;
+    uint16_t byteOffset;  // Within the first Breaks::kMaxBreaks codepoints, see breakOffsets()
     bool requiresInsertedHyphen;
   };
-  // Returns byte offsets where the word may be hyphenated. When includeFallback is true, all positions obeying the
-  // minimum prefix/suffix constraints are returned even if no language-specific rule matches.
-  static std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
+
+  // Break positions of one word, filled in place so layout doesn't allocate per word. Only the first
+  // kMaxBreaks codepoints of a word can break, which is more than fits on a line.
+  struct Breaks {
+    static constexpr size_t kMaxBreaks = 64;
+    BreakInfo items[kMaxBreaks];
+    size_t count = 0;
+
+    const BreakInfo* begin() const { return items; }
+    const BreakInfo* end() const { return items + count; }
+    bool empty() const { return count == 0; }
+  };
+
+  // Remembers the language breaks of every word hyphenated while it is alive, so words that come up again in the same
+  // chapter skip the pattern lookup. Section builds keep one for the duration of the build; at most one is active.
+  // Two-way set associative: a word only displaces the less recently used of the two words sharing its set.
+  class ChapterCache {
+   public:
+    // The mask is split so an entry packs into 12 bytes
+    struct Entry {
+      uint32_t tag;  // Hash of the word's bytes and length, 0 for an unused entry
+      uint32_t maskLow;
+      uint32_t maskHigh;
+    };
+    static constexpr size_t kSets = 256;  // Of two entries, 6KB
+
+    ChapterCache();
+    ~ChapterCache();
+    ChapterCache(const ChapterCache&) = delete;
+    ChapterCache& operator=(const ChapterCache&) = delete;
+
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+
+   private:
+    friend class Hyphenator;
+    // Allocated on first use, builds with hyphenation turned off never pay for it
+    std::unique_ptr<Entry[]> entries;
+  };
+
+  // Fills `out` with the byte offsets where the word may be hyphenated and returns whether there are any. When
+  // includeFallback is true, all positions obeying the minimum prefix/suffix constraints are returned even if no
+  // language-specific rule matches.
+  static bool breakOffsets(const std::string& word, bool includeFallback, Breaks& out);
 
   // Provide a publication-level language hint (e.g. "en", "en-US", "ru") used to select hyphenation rules.
   static void setPreferredLanguage(const std::string& lang);
 
  private:
   static const LanguageHyphenator* cachedHyphenator_;
-};
\ No newline at end of file
+  static ChapterCache* activeCache_;
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "LiangHyphenation.h"
 
 // Generic Liang-backed hyphenator that stores pattern metadata plus language-specific helpers.
@@ -10,12 +12,26 @@ class LanguageHyphenator {
                      size_t minSuffix = LiangWordConfig::kDefaultMinSuffix)
       : patterns_(patterns), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
 
+  uint64_t breakMask(const CodepointInfo* cps, const size_t count) const {
+    return liangBreakMask(cps, count, patterns_, config_);
+  }
+
+  // Break indexes in ascending order, for tooling that doesn't care about allocations
   std::vector<size_t> breakIndexes(const std::vector<CodepointInfo>& cps) const {
-    return liangBreakIndexes(cps, patterns_, config_);
+    std::vector<size_t> indexes;
+    const uint64_t mask = breakMask(cps.data(), cps.size());
+    for (size_t i = 0; i < kLiangMaxWordCodepoints; ++i) {
+      if (mask & (uint64_t{1} << i)) {
+        indexes.push_back(i);
+      }
+    }
+    return indexes;
   }
 
   size_t minPrefix() const { return config_.minPrefix; }
   size_t minSuffix() const { return config_.minSuffix; }
+  const SerializedHyphenationPatterns& patterns() const { return patterns_; }
+  const LiangWordConfig& config() const { return config_; }
 
  protected:
   const SerializedHyphenationPatterns& patterns_;
@@ -4,15 +4,73 @@
 #include <array>
 
 #include "HyphenationCommon.h"
+#ifdef HYPHENATION_TRIES_ON_SD
+#include <Logging.h>
+
+#include <memory>
+
+#include "SdHyphenationTrie.h"
+#else
 #include "generated/hyph-de.trie.h"
 #include "generated/hyph-en.trie.h"
 #include "generated/hyph-es.trie.h"
 #include "generated/hyph-fr.trie.h"
 #include "generated/hyph-it.trie.h"
 #include "generated/hyph-ru.trie.h"
+#endif
 
 namespace {
 
+#ifdef HYPHENATION_TRIES_ON_SD
+// The tries are read from /hyphenation/hyph-<tag>.trie on the SD card (scripts/generate_hyphenation_trie.py) instead
+// of being linked in. Their descriptors stay empty, and hyphenation off, until the language is asked for.
+SerializedHyphenationPatterns en_us_patterns{nullptr, 0};
+SerializedHyphenationPatterns fr_patterns{nullptr, 0};
+SerializedHyphenationPatterns de_patterns{nullptr, 0};
+SerializedHyphenationPatterns ru_ru_patterns{nullptr, 0};
+SerializedHyphenationPatterns es_patterns{nullptr, 0};
+SerializedHyphenationPatterns it_patterns{nullptr, 0};
+
+// Only one trie is open at a time, books switch language rarely
+std::unique_ptr<SdHyphenationTrie> openTrie;
+SerializedHyphenationPatterns* openPatterns = nullptr;
+
+SerializedHyphenationPatterns* patternsForTag(const std::string& primaryTag) {
+  if (primaryTag == "en") return &en_us_patterns;
+  if (primaryTag == "fr") return &fr_patterns;
+  if (primaryTag == "de") return &de_patterns;
+  if (primaryTag == "ru") return &ru_ru_patterns;
+  if (primaryTag == "es") return &es_patterns;
+  if (primaryTag == "it") return &it_patterns;
+  return nullptr;
+}
+
+// Points the language's descriptor at its trie file, closing the previously open one. False if there is no file.
+bool pageInTrie(const std::string& primaryTag) {
+  SerializedHyphenationPatterns* patterns = patternsForTag(primaryTag);
+  if (!patterns || patterns == openPatterns) {
+    return patterns != nullptr;
+  }
+
+  if (openPatterns) {
+    *openPatterns = SerializedHyphenationPatterns{nullptr, 0};
+    openPatterns = nullptr;
+  }
+  openTrie.reset();
+
+  const std::string path = "/hyphenation/hyph-" + primaryTag + ".trie";
+  openTrie = SdHyphenationTrie::open(path.c_str());
+  if (!openTrie) {
+    // The card wasn't provisioned with the trie files that match this firmware, see docs/hyphenation-trie-format.md
+    LOG_ERR("HYP", "No hyphenation trie at %s, hyphenation is off for this language", path.c_str());
+    return false;
+  }
+  *patterns = SerializedHyphenationPatterns{nullptr, openTrie->size(), openTrie.get()};
+  openPatterns = patterns;
+  return true;
+}
+#endif
+
 // English hyphenation patterns (3/3 minimum prefix/suffix length)
 LanguageHyphenator englishHyphenator(en_us_patterns, isLatinLetter, toLowerLatin, 3, 3);
 LanguageHyphenator frenchHyphenator(fr_patterns, isLatinLetter, toLowerLatin);
@@ -36,6 +94,11 @@ const EntryArray& entries() {
 }  // namespace
 
 const LanguageHyphenator* getLanguageHyphenatorForPrimaryTag(const std::string& primaryTag) {
+#ifdef HYPHENATION_TRIES_ON_SD
+  if (!pageInTrie(primaryTag)) {
+    return nullptr;
+  }
+#endif
   const auto& allEntries = entries();
   const auto it = std::find_if(allEntries.begin(), allEntries.end(),
                                [&primaryTag](const LanguageEntry& entry) { return primaryTag == entry.primaryTag; });
@@ -1,13 +1,12 @@
 #include "LiangHyphenation.h"
 
 #include <algorithm>
-#include <vector>
 
 /*
  * Liang hyphenation pipeline overview (Typst-style binary trie variant)
  * --------------------------------------------------------------------
  * 1.  Input normalization (buildAugmentedWord)
- *     - Accepts a vector of CodepointInfo structs emitted by the EPUB text
+ *     - Accepts an array of CodepointInfo structs emitted by the EPUB text
  *       parser. Each codepoint is validated with LiangWordConfig::isLetter so
  *       we abort early on digits, punctuation, etc. If the word is valid we
  *       build an "augmented" byte sequence: leading '.', lowercase UTF-8 bytes
@@ -24,8 +23,13 @@
  *       nodes, and an optional pointer into a shared "levels" list. We parse
  *       that layout lazily via decodeState/transition, keeping everything in
  *       flash memory; no heap allocations besides the stack-local AutomatonState
- *       structs. getAutomaton caches parseAutomaton results per blob pointer so
- *       multiple words hitting the same language only pay the cost once.
+ *       structs. parseAutomaton only reads the 4 byte header, so it runs per
+ *       word instead of being cached.
+ *     - Tries paged in from the SD card have no `data` pointer; every node is
+ *       read through HyphenationTrieSource as one contiguous view instead. A
+ *       view only stays valid for two more reads, so a node's pointers are
+ *       used before the next node is decoded and the root is decoded again
+ *       for every starting position.
  *
  * 3.  Pattern application
  *     - We walk the augmented bytes left-to-right. For each starting byte we
@@ -38,89 +42,96 @@
  *       "max digit wins" rule.
  *
  * 4.  Output filtering
- *     - collectBreakIndexes converts odd-valued score entries back to codepoint
- *       break positions while enforcing `minPrefix`/`minSuffix` constraints from
- *       LiangWordConfig. The caller (language-specific hyphenators) can then
- *       translate these indexes into renderer glyph offsets, page layout data,
- *       etc.
+ *     - collectBreakMask converts odd-valued score entries back to a mask of
+ *       codepoint break positions while enforcing `minPrefix`/`minSuffix`
+ *       constraints from LiangWordConfig. The caller (language-specific
+ *       hyphenators) can then translate these indexes into renderer glyph
+ *       offsets, page layout data, etc.
  *
  * Keeping the entire algorithm small and deterministic is critical on the
  * ESP32-C3: we avoid recursion, dynamic allocations per node, or copying the
  * trie. All lookups stay within the generated blob, which lives in flash, and
- * the working buffers (augmented bytes/scores) scale with the word length rather
- * than the pattern corpus.
+ * the working buffers (augmented bytes/scores) are fixed-size stack arrays sized
+ * by kLiangMaxWordCodepoints rather than by the pattern corpus. Layout asks for
+ * breaks of every word that overflows a line, so this path must not allocate.
  */
 
 namespace {
 
-struct AugmentedWord {
-  std::vector<uint8_t> bytes;
-  std::vector<size_t> charByteOffsets;
-  std::vector<int32_t> byteToCharIndex;
+// Dotted word plus sentinels. Every letter the language configs accept (Latin-1, Latin Extended-A, Cyrillic) encodes
+// to at most 2 UTF-8 bytes; words that don't fit are rejected like words with non-letters.
+constexpr size_t kMaxAugmentedChars = kLiangMaxWordCodepoints + 2;
+constexpr size_t kMaxAugmentedBytes = kLiangMaxWordCodepoints * 2 + 2;
 
-  bool empty() const { return bytes.empty(); }
-  size_t charCount() const { return charByteOffsets.size(); }
+struct AugmentedWord {
+  uint8_t bytes[kMaxAugmentedBytes];
+  uint8_t charByteOffsets[kMaxAugmentedChars];
+  int8_t byteToCharIndex[kMaxAugmentedBytes];
+  size_t byteCount = 0;
+  size_t charCount = 0;
 };
 
-// Encode a single Unicode codepoint into UTF-8 and append to the provided buffer.
-size_t encodeUtf8(uint32_t cp, std::vector<uint8_t>& out) {
+// Encode a single Unicode codepoint as UTF-8 at the end of `word`. Returns false if it doesn't fit.
+bool appendUtf8(const uint32_t cp, AugmentedWord& word) {
+  uint8_t encoded[4];
+  size_t length;
   if (cp <= 0x7Fu) {
-    out.push_back(static_cast<uint8_t>(cp));
-    return 1;
-  }
-  if (cp <= 0x7FFu) {
-    out.push_back(static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
-    return 2;
-  }
-  if (cp <= 0xFFFFu) {
-    out.push_back(static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
-    return 3;
-  }
-  out.push_back(static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
-  return 4;
+    encoded[0] = static_cast<uint8_t>(cp);
+    length = 1;
+  } else if (cp <= 0x7FFu) {
+    encoded[0] = static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu));
+    encoded[1] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
+    length = 2;
+  } else if (cp <= 0xFFFFu) {
+    encoded[0] = static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu));
+    encoded[1] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+    encoded[2] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
+    length = 3;
+  } else {
+    encoded[0] = static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u));
+    encoded[1] = static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu));
+    encoded[2] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+    encoded[3] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
+    length = 4;
+  }
+  // Keep one byte for the trailing '.'
+  if (word.byteCount + length + 1 > kMaxAugmentedBytes) {
+    return false;
+  }
+  std::copy(encoded, encoded + length, word.bytes + word.byteCount);
+  word.byteCount += length;
+  return true;
 }
 
-// Build the dotted, lowercase UTF-8 representation plus lookup tables.
-AugmentedWord buildAugmentedWord(const std::vector<CodepointInfo>& cps, const LiangWordConfig& config) {
-  AugmentedWord word;
-  if (cps.empty()) {
-    return word;
+// Build the dotted, lowercase UTF-8 representation plus lookup tables. Returns false for words that can't be
+// hyphenated: empty, too long or containing non-letters.
+bool buildAugmentedWord(const CodepointInfo* cps, const size_t count, const LiangWordConfig& config,
+                        AugmentedWord& word) {
+  if (count == 0 || count > kLiangMaxWordCodepoints) {
+    return false;
   }
 
-  word.bytes.reserve(cps.size() * 2 + 2);
-  word.charByteOffsets.reserve(cps.size() + 2);
+  word.charByteOffsets[word.charCount++] = 0;
+  word.bytes[word.byteCount++] = '.';
 
-  word.charByteOffsets.push_back(0);
-  word.bytes.push_back('.');
-
-  for (const auto& info : cps) {
-    if (!config.isLetter(info.value)) {
-      word.bytes.clear();
-      word.charByteOffsets.clear();
-      word.byteToCharIndex.clear();
-      return word;
+  for (size_t i = 0; i < count; ++i) {
+    if (!config.isLetter(cps[i].value)) {
+      return false;
+    }
+    word.charByteOffsets[word.charCount++] = static_cast<uint8_t>(word.byteCount);
+    if (!appendUtf8(config.toLower(cps[i].value), word)) {
+      return false;
     }
-    word.charByteOffsets.push_back(word.bytes.size());
-    encodeUtf8(config.toLower(info.value), word.bytes);
   }
 
-  word.charByteOffsets.push_back(word.bytes.size());
-  word.bytes.push_back('.');
+  word.charByteOffsets[word.charCount++] = static_cast<uint8_t>(word.byteCount);
+  word.bytes[word.byteCount++] = '.';
 
-  word.byteToCharIndex.assign(word.bytes.size(), -1);
-  for (size_t i = 0; i < word.charByteOffsets.size(); ++i) {
-    const size_t offset = word.charByteOffsets[i];
-    if (offset < word.byteToCharIndex.size()) {
-      word.byteToCharIndex[offset] = static_cast<int32_t>(i);
-    }
+  std::fill(word.byteToCharIndex, word.byteToCharIndex + word.byteCount, -1);
+  for (size_t i = 0; i < word.charCount; ++i) {
+    word.byteToCharIndex[word.charByteOffsets[i]] = static_cast<int8_t>(i);
   }
-  return word;
+  return true;
 }
 
 // Decoded view of a single trie node pulled straight out of the serialized blob.
@@ -141,53 +152,83 @@ struct AutomatonState {
   bool valid() const { return data != nullptr; }
 };
 
+// Optional direct-index table over the first two trie levels, appended by generate_hyphenation_trie.py --dense-table
+// and flagged by the top bit of the root offset. The last 4 bytes of the blob hold its big-endian offset:
+//   [0]          - alphabet size A, every byte that labels a root or level 1 transition
+//   [1..256]     - alphabet index of each byte value, 0xFF if not in the alphabet
+//   [...]        - A level 1 entries, then A*A level 2 entries, indexed by the alphabet indexes of the first bytes
+// An entry is the 3 byte big-endian node address, 0xFFFFFF if there is no such node. Bit 23 is set when the node has
+// levels, so level 1 nodes without any are never decoded.
+constexpr uint32_t kDenseTableFlag = 0x80000000u;
+constexpr uint32_t kDenseNoNode = 0xFFFFFFu;
+constexpr uint32_t kDenseHasLevels = 0x800000u;
+constexpr size_t kDenseEntrySize = 3;
+constexpr size_t kDenseHeaderSize = 1 + 256;
+
 // Lightweight descriptor for the entire embedded automaton.
 // The blob format is:
-//   [0..3]  - big-endian root offset
+//   [0..3]  - big-endian root offset, top bit set if a dense table is present
 //   [4....] - node heap containing variable-sized headers + transition data
+//   [.....] - optional dense table and its offset
 struct EmbeddedAutomaton {
   const uint8_t* data = nullptr;
+  HyphenationTrieSource* source = nullptr;
   size_t size = 0;
   uint32_t rootOffset = 0;
+  size_t denseTable = 0;  // 0 if there is none
+  size_t denseAlphabet = 0;
+
+  bool valid() const { return (data != nullptr || source != nullptr) && size >= 4 && rootOffset < size; }
 
-  bool valid() const { return data != nullptr && size >= 4 && rootOffset < size; }
+  // Contiguous view of `length` bytes at `offset`, nullptr if out of range or unreadable.
+  const uint8_t* bytes(const size_t offset, const size_t length) const {
+    if (offset > size || length > size - offset) {
+      return nullptr;
+    }
+    return data ? data + offset : source->read(offset, length);
+  }
 };
 
 // Decode the serialized automaton header and root offset.
 EmbeddedAutomaton parseAutomaton(const SerializedHyphenationPatterns& patterns) {
   EmbeddedAutomaton automaton;
-  if (!patterns.data || patterns.size < 4) {
+  if ((!patterns.data && !patterns.source) || patterns.size < 4) {
     return automaton;
   }
 
   automaton.data = patterns.data;
+  automaton.source = patterns.source;
   automaton.size = patterns.size;
-  automaton.rootOffset = (static_cast<uint32_t>(patterns.data[0]) << 24) |
-                         (static_cast<uint32_t>(patterns.data[1]) << 16) |
-                         (static_cast<uint32_t>(patterns.data[2]) << 8) | static_cast<uint32_t>(patterns.data[3]);
-  if (automaton.rootOffset >= automaton.size) {
-    automaton.data = nullptr;
-    automaton.size = 0;
+  const uint8_t* header = automaton.bytes(0, 4);
+  if (!header) {
+    return EmbeddedAutomaton{};
   }
-  return automaton;
-}
-
-// Cache parsed automata per blob pointer to avoid reparsing.
-const EmbeddedAutomaton& getAutomaton(const SerializedHyphenationPatterns& patterns) {
-  struct CacheEntry {
-    const SerializedHyphenationPatterns* key;
-    EmbeddedAutomaton automaton;
-  };
-  static std::vector<CacheEntry> cache;
-
-  for (const auto& entry : cache) {
-    if (entry.key == &patterns) {
-      return entry.automaton;
+  automaton.rootOffset = (static_cast<uint32_t>(header[0]) << 24) | (static_cast<uint32_t>(header[1]) << 16) |
+                         (static_cast<uint32_t>(header[2]) << 8) | static_cast<uint32_t>(header[3]);
+  if (automaton.rootOffset & kDenseTableFlag) {
+    automaton.rootOffset &= ~kDenseTableFlag;
+    const uint8_t* trailer = automaton.bytes(automaton.size - 4, 4);
+    const size_t tableOffset = trailer ? (static_cast<size_t>(trailer[0]) << 24) |
+                                             (static_cast<size_t>(trailer[1]) << 16) |
+                                             (static_cast<size_t>(trailer[2]) << 8) | static_cast<size_t>(trailer[3])
+                                       : 0;
+    const uint8_t* alphabet = automaton.bytes(tableOffset, 1);
+    if (!alphabet) {
+      return EmbeddedAutomaton{};
     }
+    const size_t alphabetSize = alphabet[0];
+    const size_t entries = alphabetSize + alphabetSize * alphabetSize;
+    // Symbol 0xFF marks bytes outside the alphabet, so it can't be an index
+    if (alphabetSize >= 0xFF || tableOffset + kDenseHeaderSize + entries * kDenseEntrySize + 4 != automaton.size) {
+      return EmbeddedAutomaton{};
+    }
+    automaton.denseTable = tableOffset;
+    automaton.denseAlphabet = alphabetSize;
   }
-
-  cache.push_back({&patterns, parseAutomaton(patterns)});
-  return cache.back().automaton;
+  if (automaton.rootOffset >= automaton.size) {
+    return EmbeddedAutomaton{};
+  }
+  return automaton;
 }
 
 // Interpret the node located at `addr`, returning transition metadata.
@@ -197,8 +238,12 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
     return state;
   }
 
-  const uint8_t* base = automaton.data + addr;
+  // Peek at the control byte(s) first to learn how long the node is, then view it as a whole
   size_t remaining = automaton.size - addr;
+  const uint8_t* base = automaton.bytes(addr, std::min<size_t>(remaining, 2));
+  if (!base) {
+    return state;
+  }
   size_t pos = 0;
 
   const uint8_t header = base[pos++];
@@ -219,14 +264,24 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
     childCount = base[pos++];
   }
 
+  const size_t levelsHeaderPos = pos;
+  if (hasLevels) {
+    pos += 2;
+  }
+  const size_t nodeSize = pos + childCount + childCount * stride;
+  if (nodeSize > remaining) {
+    return AutomatonState{};
+  }
+  base = automaton.bytes(addr, nodeSize);
+  if (!base) {
+    return AutomatonState{};
+  }
+
   const uint8_t* levelsPtr = nullptr;
   size_t levelsLen = 0;
   if (hasLevels) {
-    if (pos + 1 >= remaining) {
-      return AutomatonState{};
-    }
-    const uint8_t offsetHi = base[pos++];
-    const uint8_t offsetLoLen = base[pos++];
+    const uint8_t offsetHi = base[levelsHeaderPos];
+    const uint8_t offsetLoLen = base[levelsHeaderPos + 1];
     // The 12-bit offset (hi<<4 | top nibble) points into the blob-level levels list.
     // The bottom nibble stores how many packed entries belong to this node.
     const size_t offset = (static_cast<size_t>(offsetHi) << 4) | (offsetLoLen >> 4);
@@ -234,22 +289,19 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
     if (offset + levelsLen > automaton.size) {
       return AutomatonState{};
     }
-    levelsPtr = automaton.data + offset;
+    if (levelsLen > 0) {
+      levelsPtr = automaton.bytes(offset, levelsLen);
+      if (!levelsPtr) {
+        return AutomatonState{};
+      }
+    }
   }
 
-  if (pos + childCount > remaining) {
-    return AutomatonState{};
-  }
   const uint8_t* transitions = base + pos;
   pos += childCount;
-
-  const size_t targetsBytes = childCount * stride;
-  if (pos + targetsBytes > remaining) {
-    return AutomatonState{};
-  }
   const uint8_t* targets = base + pos;
 
-  state.data = automaton.data;
+  state.data = base;
   state.size = automaton.size;
   state.addr = addr;
   state.stride = stride;
@@ -300,15 +352,97 @@ bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state,
   return false;
 }
 
+// Raise the scores of the break positions listed in the node's levels, for a match starting at byteStart.
+void applyLevels(const AutomatonState& state, const AugmentedWord& augmented, const size_t byteStart,
+                 uint8_t* scores) {
+  if (!state.levels || state.levelsLen == 0) {
+    return;
+  }
+
+  size_t offset = 0;
+  // Each packed byte stores the byte-distance delta and the Liang level digit.
+  for (size_t i = 0; i < state.levelsLen; ++i) {
+    const uint8_t packed = state.levels[i];
+    const size_t dist = static_cast<size_t>(packed / 10);
+    const uint8_t level = static_cast<uint8_t>(packed % 10);
+
+    offset += dist;
+    const size_t splitByte = byteStart + offset;
+    if (splitByte >= augmented.byteCount) {
+      continue;
+    }
+
+    const int32_t boundary = augmented.byteToCharIndex[splitByte];
+    if (boundary < 0) {
+      continue;  // Mid-codepoint byte, wait for the next one.
+    }
+    if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount)) {
+      continue;  // Skip splits that land in the leading/trailing sentinels.
+    }
+
+    const size_t idx = static_cast<size_t>(boundary);
+    if (idx >= augmented.charCount) {
+      continue;
+    }
+    scores[idx] = std::max(scores[idx], level);
+  }
+}
+
+// Reads a dense table entry, kDenseNoNode if missing or unreadable.
+uint32_t denseEntry(const EmbeddedAutomaton& automaton, const size_t index) {
+  const uint8_t* entry =
+      automaton.bytes(automaton.denseTable + kDenseHeaderSize + index * kDenseEntrySize, kDenseEntrySize);
+  if (!entry) {
+    return kDenseNoNode;
+  }
+  return (static_cast<uint32_t>(entry[0]) << 16) | (static_cast<uint32_t>(entry[1]) << 8) | entry[2];
+}
+
+// Replaces the root and level 1 transitions of a match starting at byteStart with dense table lookups. Applies the
+// levels of the nodes on the way; returns false when the match ends before level 2, otherwise `state` is the level 2
+// node.
+bool walkDenseLevels(const EmbeddedAutomaton& automaton, const AugmentedWord& augmented, const size_t byteStart,
+                     uint8_t* scores, AutomatonState& state) {
+  const uint8_t* symbols = automaton.bytes(automaton.denseTable + 1, 256);
+  if (!symbols) {
+    return false;
+  }
+  const uint8_t first = symbols[augmented.bytes[byteStart]];
+  if (first == 0xFF) {
+    return false;
+  }
+  const uint8_t second = byteStart + 1 < augmented.byteCount ? symbols[augmented.bytes[byteStart + 1]] : 0xFF;
+
+  const uint32_t level1 = denseEntry(automaton, first);
+  if (level1 == kDenseNoNode) {
+    return false;
+  }
+  if (level1 & kDenseHasLevels) {
+    applyLevels(decodeState(automaton, level1 & ~kDenseHasLevels), augmented, byteStart, scores);
+  }
+  if (second == 0xFF) {
+    return false;
+  }
+
+  const uint32_t level2 = denseEntry(automaton, automaton.denseAlphabet + first * automaton.denseAlphabet + second);
+  if (level2 == kDenseNoNode) {
+    return false;
+  }
+  state = decodeState(automaton, level2 & ~kDenseHasLevels);
+  if (!state.valid()) {
+    return false;
+  }
+  applyLevels(state, augmented, byteStart, scores);
+  return true;
+}
+
 // Converts odd score positions back into codepoint indexes, honoring min prefix/suffix constraints.
 // Each break corresponds to scores[breakIndex + 1] because of the leading '.' sentinel.
-// Convert odd score entries into hyphen positions while honoring prefix/suffix limits.
-std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, const std::vector<uint8_t>& scores,
-                                        const size_t minPrefix, const size_t minSuffix) {
-  std::vector<size_t> indexes;
-  const size_t cpCount = cps.size();
+uint64_t collectBreakMask(const size_t cpCount, const uint8_t* scores, const size_t scoreCount,
+                          const size_t minPrefix, const size_t minSuffix) {
+  uint64_t mask = 0;
   if (cpCount < 2) {
-    return indexes;
+    return mask;
   }
 
   for (size_t breakIndex = 1; breakIndex < cpCount; ++breakIndex) {
@@ -322,84 +456,62 @@ std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, c
     }
 
     const size_t scoreIdx = breakIndex + 1;
-    if (scoreIdx >= scores.size()) {
+    if (scoreIdx >= scoreCount) {
       break;
     }
     if ((scores[scoreIdx] & 1u) == 0) {
       continue;
     }
-    indexes.push_back(breakIndex);
+    mask |= uint64_t{1} << breakIndex;
   }
 
-  return indexes;
+  return mask;
 }
 
 }  // namespace
 
 // Entry point that runs the full Liang pipeline for a single word.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
-  const auto augmented = buildAugmentedWord(cps, config);
-  if (augmented.empty()) {
-    return {};
+uint64_t liangBreakMask(const CodepointInfo* cps, const size_t count, const SerializedHyphenationPatterns& patterns,
+                        const LiangWordConfig& config) {
+  AugmentedWord augmented;
+  if (!buildAugmentedWord(cps, count, config, augmented)) {
+    return 0;
   }
 
-  const EmbeddedAutomaton& automaton = getAutomaton(patterns);
+  const EmbeddedAutomaton automaton = parseAutomaton(patterns);
   if (!automaton.valid()) {
-    return {};
-  }
-
-  const AutomatonState root = decodeState(automaton, automaton.rootOffset);
-  if (!root.valid()) {
-    return {};
+    return 0;
   }
 
   // Liang scores: one entry per augmented char (leading/trailing dots included).
-  std::vector<uint8_t> scores(augmented.charCount(), 0);
+  uint8_t scores[kMaxAugmentedChars] = {};
 
   // Walk every starting character position and stream bytes through the trie.
-  for (size_t charStart = 0; charStart < augmented.charByteOffsets.size(); ++charStart) {
+  for (size_t charStart = 0; charStart < augmented.charCount; ++charStart) {
     const size_t byteStart = augmented.charByteOffsets[charStart];
-    AutomatonState state = root;
+    AutomatonState state;
+    size_t cursor = byteStart;
+    if (automaton.denseTable) {
+      if (!walkDenseLevels(automaton, augmented, byteStart, scores, state)) {
+        continue;
+      }
+      cursor += 2;
+    } else {
+      state = decodeState(automaton, automaton.rootOffset);
+      if (!state.valid()) {
+        return 0;
+      }
+    }
 
-    for (size_t cursor = byteStart; cursor < augmented.bytes.size(); ++cursor) {
+    for (; cursor < augmented.byteCount; ++cursor) {
       AutomatonState next;
       if (!transition(automaton, state, augmented.bytes[cursor], next)) {
         break;  // No more matches for this prefix.
       }
       state = next;
-
-      if (state.levels && state.levelsLen > 0) {
-        size_t offset = 0;
-        // Each packed byte stores the byte-distance delta and the Liang level digit.
-        for (size_t i = 0; i < state.levelsLen; ++i) {
-          const uint8_t packed = state.levels[i];
-          const size_t dist = static_cast<size_t>(packed / 10);
-          const uint8_t level = static_cast<uint8_t>(packed % 10);
-
-          offset += dist;
-          const size_t splitByte = byteStart + offset;
-          if (splitByte >= augmented.byteToCharIndex.size()) {
-            continue;
-          }
-
-          const int32_t boundary = augmented.byteToCharIndex[splitByte];
-          if (boundary < 0) {
-            continue;  // Mid-codepoint byte, wait for the next one.
-          }
-          if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount())) {
-            continue;  // Skip splits that land in the leading/trailing sentinels.
-          }
-
-          const size_t idx = static_cast<size_t>(boundary);
-          if (idx >= scores.size()) {
-            continue;
-          }
-          scores[idx] = std::max(scores[idx], level);
-        }
-      }
+      applyLevels(state, augmented, byteStart, scores);
     }
   }
 
-  return collectBreakIndexes(cps, scores, config.minPrefix, config.minSuffix);
+  return collectBreakMask(count, scores, augmented.charCount, config.minPrefix, config.minSuffix);
 }
@@ -2,7 +2,6 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <vector>
 
 #include "HyphenationCommon.h"
 #include "SerializedHyphenationTrie.h"
@@ -33,6 +32,12 @@ struct LiangWordConfig {
       : isLetter(letterFn), toLower(lowerFn), minPrefix(prefix), minSuffix(suffix) {}
 };
 
-// Shared Liang pattern evaluator used by every language-specific hyphenator.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config);
+// Longest word the evaluator hyphenates, in codepoints. Break masks carry one bit per codepoint; anything longer than
+// this is a URL or similar that no pattern set covers.
+constexpr size_t kLiangMaxWordCodepoints = 64;
+
+// Shared Liang pattern evaluator used by every language-specific hyphenator.  Returns a mask with bit i set when the
+// word may break before codepoint i, 0 for words it can't hyphenate.  All working buffers are fixed-size locals sized
+// by kLiangMaxWordCodepoints, so the evaluator never touches the heap.
+uint64_t liangBreakMask(const CodepointInfo* cps, size_t count, const SerializedHyphenationPatterns& patterns,
+                        const LiangWordConfig& config);
@@ -0,0 +1,34 @@
+#include "SdHyphenationTrie.h"
+
+#include <Logging.h>
+#include <Serialization.h>
+
+std::unique_ptr<SdHyphenationTrie> SdHyphenationTrie::open(const char* path) {
+  std::unique_ptr<SdHyphenationTrie> trie(new SdHyphenationTrie());
+  if (!Storage.openFileForRead("HYP", path, trie->file)) {
+    return nullptr;
+  }
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  uint32_t blobSize = 0;
+  serialization::readPod(trie->file, magic);
+  serialization::readPod(trie->file, version);
+  serialization::readPod(trie->file, blobSize);
+  if (magic != kHyphenationTrieFileMagic || version != kHyphenationTrieFileVersion || blobSize < 4 ||
+      trie->file.size() < kHyphenationTrieFileHeaderSize + blobSize) {
+    LOG_ERR("HYP", "Invalid hyphenation trie: %s", path);
+    return nullptr;
+  }
+
+  trie->trieSize = blobSize;
+  LOG_DBG("HYP", "Opened hyphenation trie %s (%lu bytes)", path, static_cast<unsigned long>(blobSize));
+  return trie;
+}
+
+bool SdHyphenationTrie::readBlock(const size_t offset, uint8_t* out, const size_t length) {
+  if (!file.seekSet(kHyphenationTrieFileHeaderSize + offset)) {
+    return false;
+  }
+  return file.read(out, length) == static_cast<int>(length);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <memory>
+
+#include "TrieBlockCache.h"
+
+// A hyphenation trie file on the SD card (see SerializedHyphenationTrie.h for the header), paged in through a
+// TrieBlockCache. The file stays open while the trie is in use.
+class SdHyphenationTrie final : public TrieBlockCache {
+ public:
+  // Opens and validates the trie file at `path`, nullptr if it is missing or malformed.
+  static std::unique_ptr<SdHyphenationTrie> open(const char* path);
+
+ protected:
+  bool readBlock(size_t offset, uint8_t* out, size_t length) override;
+
+ private:
+  SdHyphenationTrie() = default;
+
+  HalFile file;
+};
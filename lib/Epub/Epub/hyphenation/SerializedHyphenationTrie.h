@@ -3,8 +3,26 @@
 #include <cstddef>
 #include <cstdint>
 
-// Lightweight descriptor that points at a serialized Liang hyphenation trie stored in flash.
+// Byte access to a trie that isn't mapped into memory, e.g. one paged in from the SD card (see TrieBlockCache.h).
+class HyphenationTrieSource {
+ public:
+  virtual ~HyphenationTrieSource() = default;
+
+  // Returns `length` contiguous bytes of the trie starting at `offset`, or nullptr if they can't be read. A returned
+  // pointer stays valid until two further reads have been made.
+  virtual const std::uint8_t* read(size_t offset, size_t length) = 0;
+};
+
+// Lightweight descriptor that points at a serialized Liang hyphenation trie stored in flash, or at a source that
+// pages it in when `data` is nullptr.
 struct SerializedHyphenationPatterns {
   const std::uint8_t* data;
   size_t size;
+  HyphenationTrieSource* source = nullptr;
 };
+
+// A trie file on the SD card is a header followed by the same bytes as the flash blob. The header is magic ("HYPT"),
+// version and blob size, each a little-endian uint32, zero padded to one SD sector so trie blocks line up with sectors.
+constexpr std::uint32_t kHyphenationTrieFileMagic = 0x54505948;
+constexpr std::uint32_t kHyphenationTrieFileVersion = 1;
+constexpr size_t kHyphenationTrieFileHeaderSize = 512;
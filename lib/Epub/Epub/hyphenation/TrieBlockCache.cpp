@@ -0,0 +1,36 @@
+#include "TrieBlockCache.h"
+
+const uint8_t* TrieBlockCache::read(const size_t offset, const size_t length) {
+  if (length == 0 || length > kBlockSize || offset >= trieSize || length > trieSize - offset) {
+    return nullptr;
+  }
+
+  Block* victim = &blocks[0];
+  for (auto& block : blocks) {
+    if (block.length > 0 && offset >= block.start && offset + length <= block.start + block.length) {
+      block.lastUse = ++useCounter;
+      hits++;
+      return block.bytes + (offset - block.start);
+    }
+    // Least recently used, so the two most recent reads stay valid
+    if (block.lastUse < victim->lastUse) {
+      victim = &block;
+    }
+  }
+
+  // Load the aligned block around the range, or a block starting at it if it straddles a boundary
+  size_t start = offset - offset % kBlockSize;
+  if (offset + length > start + kBlockSize) {
+    start = offset;
+  }
+  const size_t blockLength = trieSize - start < kBlockSize ? trieSize - start : kBlockSize;
+  misses++;
+  victim->length = 0;
+  if (!readBlock(start, victim->bytes, blockLength)) {
+    return nullptr;
+  }
+  victim->start = start;
+  victim->length = blockLength;
+  victim->lastUse = ++useCounter;
+  return victim->bytes + (offset - start);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SerializedHyphenationTrie.h"
+
+// Read-through cache of trie blocks for tries that live outside of flash. Lookups only touch the root, the levels
+// tape at the start of the blob and the nodes along each word's prefixes, so a handful of blocks covers most words.
+// Subclasses provide the backing storage through readBlock().
+class TrieBlockCache : public HyphenationTrieSource {
+ public:
+  // One SD sector. Every trie node of the shipped languages is smaller than 128 bytes, the format allows up to ~1KB.
+  static constexpr size_t kBlockSize = 512;
+  static constexpr size_t kBlockCount = 16;
+
+  // Reads longer than kBlockSize fail.
+  const uint8_t* read(size_t offset, size_t length) override;
+
+  size_t size() const { return trieSize; }
+
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+
+ protected:
+  // Size of the trie blob, set by subclasses once they know it
+  size_t trieSize = 0;
+
+  // Fills `out` with `length` bytes of the trie at `offset`.
+  virtual bool readBlock(size_t offset, uint8_t* out, size_t length) = 0;
+
+ private:
+  struct Block {
+    uint8_t bytes[kBlockSize];
+    size_t start = 0;
+    size_t length = 0;
+    uint32_t lastUse = 0;
+  };
+
+  uint32_t useCounter = 0;
+  Block blocks[kBlockCount];
+};
@@ -7,7 +7,7 @@
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
 alignas(4) constexpr uint8_t de_trie_data[] = {
-    0x00, 0x03, 0x25, 0x46, 0x21, 0x2A, 0x23, 0x23, 0x18, 0x2C, 0x40, 0x20, 0x2E, 0x2B, 0x22, 0x24, 0x0F, 0x1A, 0x2B,
+    0x80, 0x03, 0x25, 0x46, 0x21, 0x2A, 0x23, 0x23, 0x18, 0x2C, 0x40, 0x20, 0x2E, 0x2B, 0x22, 0x24, 0x0F, 0x1A, 0x2B,
     0x0E, 0x23, 0x10, 0x36, 0x0F, 0x35, 0x23, 0x0E, 0x22, 0x0F, 0x2E, 0x1A, 0x42, 0x22, 0x0F, 0x0E, 0x42, 0x0F, 0x22,
     0x0D, 0x2C, 0x0D, 0x41, 0x37, 0x38, 0x21, 0x0E, 0x21, 0x0C, 0x20, 0x0D, 0x2D, 0x0E, 0x4C, 0x2E, 0x0F, 0x10, 0x2C,
     0x0F, 0x37, 0x0E, 0x56, 0x38, 0x0F, 0x24, 0x19, 0x21, 0x18, 0x4B, 0x10, 0x1F, 0x22, 0x0F, 0x18, 0x7E, 0x24, 0x2E,
@@ -10862,7 +10862,320 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x54, 0x1A, 0x7D, 0x5E, 0x81, 0x7D, 0x7A, 0x65, 0x7D, 0xBB, 0x52, 0x7D, 0xD2, 0x23, 0x7D, 0xEB, 0xF8, 0x7E,
     0x14, 0x69, 0x7E, 0x43, 0x7E, 0x7E, 0x45, 0xF1, 0x7E, 0x61, 0x55, 0x7E, 0x91, 0x68, 0x7E, 0xAA, 0x83, 0x7E, 0xD7,
     0x5A, 0x7E, 0xFB, 0xCC, 0x7F, 0x11, 0xCB, 0x7F, 0x12, 0x5D, 0x7F, 0x4B, 0xD4, 0x7F, 0x80, 0x63, 0x7F, 0xB4, 0x7A,
-    0x7F, 0xD7, 0xDB, 0x7F, 0xDD, 0x75, 0x7F, 0xE7, 0xD3, 0x7F, 0xEB, 0xDF, 0x7F, 0xEF, 0xED, 0x7F, 0xFF, 0x95,
+    0x7F, 0xD7, 0xDB, 0x7F, 0xDD, 0x75, 0x7F, 0xE7, 0xD3, 0x7F, 0xEB, 0xDF, 0x7F, 0xEF, 0xED, 0x7F, 0xFF, 0x95, 0x2B,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0xFF, 0x1C, 0x1D, 0xFF, 0x1E, 0xFF, 0xFF, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0xFF, 0x24, 0xFF, 0x25, 0xFF, 0x26, 0xFF, 0x27, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1C, 0xC6, 0x00, 0x50, 0xA6, 0x80, 0x79, 0x60, 0x00,
+    0x83, 0xC7, 0x80, 0x9F, 0xAB, 0x00, 0xE0, 0x98, 0x00, 0xF7, 0x69, 0x81, 0x11, 0x3E, 0x01, 0x39, 0xAF, 0x01, 0x68,
+    0xC4, 0x81, 0x6B, 0x37, 0x01, 0x86, 0x9B, 0x01, 0xB6, 0xAE, 0x01, 0xCF, 0xC9, 0x01, 0xFC, 0xA0, 0x02, 0x21, 0x12,
+    0x02, 0x37, 0x11, 0x82, 0x37, 0xA3, 0x02, 0x71, 0x1A, 0x02, 0xA5, 0xA9, 0x82, 0xD9, 0xC0, 0x02, 0xFD, 0x21, 0x83,
+    0x02, 0xBB, 0x83, 0x0D, 0x19, 0x03, 0x11, 0x25, 0x03, 0x15, 0x33, 0x83, 0x24, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x62, 0xA9, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0xB3, 0x00, 0x08, 0x6F, 0x00, 0x08, 0xB1, 0x00, 0x0A,
+    0x23, 0x00, 0x0D, 0x38, 0x00, 0x0E, 0x35, 0x00, 0x0F, 0x35, 0x00, 0x10, 0x31, 0x00, 0x10, 0x94, 0x00, 0x10, 0xB8,
+    0x00, 0x11, 0x0F, 0x00, 0x12, 0x36, 0x00, 0x13, 0x6C, 0x00, 0x14, 0x46, 0x00, 0x14, 0xFA, 0x00, 0x15, 0x9A, 0xFF,
+    0xFF, 0xFF, 0x00, 0x16, 0xD9, 0x00, 0x18, 0x72, 0x00, 0x1A, 0x4C, 0x00, 0x1A, 0xFD, 0x00, 0x1B, 0x2D, 0x00, 0x1B,
+    0xF1, 0x00, 0x1C, 0x01, 0x00, 0x1C, 0x0C, 0x00, 0x1C, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1D, 0xE1, 0x00, 0x20, 0x40, 0x00, 0x22, 0x95, 0x00, 0x24, 0x09, 0x00, 0x27, 0xBA,
+    0x00, 0x29, 0x91, 0x00, 0x2B, 0x8F, 0x00, 0x2D, 0x6F, 0x00, 0x2E, 0x8E, 0x00, 0x2E, 0xBD, 0x00, 0x2F, 0xFE, 0x00,
+    0x35, 0xC6, 0x00, 0x38, 0x49, 0x00, 0x3E, 0x78, 0x80, 0x3E, 0xE0, 0x00, 0x3F, 0xAB, 0x00, 0x3F, 0xDA, 0x00, 0x45,
+    0x67, 0x00, 0x48, 0x61, 0x00, 0x4B, 0xAA, 0x80, 0x4F, 0x98, 0x00, 0x50, 0x00, 0x80, 0x50, 0x16, 0x80, 0x50, 0x35,
+    0x00, 0x50, 0x5B, 0x00, 0x50, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x15, 0xFF, 0xFF, 0xFF,
+    0x00, 0x65, 0xED, 0x80, 0x66, 0xC9, 0x80, 0x66, 0xE1, 0x80, 0x66, 0xFA, 0x00, 0x6C, 0xC9, 0x80, 0x6D, 0x2E, 0x80,
+    0x6D, 0x5E, 0x80, 0x6D, 0x6A, 0x80, 0x6E, 0x96, 0x80, 0x6E, 0xD2, 0x80, 0x6E, 0xD7, 0x80, 0x70, 0xB3, 0x80, 0x70,
+    0xD2, 0x80, 0x70, 0xDE, 0x00, 0x72, 0x16, 0x80, 0x72, 0x52, 0x80, 0x1E, 0x22, 0x80, 0x74, 0x6F, 0x80, 0x76, 0xD8,
+    0x80, 0x77, 0x33, 0x00, 0x78, 0xD5, 0x80, 0x1E, 0x22, 0x80, 0x79, 0x10, 0xFF, 0xFF, 0xFF, 0x80, 0x79, 0x35, 0x80,
+    0x79, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x66, 0x7E, 0xFF, 0xFF, 0xFF, 0x80, 0x7A, 0x02, 0xFF,
+    0xFF, 0xFF, 0x80, 0x7A, 0x4A, 0x80, 0x7A, 0x53, 0x00, 0x7A, 0xD4, 0x80, 0x1D, 0x70, 0x80, 0x1D, 0x18, 0x00, 0x7F,
+    0x60, 0x00, 0x7F, 0xB9, 0xFF, 0xFF, 0xFF, 0x80, 0x81, 0xAE, 0x80, 0x82, 0x29, 0x80, 0x82, 0x34, 0xFF, 0xFF, 0xFF,
+    0x80, 0x82, 0xDA, 0x80, 0x22, 0x85, 0x80, 0x1E, 0x22, 0x80, 0x83, 0x3B, 0x80, 0x83, 0x5D, 0x80, 0x83, 0x7F, 0x80,
+    0x83, 0xA7, 0x80, 0x70, 0x38, 0xFF, 0xFF, 0xFF, 0x80, 0x1E, 0x22, 0x80, 0x83, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7A, 0x39, 0xFF, 0xFF, 0xFF, 0x00, 0x88, 0x72, 0x80, 0x89, 0x4C, 0x80, 0x89,
+    0x63, 0x80, 0x89, 0xA7, 0x00, 0x91, 0x8E, 0x80, 0x91, 0xDB, 0x80, 0x92, 0x16, 0x80, 0x92, 0x36, 0x00, 0x94, 0x9A,
+    0x80, 0x1E, 0x22, 0x80, 0x94, 0xDC, 0x80, 0x95, 0x1B, 0x80, 0x22, 0x85, 0x80, 0x95, 0x45, 0x00, 0x96, 0xC9, 0x80,
+    0x63, 0x5C, 0x80, 0x1E, 0x22, 0x80, 0x99, 0xEF, 0x80, 0x9C, 0xC7, 0x80, 0x9D, 0x65, 0x00, 0x9E, 0xF8, 0x80, 0x9F,
+    0x35, 0x80, 0x9F, 0x64, 0xFF, 0xFF, 0xFF, 0x00, 0x9F, 0x92, 0x80, 0x1E, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x89, 0x45, 0xFF, 0xFF, 0xFF, 0x80, 0xA1, 0xD0, 0x00, 0xA3, 0xE0, 0x00, 0xA5, 0x94, 0x00, 0xA7, 0x01,
+    0x80, 0xA9, 0x1C, 0x80, 0xAA, 0xF7, 0x80, 0xAC, 0x68, 0x00, 0xAF, 0xB2, 0x00, 0xB6, 0x3F, 0x00, 0xB6, 0x91, 0x00,
+    0xB7, 0x6F, 0x00, 0xBE, 0x0A, 0x80, 0xC0, 0x1A, 0x00, 0xC7, 0xC6, 0x80, 0xC8, 0xC8, 0x00, 0xC9, 0xC9, 0x00, 0xCA,
+    0x0C, 0x00, 0xD4, 0x0F, 0x00, 0xD8, 0xEF, 0x00, 0xDC, 0x21, 0x00, 0xDE, 0xD1, 0x80, 0xDF, 0x40, 0x00, 0xDF, 0xA4,
+    0x00, 0xE0, 0x0F, 0x80, 0xE0, 0x49, 0x80, 0xE0, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xA2, 0x2B,
+    0xFF, 0xFF, 0xFF, 0x80, 0xE3, 0x82, 0x80, 0xE4, 0x96, 0x80, 0x66, 0xE1, 0x80, 0xE4, 0xA1, 0x80, 0xE8, 0xEC, 0x80,
+    0xEA, 0x4C, 0x80, 0xEA, 0x9C, 0x80, 0xEA, 0xAF, 0x80, 0xEC, 0x97, 0x00, 0xEC, 0xDF, 0x80, 0xEC, 0xEE, 0x00, 0xEE,
+    0x62, 0x80, 0xEE, 0xA0, 0x80, 0xEE, 0xAB, 0x80, 0xEF, 0x9E, 0x80, 0x63, 0x5C, 0x80, 0x1E, 0x22, 0x80, 0xF1, 0x8F,
+    0x80, 0xF3, 0xBC, 0x80, 0xF5, 0xE6, 0x80, 0xF7, 0x17, 0x80, 0x1E, 0x22, 0x80, 0x1E, 0x22, 0xFF, 0xFF, 0xFF, 0x80,
+    0x1D, 0x70, 0x80, 0xF7, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE4, 0x72, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFA, 0xD6, 0x80, 0xFB, 0x72, 0x80, 0x22, 0x85, 0x80, 0xFB, 0xF4, 0x01, 0x01, 0xE8, 0x81, 0x02, 0x44, 0x81, 0x02,
+    0x69, 0x81, 0x02, 0xB2, 0x01, 0x04, 0x11, 0x80, 0x1E, 0x22, 0x81, 0x04, 0x5F, 0x01, 0x06, 0xE2, 0x81, 0x07, 0x2C,
+    0x01, 0x08, 0x16, 0x01, 0x09, 0x62, 0x81, 0x09, 0xA3, 0x81, 0x09, 0xAE, 0x81, 0x0C, 0x07, 0x81, 0x0F, 0x03, 0x81,
+    0x0F, 0x6C, 0x01, 0x10, 0xE4, 0x81, 0x11, 0x15, 0x81, 0x11, 0x1C, 0xFF, 0xFF, 0xFF, 0x00, 0x31, 0x75, 0x81, 0x11,
+    0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0x5F, 0xFF, 0xFF, 0xFF, 0x01, 0x17, 0x08, 0x81, 0x18,
+    0x45, 0x81, 0x18, 0x53, 0x81, 0x18, 0x5E, 0x01, 0x1E, 0x3B, 0x81, 0x1E, 0x93, 0x81, 0x1E, 0xAD, 0x81, 0x1E, 0xDF,
+    0x01, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0x81, 0x21, 0x4E, 0x81, 0x23, 0xFA, 0x81, 0x25, 0x6A, 0x81, 0x26, 0xE8, 0x01,
+    0x29, 0x42, 0x81, 0x29, 0x97, 0xFF, 0xFF, 0xFF, 0x81, 0x2D, 0x31, 0x81, 0x31, 0x47, 0x81, 0x36, 0x78, 0x01, 0x38,
+    0xC5, 0x80, 0x1E, 0x22, 0x81, 0x39, 0x45, 0xFF, 0xFF, 0xFF, 0x01, 0x39, 0x7E, 0x81, 0x39, 0xA4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x18, 0x26, 0xFF, 0xFF, 0xFF, 0x01, 0x3C, 0xA0, 0x01, 0x3E, 0x9C, 0x81, 0x40, 0x32,
+    0x01, 0x41, 0x61, 0x01, 0x46, 0xC5, 0x81, 0x48, 0x7B, 0x01, 0x4A, 0xBA, 0x81, 0x4B, 0x51, 0x01, 0x4B, 0x85, 0x01,
+    0x4B, 0xB1, 0x81, 0x4D, 0xCB, 0x01, 0x51, 0x72, 0x01, 0x53, 0x3C, 0x01, 0x58, 0xF3, 0x01, 0x5A, 0x34, 0x81, 0x5A,
+    0xF6, 0xFF, 0xFF, 0xFF, 0x01, 0x5C, 0xE1, 0x01, 0x61, 0xB2, 0x01, 0x66, 0x59, 0x81, 0x66, 0x9A, 0x81, 0x67, 0xB9,
+    0x01, 0x67, 0xDC, 0x01, 0x67, 0xF1, 0x80, 0x1D, 0x70, 0x81, 0x68, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0x3D, 0x4E, 0xFF, 0xFF, 0xFF, 0x81, 0x69, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1E, 0x22, 0x01,
+    0x6A, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x6A, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x22, 0x85, 0xFF, 0xFF, 0xFF, 0x01, 0x6A, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x6A, 0xC4, 0x81, 0x6B, 0x18, 0x80, 0x1E, 0x22, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x81, 0x6F, 0xAB, 0x81, 0x70, 0x63, 0x81, 0x70, 0x76, 0x81, 0x70, 0x89, 0x01, 0x75, 0x91, 0x81, 0x75,
+    0xE9, 0x81, 0x76, 0x0B, 0x81, 0x76, 0x26, 0x01, 0x77, 0x99, 0x81, 0x77, 0xDA, 0x81, 0x78, 0x05, 0x81, 0x7A, 0x21,
+    0x81, 0x7A, 0x50, 0x81, 0x7A, 0xEC, 0x81, 0x7D, 0x4B, 0x81, 0x7D, 0x9B, 0x81, 0x15, 0x33, 0x81, 0x7F, 0x53, 0x81,
+    0x82, 0x0D, 0x81, 0x84, 0x52, 0x81, 0x86, 0x37, 0x81, 0x11, 0x15, 0x80, 0x1E, 0x22, 0xFF, 0xFF, 0xFF, 0x01, 0x86,
+    0x72, 0x81, 0x86, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x70, 0x57, 0xFF, 0xFF, 0xFF, 0x01, 0x8E,
+    0x9B, 0x81, 0x91, 0x56, 0x81, 0x92, 0x00, 0x81, 0x94, 0x41, 0x81, 0x9C, 0x58, 0x81, 0x9D, 0x37, 0x81, 0x9D, 0xA7,
+    0x81, 0x9D, 0xDD, 0x81, 0xA1, 0x95, 0x80, 0x1E, 0x22, 0x81, 0xA2, 0x5F, 0x81, 0xA5, 0xC8, 0x81, 0xA7, 0x2E, 0x81,
+    0xA7, 0x86, 0x81, 0xA9, 0xDC, 0x81, 0xAA, 0x74, 0x80, 0x1E, 0x22, 0x81, 0xAA, 0xD6, 0x81, 0xAE, 0x09, 0x81, 0xB1,
+    0xB6, 0x01, 0xB4, 0xDE, 0x81, 0xB5, 0x2C, 0x80, 0x1E, 0x22, 0x80, 0x1E, 0x22, 0x81, 0xB5, 0x60, 0x81, 0xB6, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x90, 0x2C, 0xFF, 0xFF, 0xFF, 0x81, 0xBC, 0xF3, 0x81, 0xBD, 0xFD,
+    0x81, 0xBE, 0x1C, 0x81, 0xBE, 0x9B, 0x81, 0xC3, 0x17, 0x81, 0xC3, 0x6D, 0x81, 0xC3, 0x7C, 0x81, 0xC3, 0x95, 0x81,
+    0xC5, 0xB2, 0x81, 0xC5, 0xFD, 0x80, 0x63, 0x5C, 0x81, 0xC6, 0x12, 0x81, 0xC7, 0xC9, 0x81, 0xC8, 0x0F, 0x81, 0xC9,
+    0x88, 0x81, 0xCA, 0xC2, 0x80, 0x1E, 0x22, 0x81, 0xCA, 0xF8, 0x81, 0xCC, 0x4A, 0x81, 0xCD, 0xC7, 0x81, 0xCF, 0x4D,
+    0x80, 0x1E, 0x22, 0x81, 0xCF, 0xA8, 0xFF, 0xFF, 0xFF, 0x81, 0xCF, 0xB6, 0x80, 0x1E, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x01, 0xBD, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0xD6, 0xB4, 0x81, 0xD8, 0x91, 0x81, 0xD8, 0xF5, 0x81,
+    0xDB, 0x72, 0x81, 0xE2, 0x32, 0x81, 0xE3, 0x22, 0x81, 0xE5, 0x31, 0x81, 0xE5, 0x93, 0x81, 0xE8, 0x75, 0x81, 0x77,
+    0xDA, 0x81, 0xEA, 0xE2, 0x81, 0xEB, 0x4D, 0x81, 0xEB, 0x84, 0x81, 0xEC, 0xDC, 0x81, 0xEF, 0x3B, 0x81, 0xEF, 0xAA,
+    0x80, 0x1E, 0x22, 0x81, 0xEF, 0xFF, 0x81, 0xF4, 0xF3, 0x81, 0xF8, 0xC2, 0x01, 0xFA, 0x7F, 0x81, 0xFA, 0xDB, 0x81,
+    0xFA, 0xFD, 0x80, 0x1D, 0x70, 0x01, 0xFB, 0x16, 0x81, 0xFC, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0xD8, 0x19, 0xFF, 0xFF, 0xFF, 0x81, 0xFD, 0x88, 0x01, 0xFF, 0x71, 0x02, 0x00, 0xC2, 0x02, 0x01, 0xAC, 0x02, 0x03,
+    0xFB, 0x02, 0x05, 0x88, 0x82, 0x06, 0x6A, 0x02, 0x07, 0xF3, 0x02, 0x08, 0x6F, 0x02, 0x08, 0x9B, 0x82, 0x09, 0x21,
+    0x02, 0x0C, 0x02, 0x02, 0x0D, 0xC9, 0x02, 0x11, 0x5D, 0x82, 0x12, 0x22, 0x02, 0x13, 0xD8, 0xFF, 0xFF, 0xFF, 0x02,
+    0x19, 0xE5, 0x02, 0x1C, 0xBD, 0x02, 0x1F, 0x52, 0x02, 0x20, 0x13, 0x02, 0x20, 0x52, 0x82, 0x20, 0x79, 0x02, 0x20,
+    0xA8, 0x02, 0x20, 0xC9, 0x02, 0x21, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x0C, 0xFF, 0xFF,
+    0xFF, 0x82, 0x24, 0x93, 0x80, 0x1E, 0x22, 0x82, 0x25, 0x94, 0x82, 0x25, 0x9B, 0x82, 0x28, 0x3E, 0x02, 0x2A, 0x69,
+    0x82, 0x2A, 0xAF, 0x82, 0x2B, 0x73, 0x02, 0x2D, 0x41, 0x80, 0x1E, 0x22, 0x82, 0x2D, 0x7B, 0x82, 0x2D, 0xF3, 0x82,
+    0x2E, 0x12, 0x82, 0x2E, 0x1D, 0x82, 0x30, 0x00, 0x82, 0x31, 0x76, 0xFF, 0xFF, 0xFF, 0x82, 0x33, 0x79, 0x02, 0x34,
+    0x23, 0x82, 0x35, 0x94, 0x82, 0x36, 0xC4, 0x80, 0x1E, 0x22, 0x82, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0x37, 0x06,
+    0x80, 0x1E, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x25, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1E, 0x22, 0xFF, 0xFF, 0xFF,
+    0x82, 0x37, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x40, 0x84, 0x82, 0x43, 0xAD, 0x82,
+    0x44, 0x61, 0x82, 0x46, 0xBA, 0x82, 0x50, 0x5E, 0x82, 0x51, 0x59, 0x82, 0x53, 0x73, 0x82, 0x54, 0x28, 0x02, 0x58,
+    0x90, 0x80, 0x1E, 0x22, 0x82, 0x5A, 0x7F, 0x82, 0x5B, 0x46, 0x82, 0x5D, 0x3E, 0x82, 0x5F, 0x50, 0x02, 0x63, 0x12,
+    0x82, 0x63, 0xAD, 0x80, 0x1E, 0x22, 0x82, 0x64, 0xDD, 0x82, 0x68, 0x17, 0x82, 0x6B, 0xD0, 0x02, 0x6E, 0xE7, 0x82,
+    0x6F, 0x46, 0x82, 0x6F, 0x68, 0x80, 0x22, 0x85, 0x82, 0x6F, 0x79, 0x82, 0x70, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x02, 0x42, 0x38, 0xFF, 0xFF, 0xFF, 0x82, 0x76, 0xFB, 0x82, 0x78, 0x77, 0x82, 0x7C, 0xD4, 0x82, 0x7D,
+    0x2C, 0x82, 0x84, 0xEA, 0x82, 0x85, 0x5B, 0x82, 0x85, 0xA3, 0x82, 0x86, 0x58, 0x82, 0x89, 0xA5, 0x81, 0x77, 0xDA,
+    0x82, 0x8B, 0x50, 0x82, 0x8C, 0x01, 0x82, 0x8C, 0x7E, 0x82, 0x8C, 0xB7, 0x82, 0x8E, 0xC8, 0x82, 0x92, 0xC8, 0x81,
+    0x15, 0x33, 0x82, 0x93, 0x40, 0x82, 0x96, 0xD1, 0x02, 0xA2, 0x21, 0x82, 0xA4, 0x50, 0x82, 0xA4, 0xA1, 0x82, 0xA4,
+    0xD4, 0xFF, 0xFF, 0xFF, 0x82, 0xA4, 0xFF, 0x82, 0xA5, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x78,
+    0x26, 0xFF, 0xFF, 0xFF, 0x02, 0xAE, 0xA0, 0x82, 0xB0, 0xAC, 0x82, 0xB0, 0xE9, 0x82, 0xB1, 0x0E, 0x02, 0xBC, 0x05,
+    0x82, 0xBC, 0x70, 0x82, 0xBC, 0xCE, 0x02, 0xBE, 0x7E, 0x02, 0xC3, 0x0C, 0x80, 0x1E, 0x22, 0x82, 0xC3, 0x4E, 0x82,
+    0xC3, 0x92, 0x82, 0xC3, 0xDD, 0x82, 0xC4, 0x08, 0x02, 0xC7, 0xAE, 0x82, 0xC8, 0x0C, 0x80, 0x1E, 0x22, 0x82, 0xCD,
+    0x37, 0x82, 0xD1, 0x86, 0x82, 0xD4, 0x8D, 0x02, 0xD7, 0xBC, 0x82, 0xD8, 0x06, 0x82, 0xD8, 0x34, 0x80, 0x22, 0x85,
+    0x02, 0xD8, 0x48, 0x82, 0xD9, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xB0, 0x6F, 0xFF, 0xFF, 0xFF,
+    0x82, 0xDB, 0x4D, 0x82, 0xDC, 0xA4, 0x82, 0xDE, 0x97, 0x82, 0xDF, 0x1F, 0x02, 0xE3, 0x68, 0x02, 0xE5, 0x73, 0x82,
+    0xE7, 0x51, 0x02, 0xE7, 0xF3, 0x82, 0xE8, 0x81, 0x00, 0x67, 0xCB, 0x02, 0xE9, 0x30, 0x02, 0xEA, 0xF7, 0x02, 0xEC,
+    0xAF, 0x82, 0xF0, 0x96, 0x82, 0xF1, 0x22, 0x02, 0xF1, 0xD2, 0xFF, 0xFF, 0xFF, 0x02, 0xF5, 0x85, 0x02, 0xF9, 0x46,
+    0x82, 0xFC, 0x11, 0x82, 0xFC, 0x5E, 0x02, 0xFC, 0x7B, 0xFF, 0xFF, 0xFF, 0x82, 0xFC, 0x8F, 0x02, 0xFC, 0x9E, 0x82,
+    0xFD, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xDB, 0xB7, 0xFF, 0xFF, 0xFF, 0x02, 0xFE, 0x8D, 0x80,
+    0x1E, 0x5E, 0x80, 0x22, 0x85, 0x82, 0xFE, 0xC2, 0x03, 0x00, 0x50, 0x83, 0x00, 0x91, 0x80, 0x1E, 0x5E, 0x80, 0x22,
+    0x85, 0x03, 0x01, 0x5B, 0x80, 0x1E, 0x22, 0x80, 0x63, 0x5C, 0x83, 0x01, 0x95, 0x83, 0x01, 0xA0, 0x80, 0x22, 0x85,
+    0x03, 0x02, 0x2F, 0x83, 0x02, 0x54, 0x80, 0x1E, 0x22, 0x03, 0x02, 0x65, 0x83, 0x02, 0x83, 0x80, 0x1E, 0x5E, 0x03,
+    0x02, 0xB6, 0x80, 0x1E, 0x22, 0x80, 0x1E, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1E, 0x22, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x02, 0x51, 0xFF, 0xFF, 0xFF, 0x03, 0x05, 0x26, 0x83, 0x05, 0xD8, 0x80, 0x22,
+    0x85, 0x80, 0x1E, 0x22, 0x03, 0x09, 0xCD, 0x80, 0x22, 0x85, 0x80, 0x1E, 0x22, 0x03, 0x0A, 0x11, 0x03, 0x0B, 0x28,
+    0x80, 0x1D, 0x15, 0x80, 0x22, 0x85, 0x80, 0x22, 0x85, 0x80, 0x22, 0x85, 0x83, 0x0B, 0x5A, 0x03, 0x0B, 0xF2, 0x80,
+    0x22, 0x85, 0x80, 0x1E, 0x22, 0x03, 0x0B, 0xFF, 0x83, 0x0C, 0x16, 0x83, 0x0C, 0x2D, 0x03, 0x0C, 0xFC, 0xFF, 0xFF,
+    0xFF, 0x80, 0x1E, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1E, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x03, 0x05, 0xD1, 0xFF, 0xFF, 0xFF, 0x83, 0x0D, 0xC5, 0x80, 0x1E, 0x5E, 0x83, 0x0E, 0x00, 0x83, 0x0E, 0x13,
+    0x83, 0x0E, 0x4C, 0x83, 0x0E, 0x7B, 0x80, 0x1E, 0x5E, 0x80, 0x22, 0x85, 0x83, 0x0E, 0xDB, 0xFF, 0xFF, 0xFF, 0x83,
+    0x0F, 0x0E, 0x83, 0x0F, 0x15, 0x83, 0x0F, 0x28, 0x80, 0x22, 0x85, 0x03, 0x0F, 0x3E, 0x83, 0x0F, 0x81, 0xFF, 0xFF,
+    0xFF, 0x80, 0x22, 0x85, 0x83, 0x0F, 0x98, 0x83, 0x10, 0xB5, 0x83, 0x10, 0xFA, 0x83, 0x11, 0x11, 0x80, 0x1E, 0x22,
+    0xFF, 0xFF, 0xFF, 0x03, 0x11, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x0F, 0x5B,
+    0xFF, 0xFF, 0xFF, 0x03, 0x11, 0xB4, 0x00, 0x25, 0x2A, 0x83, 0x11, 0xE6, 0x03, 0x12, 0x01, 0x83, 0x12, 0x2D, 0x83,
+    0x12, 0x50, 0x03, 0x12, 0x5C, 0x83, 0x12, 0x65, 0x80, 0x63, 0x5C, 0xFF, 0xFF, 0xFF, 0x83, 0x12, 0x6C, 0x03, 0x12,
+    0xE4, 0x83, 0x13, 0x25, 0x83, 0x13, 0x6F, 0x03, 0x13, 0xC5, 0x83, 0x14, 0x20, 0xFF, 0xFF, 0xFF, 0x83, 0x14, 0x64,
+    0x83, 0x14, 0xC3, 0x03, 0x15, 0x05, 0x83, 0x15, 0x13, 0x03, 0x15, 0x1D, 0x03, 0x15, 0x26, 0x80, 0x1D, 0x70, 0x80,
+    0x1D, 0x70, 0x03, 0x15, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x11, 0xDA, 0xFF, 0xFF, 0xFF, 0x03,
+    0x17, 0x0B, 0x83, 0x17, 0xF9, 0x80, 0x22, 0x85, 0x83, 0x18, 0x22, 0x03, 0x1D, 0x6D, 0x83, 0x1D, 0xB6, 0x83, 0x1D,
+    0xDE, 0x83, 0x1D, 0xE3, 0x03, 0x1F, 0x2D, 0x80, 0x1E, 0x22, 0x83, 0x1F, 0x6E, 0x83, 0x1F, 0x96, 0x83, 0x1F, 0xAA,
+    0x83, 0x1F, 0xBA, 0x03, 0x20, 0x79, 0x83, 0x20, 0xBE, 0x80, 0x1E, 0x22, 0x83, 0x20, 0xC5, 0x83, 0x20, 0xE8, 0x83,
+    0x21, 0x85, 0x83, 0x23, 0x2F, 0x80, 0x1E, 0x22, 0x03, 0x24, 0x6D, 0xFF, 0xFF, 0xFF, 0x03, 0x24, 0x87, 0x83, 0x24,
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x17, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x5C, 0xCA, 0x80, 0x23, 0x07,
+    0x00, 0x57, 0x82, 0x00, 0x57, 0x3C, 0x80, 0x1E, 0xFC, 0x80, 0x57, 0xA9, 0x80, 0x57, 0x8E, 0x80, 0x57, 0xB2, 0x00,
+    0x57, 0xAE, 0x80, 0x23, 0x07, 0x80, 0x23, 0x07, 0x80, 0x57, 0xB8, 0x00, 0x57, 0xC2, 0x00, 0x5A, 0xC5, 0x00, 0x62,
+    0x72, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x25, 0xB7,
 };
 
 constexpr SerializedHyphenationPatterns de_patterns = {
@@ -7,7 +7,7 @@
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
 alignas(4) constexpr uint8_t en_us_trie_data[] = {
-    0x00, 0x00, 0x68, 0xF1, 0x2C, 0x22, 0x1F, 0x21, 0x23, 0x2D, 0x37, 0x41, 0x2A, 0x20, 0x4B, 0x2B, 0x35, 0x23, 0x19,
+    0x80, 0x00, 0x68, 0xF1, 0x2C, 0x22, 0x1F, 0x21, 0x23, 0x2D, 0x37, 0x41, 0x2A, 0x20, 0x4B, 0x2B, 0x35, 0x23, 0x19,
     0x2B, 0x0E, 0x29, 0x2D, 0x0F, 0x36, 0x04, 0x19, 0x19, 0x19, 0x0F, 0x17, 0x15, 0x04, 0x0C, 0x0D, 0x18, 0x02, 0x04,
     0x18, 0x03, 0x16, 0x0E, 0x0E, 0x0B, 0x0F, 0x19, 0x05, 0x0F, 0x0E, 0x0F, 0x17, 0x0D, 0x02, 0x0C, 0x19, 0x18, 0x05,
     0x0F, 0x18, 0x18, 0x0C, 0x01, 0x02, 0x0B, 0x04, 0x0B, 0x04, 0x16, 0x04, 0x22, 0x04, 0x0D, 0x02, 0x0D, 0x2D, 0x0E,
@@ -1425,7 +1425,140 @@ alignas(4) constexpr uint8_t en_us_trie_data[] = {
     0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xA0, 0x16, 0xA7, 0x72, 0xAA, 0x96, 0xAE, 0xF7, 0xB3, 0x08, 0xBB,
     0x8C, 0xBD, 0xBA, 0xC0, 0x91, 0xC3, 0x6B, 0xC9, 0xA0, 0xCA, 0x3D, 0xCB, 0x0E, 0xCF, 0xE3, 0xD3, 0xFE, 0xD8, 0xF4,
     0xDF, 0x23, 0xE3, 0x9B, 0xE4, 0x25, 0xEA, 0x8B, 0xF0, 0xDD, 0xF6, 0x7C, 0xFA, 0x00, 0xFC, 0x31, 0xFD, 0x52, 0xFE,
-    0x1F, 0xFF, 0x55, 0xFF, 0xDB,
+    0x1F, 0xFF, 0x55, 0xFF, 0xDB, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x09, 0x07, 0x00,
+    0x10, 0x63, 0x00, 0x13, 0x87, 0x00, 0x17, 0xE8, 0x00, 0x1B, 0xF9, 0x00, 0x24, 0x7D, 0x00, 0x26, 0xAB, 0x00, 0x29,
+    0x82, 0x00, 0x2C, 0x5C, 0x00, 0x32, 0x91, 0x00, 0x33, 0x2E, 0x00, 0x33, 0xFF, 0x00, 0x38, 0xD4, 0x00, 0x3C, 0xEF,
+    0x00, 0x41, 0xE5, 0x00, 0x48, 0x14, 0x00, 0x4C, 0x8C, 0x00, 0x4D, 0x16, 0x00, 0x53, 0x7C, 0x00, 0x59, 0xCE, 0x00,
+    0x5F, 0x6D, 0x00, 0x62, 0xF1, 0x00, 0x65, 0x22, 0x00, 0x66, 0x43, 0x00, 0x67, 0x10, 0x00, 0x68, 0x46, 0x00, 0x68,
+    0xCC, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xEA, 0x00, 0x03, 0x47, 0x00, 0x03, 0xA9, 0x00, 0x03, 0xF9, 0x00, 0x04, 0x72,
+    0x00, 0x04, 0xA5, 0x00, 0x04, 0xD9, 0x00, 0x05, 0x39, 0x00, 0x05, 0x7B, 0x00, 0x05, 0x8B, 0x00, 0x09, 0x02, 0x00,
+    0x05, 0xD8, 0x00, 0x06, 0x5A, 0x00, 0x06, 0x8C, 0x00, 0x06, 0xC2, 0x00, 0x07, 0x12, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+    0x7D, 0x00, 0x07, 0xEE, 0x00, 0x08, 0x6C, 0x00, 0x08, 0xAF, 0x00, 0x08, 0xD3, 0x00, 0x08, 0xE5, 0xFF, 0xFF, 0xFF,
+    0x00, 0x02, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x09, 0x95, 0x00, 0x09, 0xEF, 0x80,
+    0x0A, 0x3E, 0x00, 0x0A, 0x57, 0x80, 0x0A, 0x68, 0x00, 0x0A, 0xA1, 0x00, 0x0A, 0xBA, 0x80, 0x0A, 0xDC, 0x80, 0x0A,
+    0xEE, 0x00, 0x0A, 0xF5, 0x00, 0x0B, 0x54, 0x00, 0x0B, 0xC0, 0x80, 0x0C, 0xDD, 0x80, 0x09, 0x4D, 0x00, 0x0D, 0x59,
+    0x00, 0x0D, 0x72, 0x80, 0x0E, 0x42, 0x00, 0x0E, 0xAB, 0x00, 0x0F, 0x9A, 0x00, 0x0F, 0xE1, 0x00, 0x10, 0x26, 0x00,
+    0x10, 0x37, 0x00, 0x10, 0x4B, 0x00, 0x10, 0x4E, 0x00, 0x10, 0x5C, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xFB, 0x80, 0x11,
+    0x27, 0xFF, 0xFF, 0xFF, 0x80, 0x11, 0x2E, 0x00, 0x11, 0x7F, 0x80, 0x11, 0xA4, 0xFF, 0xFF, 0xFF, 0x80, 0x11, 0xA7,
+    0x00, 0x12, 0x1C, 0x80, 0x0A, 0xEE, 0x80, 0x09, 0xE5, 0x80, 0x12, 0x68, 0x80, 0x11, 0x2E, 0x80, 0x12, 0x75, 0x00,
+    0x12, 0xCB, 0x80, 0x09, 0x4D, 0xFF, 0xFF, 0xFF, 0x00, 0x12, 0xFC, 0x80, 0x13, 0x03, 0x80, 0x13, 0x09, 0x00, 0x13,
+    0x64, 0x80, 0x0A, 0xEE, 0x80, 0x13, 0x7D, 0xFF, 0xFF, 0xFF, 0x00, 0x13, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x14, 0x44, 0xFF, 0xFF, 0xFF, 0x80, 0x14, 0x79, 0xFF, 0xFF, 0xFF, 0x00, 0x14, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x15, 0x52, 0x80, 0x15, 0xCF, 0xFF, 0xFF, 0xFF, 0x80, 0x15, 0xFC, 0x80, 0x16, 0x26, 0xFF, 0xFF,
+    0xFF, 0x80, 0x09, 0x50, 0x80, 0x16, 0x93, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0xEE, 0x00, 0x17, 0x1F, 0x80, 0x17, 0x2F,
+    0x80, 0x17, 0x5A, 0x00, 0x17, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x17, 0xE5, 0x00,
+    0x02, 0xB9, 0xFF, 0xFF, 0xFF, 0x80, 0x18, 0x4D, 0x80, 0x0A, 0xEE, 0x80, 0x09, 0x50, 0x80, 0x18, 0x7E, 0x00, 0x19,
+    0x7B, 0x80, 0x11, 0x2E, 0x00, 0x19, 0xB8, 0x80, 0x19, 0xC5, 0x00, 0x1A, 0x45, 0x80, 0x0A, 0xEE, 0x80, 0x1A, 0x76,
+    0x00, 0x1A, 0x97, 0x80, 0x0A, 0xEE, 0x80, 0x1A, 0xAA, 0x80, 0x1A, 0xDA, 0x80, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0x80,
+    0x1B, 0x69, 0x80, 0x1B, 0x7E, 0x00, 0x1B, 0x8E, 0x80, 0x1B, 0xCB, 0x80, 0x0A, 0xEE, 0x80, 0x0A, 0xEE, 0xFF, 0xFF,
+    0xFF, 0x80, 0x1B, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1C, 0xBA, 0x80, 0x1C, 0xEE, 0x00, 0x1D, 0x74,
+    0x00, 0x1D, 0xD2, 0x00, 0x1D, 0xFB, 0x80, 0x1E, 0x53, 0x00, 0x1E, 0x80, 0x80, 0x1E, 0x96, 0x80, 0x1E, 0xB6, 0x80,
+    0x1E, 0xD7, 0x00, 0x1E, 0xE0, 0x00, 0x1F, 0x86, 0x00, 0x1F, 0xFB, 0x00, 0x20, 0x88, 0x00, 0x20, 0xCF, 0x00, 0x21,
+    0x37, 0x80, 0x21, 0x63, 0x00, 0x22, 0x3C, 0x00, 0x23, 0x34, 0x00, 0x23, 0xB2, 0x80, 0x23, 0xE7, 0x00, 0x24, 0x3E,
+    0x00, 0x24, 0x62, 0x00, 0x24, 0x6F, 0x00, 0x24, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x24, 0xF2, 0x80,
+    0x13, 0x7D, 0xFF, 0xFF, 0xFF, 0x80, 0x09, 0x4D, 0x00, 0x25, 0x3D, 0x80, 0x25, 0x6A, 0xFF, 0xFF, 0xFF, 0x80, 0x09,
+    0x4D, 0x80, 0x25, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x26, 0x25, 0x80, 0x09, 0x4D, 0x80, 0x09, 0x4D,
+    0x80, 0x26, 0x59, 0x80, 0x13, 0x7D, 0xFF, 0xFF, 0xFF, 0x00, 0x26, 0x72, 0x80, 0x11, 0xBE, 0x80, 0x26, 0x7F, 0x80,
+    0x26, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x17, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x27, 0x11, 0x80, 0x09, 0xCB, 0xFF, 0xFF, 0xFF, 0x80, 0x09, 0xE5, 0x00, 0x27, 0x78, 0xFF, 0xFF, 0xFF,
+    0x80, 0x27, 0x97, 0x00, 0x27, 0xB2, 0x00, 0x27, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x28, 0x4D, 0x80,
+    0x28, 0x58, 0x00, 0x28, 0x9C, 0x80, 0x28, 0xCD, 0x80, 0x09, 0xCB, 0xFF, 0xFF, 0xFF, 0x80, 0x29, 0x31, 0x80, 0x29,
+    0x43, 0x00, 0x29, 0x49, 0x00, 0x29, 0x63, 0xFF, 0xFF, 0xFF, 0x80, 0x09, 0xCB, 0xFF, 0xFF, 0xFF, 0x80, 0x29, 0x79,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2A, 0x38, 0x80, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x2A, 0xBF, 0x80, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0xEE, 0x00, 0x2B, 0x2C, 0xFF, 0xFF, 0xFF, 0x80, 0x09,
+    0x4D, 0x80, 0x2B, 0x57, 0x80, 0x2B, 0x60, 0x80, 0x2B, 0x6D, 0x00, 0x2B, 0xD4, 0x80, 0x13, 0x7D, 0xFF, 0xFF, 0xFF,
+    0x80, 0x2B, 0xF0, 0x80, 0x2B, 0xF9, 0x00, 0x2C, 0x11, 0x00, 0x2C, 0x28, 0xFF, 0xFF, 0xFF, 0x80, 0x2C, 0x3C, 0xFF,
+    0xFF, 0xFF, 0x00, 0x2C, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2C, 0xBA, 0x00, 0x2C, 0xF8, 0x00, 0x2D,
+    0x65, 0x80, 0x2D, 0xC1, 0x80, 0x2D, 0xFA, 0x00, 0x2E, 0x2E, 0x80, 0x2E, 0x81, 0x80, 0x09, 0xCB, 0x80, 0x2E, 0x9F,
+    0x80, 0x2E, 0xA2, 0x80, 0x09, 0x4D, 0x00, 0x2E, 0xDE, 0x00, 0x2F, 0x39, 0x00, 0x2F, 0xF8, 0x80, 0x30, 0x48, 0x80,
+    0x30, 0x7D, 0x00, 0x30, 0xA3, 0x80, 0x30, 0xEB, 0x00, 0x31, 0x77, 0x00, 0x32, 0x32, 0x80, 0x0A, 0xEE, 0x80, 0x32,
+    0x77, 0x80, 0x13, 0x7D, 0x00, 0x0C, 0x84, 0x80, 0x09, 0x4D, 0x00, 0x32, 0x87, 0xFF, 0xFF, 0xFF, 0x80, 0x32, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x33, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x33, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x33, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x33, 0x37, 0x80, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x33, 0x5F, 0x80, 0x09,
+    0xCB, 0xFF, 0xFF, 0xFF, 0x80, 0x09, 0xE5, 0x80, 0x33, 0xA5, 0xFF, 0xFF, 0xFF, 0x80, 0x09, 0xE5, 0x80, 0x33, 0xC1,
+    0x80, 0x0A, 0xEE, 0x00, 0x33, 0xCA, 0x00, 0x33, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x33, 0xE8, 0x80,
+    0x33, 0xF0, 0x80, 0x09, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x34, 0x82, 0x80, 0x34, 0xA4, 0x80, 0x34, 0xBA, 0x80, 0x34, 0xDE,
+    0x00, 0x35, 0x90, 0x80, 0x35, 0xB5, 0x80, 0x35, 0xC1, 0x80, 0x11, 0xBE, 0x00, 0x36, 0x58, 0x80, 0x09, 0x4D, 0x00,
+    0x36, 0x92, 0x80, 0x36, 0xD5, 0x80, 0x36, 0xFB, 0x80, 0x37, 0x07, 0x00, 0x37, 0x8A, 0x80, 0x37, 0xC6, 0xFF, 0xFF,
+    0xFF, 0x80, 0x11, 0x2E, 0x80, 0x37, 0xD8, 0x80, 0x38, 0x18, 0x00, 0x38, 0x74, 0x00, 0x38, 0xA3, 0x80, 0x18, 0xBE,
+    0xFF, 0xFF, 0xFF, 0x80, 0x38, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x39, 0xB1, 0x80, 0x39, 0xE5, 0x80,
+    0x13, 0x7D, 0xFF, 0xFF, 0xFF, 0x00, 0x3A, 0x8B, 0x80, 0x11, 0x2E, 0xFF, 0xFF, 0xFF, 0x80, 0x11, 0xA4, 0x00, 0x3B,
+    0x41, 0xFF, 0xFF, 0xFF, 0x80, 0x09, 0x4D, 0x80, 0x11, 0x2E, 0x80, 0x3B, 0x6A, 0x80, 0x3B, 0x73, 0x80, 0x3C, 0x26,
+    0x80, 0x3C, 0x90, 0xFF, 0xFF, 0xFF, 0x80, 0x11, 0xA7, 0x80, 0x3C, 0xB6, 0x80, 0x09, 0x4D, 0x80, 0x3C, 0xDA, 0xFF,
+    0xFF, 0xFF, 0x80, 0x09, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3D,
+    0x99, 0x80, 0x1A, 0xAA, 0x00, 0x3D, 0xED, 0x00, 0x3E, 0x32, 0x00, 0x3E, 0xBA, 0x80, 0x3E, 0xFB, 0x00, 0x3F, 0x44,
+    0x80, 0x3F, 0x66, 0x00, 0x3F, 0xB9, 0x80, 0x0A, 0xEE, 0x80, 0x3F, 0xE9, 0x80, 0x3F, 0xF8, 0x80, 0x40, 0x04, 0x80,
+    0x40, 0x10, 0x00, 0x40, 0xD9, 0x80, 0x41, 0x0E, 0x80, 0x0A, 0xEE, 0x80, 0x41, 0x17, 0x80, 0x41, 0x41, 0x80, 0x41,
+    0x90, 0x00, 0x41, 0xBC, 0x80, 0x19, 0xC5, 0x80, 0x1C, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x41, 0xD8, 0x80, 0x41, 0xDF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x42, 0x3F, 0x00, 0x42, 0x6A, 0x00, 0x42, 0xB5, 0x00, 0x42, 0xFD, 0x00, 0x43, 0x17, 0x00,
+    0x43, 0x33, 0x00, 0x43, 0x74, 0x80, 0x43, 0x8D, 0x80, 0x43, 0xB3, 0x80, 0x09, 0x50, 0x80, 0x43, 0xD5, 0x00, 0x44,
+    0x67, 0x00, 0x44, 0xF1, 0x80, 0x45, 0x7D, 0x80, 0x45, 0xAF, 0x00, 0x45, 0xF4, 0x80, 0x0A, 0xEE, 0x00, 0x46, 0xA1,
+    0x00, 0x47, 0x15, 0x00, 0x47, 0x7D, 0x80, 0x47, 0xA6, 0x00, 0x47, 0xE3, 0x00, 0x47, 0xF1, 0x00, 0x48, 0x11, 0x00,
+    0x48, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x48, 0xED, 0x80, 0x11, 0x2E, 0xFF, 0xFF, 0xFF, 0x80, 0x09,
+    0xE5, 0x00, 0x49, 0x80, 0x80, 0x09, 0x4D, 0x80, 0x09, 0x4D, 0x00, 0x49, 0xED, 0x00, 0x4A, 0x5B, 0xFF, 0xFF, 0xFF,
+    0x80, 0x4A, 0x77, 0x80, 0x4A, 0xA7, 0x80, 0x11, 0x2E, 0x80, 0x11, 0xBE, 0x00, 0x4B, 0x07, 0x80, 0x4B, 0x45, 0xFF,
+    0xFF, 0xFF, 0x80, 0x4B, 0xEB, 0x80, 0x4C, 0x0F, 0x80, 0x4C, 0x34, 0x00, 0x4C, 0x70, 0xFF, 0xFF, 0xFF, 0x80, 0x09,
+    0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x4D, 0x0D,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x4D, 0xAE, 0x80, 0x4E, 0x02, 0x80, 0x4E, 0x26, 0x00, 0x4E, 0x47, 0x00, 0x4F, 0x40, 0x80, 0x4F, 0x77, 0x80, 0x4F,
+    0x9A, 0x80, 0x4F, 0xAC, 0x00, 0x50, 0x75, 0x80, 0x09, 0xCB, 0x00, 0x50, 0xBB, 0x80, 0x50, 0xE8, 0x80, 0x51, 0x10,
+    0x00, 0x51, 0x42, 0x00, 0x51, 0xDE, 0x80, 0x52, 0x25, 0xFF, 0xFF, 0xFF, 0x80, 0x52, 0x52, 0x80, 0x52, 0x96, 0x00,
+    0x52, 0xFD, 0x00, 0x53, 0x24, 0x00, 0x53, 0x5D, 0x80, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0x00, 0x53, 0x6B, 0x00, 0x53,
+    0x79, 0xFF, 0xFF, 0xFF, 0x80, 0x54, 0x13, 0x80, 0x13, 0x7D, 0x00, 0x54, 0xC4, 0x80, 0x13, 0x7D, 0x00, 0x55, 0x89,
+    0x80, 0x11, 0xA7, 0x80, 0x11, 0xBE, 0x80, 0x55, 0xE7, 0x00, 0x56, 0x49, 0xFF, 0xFF, 0xFF, 0x80, 0x56, 0x88, 0x80,
+    0x56, 0xA7, 0x80, 0x56, 0xD4, 0x80, 0x1C, 0x3F, 0x80, 0x57, 0x30, 0x00, 0x57, 0xC1, 0x00, 0x57, 0xE4, 0x80, 0x0A,
+    0xEE, 0x80, 0x58, 0x3F, 0x00, 0x59, 0x37, 0x80, 0x59, 0x78, 0x80, 0x09, 0x4D, 0x80, 0x59, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x59, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x5A, 0xA9, 0x80, 0x18, 0xBE, 0x80, 0x5A, 0xF5, 0x80,
+    0x11, 0x2E, 0x00, 0x5B, 0xAF, 0x80, 0x18, 0xBE, 0x80, 0x11, 0x2E, 0x00, 0x5C, 0x5E, 0x00, 0x5C, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x5D, 0x49, 0x80, 0x5D, 0x58, 0x80, 0x37, 0x07, 0x80, 0x5D, 0xA4, 0x80, 0x11, 0x2E,
+    0xFF, 0xFF, 0xFF, 0x00, 0x5E, 0xB5, 0x80, 0x5E, 0xCB, 0x80, 0x5E, 0xE6, 0x80, 0x5F, 0x20, 0x80, 0x09, 0x4D, 0x80,
+    0x5F, 0x44, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0x61, 0x80, 0x1B, 0xB9, 0xFF, 0xFF, 0xFF, 0x00, 0x5F, 0xD8, 0x00, 0x60,
+    0x0A, 0x00, 0x60, 0x18, 0x00, 0x60, 0x52, 0x00, 0x60, 0x77, 0x00, 0x60, 0x7E, 0x00, 0x60, 0x89, 0xFF, 0xFF, 0xFF,
+    0x80, 0x60, 0xA0, 0x80, 0x09, 0x50, 0x80, 0x09, 0x4D, 0x00, 0x60, 0xFA, 0x00, 0x61, 0x33, 0x00, 0x61, 0x6C, 0x00,
+    0x61, 0x85, 0x00, 0x61, 0xAF, 0xFF, 0xFF, 0xFF, 0x00, 0x62, 0x12, 0x80, 0x62, 0x6C, 0x00, 0x62, 0xD8, 0x80, 0x62,
+    0xEB, 0x80, 0x19, 0xC5, 0xFF, 0xFF, 0xFF, 0x00, 0x15, 0x47, 0xFF, 0xFF, 0xFF, 0x00, 0x0A, 0x24, 0xFF, 0xFF, 0xFF,
+    0x80, 0x63, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x64, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x64, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x65, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0x6D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x65, 0x64, 0x80, 0x0A, 0xEE, 0x80, 0x09, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x65,
+    0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xE2, 0x80, 0x65, 0xD5, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0x6D,
+    0x00, 0x65, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0x6A, 0x80, 0x66, 0x06, 0x80, 0x09, 0x50, 0xFF, 0xFF, 0xFF, 0x00,
+    0x66, 0x31, 0x00, 0x66, 0x36, 0x80, 0x09, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x09, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x66, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x66, 0x97,
+    0xFF, 0xFF, 0xFF, 0x80, 0x66, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x66, 0xBA, 0x80, 0x66, 0xCC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x21, 0x15, 0x80, 0x66,
+    0xF0, 0x80, 0x67, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x66, 0xF7, 0x80, 0x66, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x09, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x67, 0x32, 0x80,
+    0x0A, 0xEE, 0x80, 0x67, 0x50, 0x80, 0x0A, 0xEE, 0x00, 0x67, 0x71, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x1C, 0x80, 0x11,
+    0xA7, 0x80, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x67, 0x7E, 0x00, 0x67, 0x9F, 0x00, 0x67, 0xA9,
+    0x80, 0x67, 0xC0, 0x00, 0x67, 0xEA, 0xFF, 0xFF, 0xFF, 0x00, 0x67, 0xFA, 0x00, 0x68, 0x1E, 0x00, 0x68, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x68, 0x7A, 0x80, 0x09, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x68, 0x8B, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x68, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0x44, 0x80,
+    0x09, 0x4D, 0xFF, 0xFF, 0xFF, 0x80, 0x68, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x02, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x68, 0xC3, 0x00, 0x00, 0x69, 0x43,
 };
 
 constexpr SerializedHyphenationPatterns en_us_patterns = {
@@ -7,7 +7,7 @@
 
 // Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
 alignas(4) constexpr uint8_t es_trie_data[] = {
-    0x00, 0x00, 0x34, 0xFC, 0x01, 0x04, 0x16, 0x02, 0x0E, 0x0C, 0x02, 0x16, 0x02, 0x0D, 0x0C, 0x22, 0x0F, 0x2C, 0x0F,
+    0x80, 0x00, 0x34, 0xFC, 0x01, 0x04, 0x16, 0x02, 0x0E, 0x0C, 0x02, 0x16, 0x02, 0x0D, 0x0C, 0x22, 0x0F, 0x2C, 0x0F,
     0x22, 0x0D, 0x2C, 0x0D, 0x0B, 0x16, 0x0B, 0x20, 0x15, 0x16, 0x15, 0x0C, 0x02, 0x0C, 0x17, 0x0E, 0x04, 0x2C, 0x05,
     0x04, 0x0D, 0x04, 0x21, 0x04, 0x18, 0x0D, 0x04, 0x17, 0x04, 0x0D, 0x17, 0x04, 0x0E, 0x0D, 0x04, 0x0D, 0x21, 0x04,
     0x0D, 0x21, 0x21, 0x0F, 0x0E, 0x0F, 0x0E, 0x0D, 0x0F, 0x0E, 0x17, 0x33, 0x33, 0x0C, 0x33, 0x16, 0x29, 0x29, 0x0C,
@@ -725,7 +725,198 @@ alignas(4) constexpr uint8_t es_trie_data[] = {
     0x79, 0x7A, 0xC3, 0x6F, 0x61, 0x65, 0x69, 0x75, 0xCD, 0x5C, 0xDB, 0x8C, 0xDD, 0xF1, 0xE3, 0xC6, 0xE4, 0x43, 0xE5,
     0xC4, 0xE7, 0x42, 0xE7, 0x94, 0xE7, 0xDD, 0xE8, 0x9B, 0xE9, 0xD6, 0xEA, 0x67, 0xED, 0x21, 0xED, 0x83, 0xEE, 0x2C,
     0xF0, 0x08, 0xF2, 0x7F, 0xF2, 0xDD, 0xF3, 0x29, 0xF3, 0x78, 0xF3, 0xC3, 0xF4, 0x0C, 0xF6, 0x24, 0xF7, 0x4C, 0xF9,
-    0x4F, 0xFD, 0x7C, 0xFF, 0xB0, 0xFF, 0xF9,
+    0x4F, 0xFD, 0x7C, 0xFF, 0xB0, 0xFF, 0xF9, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF, 0xFF, 0x1D, 0xFF, 0xFF, 0xFF, 0x1E, 0xFF, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10,
+    0x88, 0x00, 0x2E, 0x4B, 0x80, 0x02, 0x58, 0x80, 0x12, 0xED, 0x80, 0x18, 0xC2, 0x00, 0x32, 0x78, 0x80, 0x19, 0x3F,
+    0x80, 0x1A, 0xC0, 0x00, 0x1C, 0x3E, 0x00, 0x34, 0xAC, 0x80, 0x1C, 0x90, 0x80, 0x1C, 0xD9, 0x80, 0x1D, 0x97, 0x80,
+    0x1E, 0xD2, 0x80, 0x1F, 0x63, 0x00, 0x2C, 0x48, 0x80, 0x22, 0x1D, 0x80, 0x22, 0x7F, 0x80, 0x23, 0x28, 0x80, 0x25,
+    0x04, 0x80, 0x27, 0x7B, 0x00, 0x34, 0xF5, 0x80, 0x27, 0xD9, 0x80, 0x28, 0x25, 0x80, 0x28, 0x74, 0x80, 0x28, 0xBF,
+    0x80, 0x29, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x2B, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x0D, 0x49, 0x80, 0x03, 0x01, 0x80, 0x04, 0x59, 0x80, 0x04, 0xDB, 0x00, 0x0E,
+    0x4C, 0x80, 0x04, 0xE2, 0x80, 0x04, 0xE2, 0x00, 0x0C, 0xDB, 0x00, 0x10, 0x85, 0x80, 0x04, 0xE2, 0x80, 0x04, 0xE2,
+    0x80, 0x04, 0xE2, 0x80, 0x05, 0x4C, 0x80, 0x04, 0xE2, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xD6, 0x80, 0x04, 0xE2, 0x80,
+    0x0A, 0x4A, 0x80, 0x0C, 0x1A, 0x80, 0x0C, 0xBB, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0xE2, 0x80, 0x04, 0xE2, 0x80, 0x04,
+    0xE2, 0x80, 0x04, 0xE2, 0x80, 0x04, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00, 0x2C, 0x70, 0x00, 0x2D, 0x98, 0x00, 0x2D, 0xF2, 0x00,
+    0x2D, 0xBA, 0x00, 0x2D, 0xFC, 0x00, 0x2E, 0x13, 0x00, 0x2D, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x2C, 0x83, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2E, 0x30, 0x00, 0x2C, 0xCC, 0x00, 0x2C, 0xDA, 0x00, 0x29, 0x56, 0x00, 0x2E, 0x1A,
+    0xFF, 0xFF, 0xFF, 0x00, 0x2D, 0x73, 0x00, 0x2C, 0xA4, 0x00, 0x2C, 0xEA, 0x00, 0x2E, 0x22, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2E, 0x48, 0x80, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0x00,
+    0x02, 0x1F, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0x39, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01, 0x20, 0x80, 0x01, 0x42, 0x00, 0x02, 0x55,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00, 0x12,
+    0x29, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0x00, 0x12, 0x87, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x34,
+    0x80, 0x10, 0xFC, 0x00, 0x12, 0xCE, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x11, 0x48, 0x80, 0x01, 0x34, 0x80,
+    0x10, 0xDE, 0x00, 0x12, 0x06, 0x80, 0x01, 0x39, 0x80, 0x01, 0x20, 0x80, 0x11, 0x9B, 0x80, 0x01, 0x20, 0x80, 0x10,
+    0xEA, 0x00, 0x12, 0x41, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x10, 0xF6,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x12, 0xEA, 0x80,
+    0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0x00, 0x18, 0x9E, 0x80, 0x01,
+    0x2F, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0x00, 0x18, 0xBF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x39, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x42, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00, 0x30, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x30, 0xF5, 0x00, 0x30, 0x80, 0x00,
+    0x30, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x32, 0x73, 0x00, 0x2E, 0xBE, 0x00, 0x2E, 0xDE, 0x00, 0x2E, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x30, 0x5E, 0x00, 0x2E, 0xA6, 0x00, 0x31, 0x02, 0x00, 0x31, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x32, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x30, 0xD3, 0x80, 0x01, 0x1D, 0x00, 0x19, 0x3C, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x00, 0x19, 0x0D, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x00, 0x19, 0x18, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x00, 0x19, 0x22, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01, 0x20, 0x80, 0x10, 0xF6, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00, 0x1A, 0x7D, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x00, 0x1A, 0xA1, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x00, 0x1A, 0xB1, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x19, 0x90, 0x80, 0x01, 0x20, 0x80, 0x10, 0xF6, 0x00,
+    0x1A, 0x6C, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x1A, 0x0F, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x00, 0x1A,
+    0xBD, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00,
+    0x1B, 0x4E, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x00, 0x1B, 0xA0, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x00, 0x1C, 0x26, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x00, 0x1C, 0x37, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0x00, 0x1B, 0x34, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x34, 0x90, 0x00, 0x34, 0x65, 0x00, 0x34, 0x73, 0x00, 0x33, 0x30, 0x00, 0x34, 0xA1, 0xFF,
+    0xFF, 0xFF, 0x00, 0x33, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x34, 0x46, 0x00, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x33, 0x57, 0x00, 0x34, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x00, 0x1C, 0xD5,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0x00, 0x1D, 0x66, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x34, 0x80, 0x01,
+    0x20, 0x00, 0x1D, 0x7D, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x1D, 0x21, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20,
+    0x00, 0x1D, 0x94, 0x80, 0x01, 0x39, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x42, 0xFF,
+    0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D,
+    0x00, 0x1E, 0x72, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0x00, 0x1E, 0x22, 0x80, 0x01, 0x2F, 0x80,
+    0x01, 0x34, 0x80, 0x01, 0x20, 0x00, 0x1E, 0xB4, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x34, 0x80, 0x10, 0xF6, 0x00, 0x1E, 0xC8, 0x80, 0x01, 0x39, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x42, 0x00, 0x1E, 0xC5, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0x1D, 0x00, 0x1F, 0x49, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0x00, 0x1F, 0x53,
+    0x80, 0x01, 0x2F, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0x00, 0x1F, 0x42, 0x80, 0x01, 0x39, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x1F, 0x32, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00, 0x2B, 0x3E, 0xFF, 0xFF, 0xFF, 0x00, 0x2B, 0xBC, 0xFF, 0xFF,
+    0xFF, 0x00, 0x2B, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2C, 0x43, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x2B, 0x83, 0x00, 0x2B, 0xBF, 0x00, 0x2B, 0xC3, 0x00, 0x2C, 0x08, 0x00, 0x2B, 0xCD, 0xFF,
+    0xFF, 0xFF, 0x00, 0x2B, 0xFD, 0x00, 0x2B, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x2B, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00, 0x21, 0x25, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0x00, 0x20, 0xB2, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x00, 0x21,
+    0x30, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x1F, 0xDE, 0x80, 0x01, 0x20, 0x80, 0x10, 0xF6, 0x00, 0x22, 0x13,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x20, 0x34, 0x80, 0x1F, 0xBE, 0x80, 0x1F, 0xC7, 0x00, 0x20, 0x83, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0xFF, 0xFF, 0xFF,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x00, 0x22, 0x78, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+    0x1D, 0x00, 0x23, 0x1A, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0x00, 0x23, 0x02, 0x80, 0x01, 0x2F,
+    0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80,
+    0x22, 0xC7, 0x80, 0x01, 0x20, 0x00, 0x23, 0x24, 0x80, 0x01, 0x39, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x42, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00, 0x23, 0xEC, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0x00, 0x24,
+    0x2A, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0x00, 0x24, 0x63, 0x80, 0x23, 0x76, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x23, 0xCC, 0x00, 0x24, 0xFD, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0x00, 0x27, 0x5C, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26, 0x80,
+    0x01, 0x20, 0x00, 0x27, 0x3F, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0x00, 0x27, 0x59, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x27, 0x2A, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0x00, 0x27, 0x60, 0x80, 0x01, 0x39,
+    0x80, 0x01, 0x20, 0x80, 0x26, 0xC9, 0x80, 0x27, 0x24, 0x80, 0x01, 0x42, 0x00, 0x27, 0x68, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0x80, 0x27, 0x2A, 0x80, 0x01, 0x20, 0x80, 0x27, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x27, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x34, 0xD5, 0xFF, 0xFF, 0xFF, 0x00, 0x34, 0xF2, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x34, 0xD2, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x00, 0x27, 0xD2, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x4C, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x01, 0x1D, 0x00, 0x28, 0x21, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26, 0x80, 0x01, 0x20, 0x00,
+    0x28, 0x6D, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0x00, 0x1C, 0xD5, 0x80, 0x01, 0x20, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x39, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x42, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x26,
+    0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x2F, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80,
+    0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x34, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+    0x39, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x42, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20,
+    0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+    0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20,
+    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x00,
+    0x29, 0x04, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF,
+    0xFF, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0x80, 0x01, 0x20, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x2A, 0xE5, 0x00, 0x29, 0xC4, 0x00, 0x2A, 0x29, 0x80, 0x29, 0x50, 0x00, 0x2B, 0x10, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x35, 0x51,
 };
 
 constexpr SerializedHyphenationPatterns es_patterns = {
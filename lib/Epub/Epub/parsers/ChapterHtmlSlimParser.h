@@ -8,6 +8,7 @@
 
 #include "../ParsedText.h"
 #include "../blocks/TextBlock.h"
+#include "../css/CssAncestors.h"
 #include "../css/CssParser.h"
 #include "../css/CssStyle.h"
 
@@ -32,6 +33,7 @@ class ChapterHtmlSlimParser {
   int partWordBufferIndex = 0;
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  bool currentTextBlockStarted = false;  // true once the block's top spacing is on the page
   std::unique_ptr<Page> currentPage = nullptr;
   int16_t currentPageNextY = 0;
   int fontId;
@@ -42,6 +44,7 @@ class ChapterHtmlSlimParser {
   uint16_t viewportHeight;
   bool hyphenationEnabled;
   const CssParser* cssParser;
+  std::unique_ptr<CssAncestors> cssAncestors;  // Open elements, while the stylesheets have descendant selectors
   bool embeddedStyle;
 
   // Style tracking (replaces depth-based approach)
@@ -60,6 +63,7 @@ class ChapterHtmlSlimParser {
   void updateEffectiveInlineStyle();
   void startNewTextBlock(const BlockStyle& blockStyle);
   void flushPartWordBuffer();
+  void layoutTextBlock(bool blockComplete);
   void makePages();
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
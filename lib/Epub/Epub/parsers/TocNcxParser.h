@@ -29,6 +29,8 @@ class TocNcxParser final : public Print {
   ~TocNcxParser() override;
 
   bool setup();
+  // False if setup failed or the document didn't parse, anything written after an error is ignored
+  bool ok() const { return parser != nullptr; }
 
   size_t write(uint8_t) override;
   size_t write(const uint8_t* buffer, size_t size) override;
@@ -19,7 +19,7 @@ Bitmap::~Bitmap() {
   delete fsDitherer;
 }
 
-uint16_t Bitmap::readLE16(FsFile& f) {
+uint16_t Bitmap::readLE16(HalFile& f) {
   const int c0 = f.read();
   const int c1 = f.read();
   const auto b0 = static_cast<uint8_t>(c0 < 0 ? 0 : c0);
@@ -27,7 +27,7 @@ uint16_t Bitmap::readLE16(FsFile& f) {
   return static_cast<uint16_t>(b0) | (static_cast<uint16_t>(b1) << 8);
 }
 
-uint32_t Bitmap::readLE32(FsFile& f) {
+uint32_t Bitmap::readLE32(HalFile& f) {
   const int c0 = f.read();
   const int c1 = f.read();
   const int c2 = f.read();
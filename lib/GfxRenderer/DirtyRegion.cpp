@@ -0,0 +1,76 @@
+#include "DirtyRegion.h"
+
+#include <algorithm>
+
+namespace {
+DirtyRegion::Rect unite(const DirtyRegion::Rect& a, const DirtyRegion::Rect& b) {
+  return DirtyRegion::Rect{std::min(a.x0, b.x0), std::min(a.y0, b.y0), std::max(a.x1, b.x1), std::max(a.y1, b.y1)};
+}
+
+bool isNear(const DirtyRegion::Rect& a, const DirtyRegion::Rect& b) {
+  return a.x0 <= b.x1 + DirtyRegion::MERGE_GAP && b.x0 <= a.x1 + DirtyRegion::MERGE_GAP &&
+         a.y0 <= b.y1 + DirtyRegion::MERGE_GAP && b.y0 <= a.y1 + DirtyRegion::MERGE_GAP;
+}
+}  // namespace
+
+void DirtyRegion::addSlow(const int x0, const int y0, const int x1, const int y1) {
+  // Whole framebuffer bytes, as windowed refreshes need byte-aligned columns anyway
+  Rect rect{static_cast<int16_t>(x0 & ~7), static_cast<int16_t>(y0), static_cast<int16_t>(x1 | 7),
+            static_cast<int16_t>(y1)};
+
+  // Absorb every rectangle the new one touches. A merge can bring others into reach, so rescan until stable.
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (int i = 0; i < count; i++) {
+      if (isNear(rects[i], rect)) {
+        rect = unite(rects[i], rect);
+        removeAt(i);
+        merged = true;
+        break;
+      }
+    }
+
+    if (!merged && count == MAX_RECTS) {
+      // Out of slots: merge with the rectangle that grows the least
+      int best = 0;
+      int32_t bestGrowth = INT32_MAX;
+      for (int i = 0; i < count; i++) {
+        const int32_t growth = unite(rects[i], rect).area() - rects[i].area();
+        if (growth < bestGrowth) {
+          bestGrowth = growth;
+          best = i;
+        }
+      }
+      rect = unite(rects[best], rect);
+      removeAt(best);
+      merged = true;
+    }
+  }
+
+  rects[count] = rect;
+  lastAdded = count;
+  count++;
+}
+
+void DirtyRegion::add(const DirtyRegion& other) {
+  for (int i = 0; i < other.count; i++) {
+    add(other.rects[i].x0, other.rects[i].y0, other.rects[i].x1, other.rects[i].y1);
+  }
+}
+
+DirtyRegion::Rect DirtyRegion::bounds() const {
+  if (count == 0) {
+    return Rect{0, 0, -1, -1};
+  }
+  Rect result = rects[0];
+  for (int i = 1; i < count; i++) {
+    result = unite(result, rects[i]);
+  }
+  return result;
+}
+
+void DirtyRegion::removeAt(const int index) {
+  rects[index] = rects[count - 1];
+  count--;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+// A small set of rectangles, in physical panel coordinates, covering the pixels touched by draw calls.
+// Rectangles are widened to whole framebuffer bytes and coalesced as they are added, so a run of glyphs or a list row
+// ends up as a single rectangle whatever the logical orientation.
+class DirtyRegion {
+ public:
+  static constexpr int MAX_RECTS = 8;
+  // Rectangles closer than this are merged, e.g. words separated by spaces
+  static constexpr int MERGE_GAP = 8;
+
+  struct Rect {
+    int16_t x0;  // Inclusive
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+
+    bool contains(const int left, const int top, const int right, const int bottom) const {
+      return left >= x0 && top >= y0 && right <= x1 && bottom <= y1;
+    }
+    int32_t area() const { return static_cast<int32_t>(x1 - x0 + 1) * (y1 - y0 + 1); }
+  };
+
+  // Adds a rectangle of physical pixels (inclusive bounds, already clipped to the panel)
+  void add(const int x0, const int y0, const int x1, const int y1) {
+    // Consecutive pixels of a bitmap or glyph mostly land in the rectangle that grew last
+    if (count > 0 && rects[lastAdded].contains(x0, y0, x1, y1)) {
+      return;
+    }
+    addSlow(x0, y0, x1, y1);
+  }
+  void add(const DirtyRegion& other);
+  void clear() { count = 0; }
+
+  bool isEmpty() const { return count == 0; }
+  int size() const { return count; }
+  const Rect& operator[](const int index) const { return rects[index]; }
+  Rect bounds() const;
+
+ private:
+  Rect rects[MAX_RECTS];
+  int count = 0;
+  int lastAdded = 0;
+
+  void addSlow(int x0, int y0, int x1, int y1);
+  void removeAt(int index);
+};
@@ -0,0 +1,41 @@
+#include "FontRegistry.h"
+
+FontRegistry::FontRegistry() {
+  families.reserve(MAX_FONTS);
+  for (auto& bucket : table) {
+    bucket = NO_SLOT;
+  }
+}
+
+bool FontRegistry::insert(const int fontId, const EpdFontFamily& family) {
+  if (slotOf(fontId) != NO_SLOT) {
+    return true;
+  }
+  if (size() >= MAX_FONTS) {
+    return false;
+  }
+
+  const int slot = size();
+  ids[slot] = fontId;
+  families.push_back(family);
+
+  int bucket = bucketOf(fontId);
+  while (table[bucket] != NO_SLOT) {
+    bucket = (bucket + 1) & (TABLE_SIZE - 1);
+  }
+  table[bucket] = static_cast<int8_t>(slot);
+  return true;
+}
+
+int FontRegistry::slotOf(const int fontId) const {
+  // The table is never full, so there is always an empty bucket to stop at
+  for (int bucket = bucketOf(fontId);; bucket = (bucket + 1) & (TABLE_SIZE - 1)) {
+    const int slot = table[bucket];
+    if (slot == NO_SLOT) {
+      return NO_SLOT;
+    }
+    if (ids[slot] == fontId) {
+      return slot;
+    }
+  }
+}
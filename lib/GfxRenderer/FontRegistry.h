@@ -0,0 +1,42 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstdint>
+#include <vector>
+
+// Dense storage for the font families known to the renderer.
+// Font ids are the hashes generated in fontIds.h. Each id is resolved to a compact slot once, when the font is
+// inserted, and text calls find it again with a probe into a small open-addressing table instead of a tree walk.
+class FontRegistry {
+ public:
+  static constexpr int MAX_FONTS = 32;
+  static constexpr int NO_SLOT = -1;
+
+  FontRegistry();
+
+  // Returns false if the registry is full. Inserting an id that is already known keeps the existing font.
+  bool insert(int fontId, const EpdFontFamily& family);
+  // Slot of a font id, or NO_SLOT for unknown ids
+  int slotOf(int fontId) const;
+  // Font family for an id, or nullptr for unknown ids
+  const EpdFontFamily* find(const int fontId) const {
+    const int slot = slotOf(fontId);
+    return slot == NO_SLOT ? nullptr : &families[slot];
+  }
+  const EpdFontFamily& atSlot(const int slot) const { return families[slot]; }
+  int size() const { return static_cast<int>(families.size()); }
+
+ private:
+  // Power of two, twice MAX_FONTS to keep probe chains short
+  static constexpr int TABLE_SIZE = 64;
+  static_assert((TABLE_SIZE & (TABLE_SIZE - 1)) == 0, "Font slot table size must be a power of two");
+  static_assert(TABLE_SIZE >= 2 * MAX_FONTS, "Font slot table is too small");
+
+  int ids[MAX_FONTS];
+  std::vector<EpdFontFamily> families;
+  int8_t table[TABLE_SIZE];  // Slot per bucket, NO_SLOT if empty
+
+  // The ids are already hashes, their low bits are spread well enough
+  static int bucketOf(const int fontId) { return static_cast<int>(static_cast<uint32_t>(fontId) & (TABLE_SIZE - 1)); }
+};
@@ -1,5 +1,6 @@
 #include "GfxRenderer.h"
 
+#include <HeapAccounting.h>
 #include <Logging.h>
 #include <Utf8.h>
 
@@ -11,7 +12,19 @@ void GfxRenderer::begin() {
   }
 }
 
-void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
+void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
+  if (!fonts.insert(fontId, font)) {
+    LOG_ERR("GFX", "!! Font registry full, can't add font %d", fontId);
+  }
+}
+
+const EpdFontFamily* GfxRenderer::getFont(const int fontId) const {
+  const EpdFontFamily* font = fonts.find(fontId);
+  if (!font) {
+    LOG_ERR("GFX", "Font %d not found", fontId);
+  }
+  return font;
+}
 
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
 // This should always be inlined for better performance
@@ -38,7 +51,8 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
       *phyY = x;
       break;
     }
-    case GfxRenderer::LandscapeCounterClockwise: {
+    case GfxRenderer::LandscapeCounterClockwise:
+    default: {
       // Logical landscape (800x480) aligned with panel orientation
       *phyX = x;
       *phyY = y;
@@ -47,6 +61,34 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
   }
 }
 
+// Translate physical panel coordinates back to logical (x,y) coordinates, the inverse of rotateCoordinates
+static inline void unrotateCoordinates(const GfxRenderer::Orientation orientation, const int phyX, const int phyY,
+                                       int* x, int* y) {
+  switch (orientation) {
+    case GfxRenderer::Portrait: {
+      *x = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+      *y = phyX;
+      break;
+    }
+    case GfxRenderer::LandscapeClockwise: {
+      *x = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+      *y = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+      break;
+    }
+    case GfxRenderer::PortraitInverted: {
+      *x = phyY;
+      *y = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+      break;
+    }
+    case GfxRenderer::LandscapeCounterClockwise:
+    default: {
+      *x = phyX;
+      *y = phyY;
+      break;
+    }
+  }
+}
+
 // IMPORTANT: This function is in critical rendering path and is called for every pixel. Please keep it as simple and
 // efficient as possible.
 void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
@@ -62,6 +104,8 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
     return;
   }
 
+  markDirty(phyX, phyY, phyX, phyY);
+
   // Calculate byte position and bit position
   const uint16_t byteIndex = phyY * HalDisplay::DISPLAY_WIDTH_BYTES + (phyX / 8);
   const uint8_t bitPosition = 7 - (phyX % 8);  // MSB first
@@ -73,14 +117,49 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   }
 }
 
+// Writes a 2bpp value (0 = black ... 3 = white) into the grayscale capture. Where glyphs overlap (e.g. when thickening
+// text), the darkest value wins.
+void GfxRenderer::drawPixelGrayCapture(const int x, const int y, const uint8_t value) const {
+  int phyX = 0;
+  int phyY = 0;
+
+  rotateCoordinates(orientation, x, y, &phyX, &phyY);
+
+  if (phyX < 0 || phyX >= HalDisplay::DISPLAY_WIDTH || phyY < 0 || phyY >= HalDisplay::DISPLAY_HEIGHT) {
+    LOG_ERR("GFX", "!! Outside range (%d, %d) -> (%d, %d)", x, y, phyX, phyY);
+    return;
+  }
+
+  const size_t byteOffset = (phyY % GRAY_CAPTURE_ROWS_PER_CHUNK) * HalDisplay::DISPLAY_WIDTH_BYTES + (phyX / 8);
+  const uint8_t mask = 1 << (7 - (phyX % 8));
+  uint8_t* hi = grayCaptureChunks[0][phyY / GRAY_CAPTURE_ROWS_PER_CHUNK] + byteOffset;
+  uint8_t* lo = grayCaptureChunks[1][phyY / GRAY_CAPTURE_ROWS_PER_CHUNK] + byteOffset;
+
+  const uint8_t current = ((*hi & mask) ? 2 : 0) | ((*lo & mask) ? 1 : 0);
+  if (value >= current) {
+    return;
+  }
+
+  if (value & 2) {
+    *hi |= mask;
+  } else {
+    *hi &= ~mask;
+  }
+  if (value & 1) {
+    *lo |= mask;
+  } else {
+    *lo &= ~mask;
+  }
+}
+
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  if (fontMap.count(fontId) == 0) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  const EpdFontFamily* font = getFont(fontId);
+  if (!font) {
     return 0;
   }
 
   int w = 0, h = 0;
-  fontMap.at(fontId).getTextDimensions(text, &w, &h, style);
+  font->getTextDimensions(text, &w, &h, style);
   return w;
 }
 
@@ -92,28 +171,27 @@ void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* te
 
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
-  const int yPos = y + getFontAscenderSize(fontId);
-  int xpos = x;
-
   // cannot draw a NULL / empty string
   if (text == nullptr || *text == '\0') {
     return;
   }
 
-  if (fontMap.count(fontId) == 0) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  const EpdFontFamily* font = getFont(fontId);
+  if (!font) {
     return;
   }
-  const auto font = fontMap.at(fontId);
+
+  const int yPos = y + font->getData(EpdFontFamily::REGULAR)->ascender;
+  int xpos = x;
 
   // no printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  if (!font->hasPrintableChars(text, style)) {
     return;
   }
 
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    renderChar(font, cp, &xpos, &yPos, black, style);
+    renderChar(*font, cp, &xpos, &yPos, black, style);
   }
 }
 
@@ -122,16 +200,12 @@ void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) con
     if (y2 < y1) {
       std::swap(y1, y2);
     }
-    for (int y = y1; y <= y2; y++) {
-      drawPixel(x1, y, state);
-    }
+    fillRect(x1, y1, 1, y2 - y1 + 1, state);
   } else if (y1 == y2) {
     if (x2 < x1) {
       std::swap(x1, x2);
     }
-    for (int x = x1; x <= x2; x++) {
-      drawPixel(x, y1, state);
-    }
+    fillRect(x1, y1, x2 - x1 + 1, 1, state);
   } else {
     // TODO: Implement
     LOG_ERR("GFX", "Line drawing not supported");
@@ -169,15 +243,26 @@ void GfxRenderer::drawArc(const int maxRadius, const int cx, const int cy, const
   const int outerRadiusSq = maxRadius * maxRadius;
   const int innerRadiusSq = innerRadius * innerRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
+    // The ring covers a single run of dx on every row
+    int firstDx = -1;
+    int lastDx = -1;
     for (int dx = 0; dx <= maxRadius; ++dx) {
       const int distSq = dx * dx + dy * dy;
-      if (distSq > outerRadiusSq || distSq < innerRadiusSq) {
-        continue;
+      if (distSq > outerRadiusSq) {
+        break;
       }
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      drawPixel(px, py, state);
+      if (distSq >= innerRadiusSq) {
+        if (firstDx < 0) {
+          firstDx = dx;
+        }
+        lastDx = dx;
+      }
+    }
+    if (firstDx < 0) {
+      continue;
     }
+    const int px = xDir < 0 ? cx - lastDx : cx + firstDx;
+    fillRect(px, cy + yDir * dy, lastDx - firstDx + 1, 1, state);
   }
 };
 
@@ -240,71 +325,97 @@ void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, con
 }
 
 void GfxRenderer::fillRect(const int x, const int y, const int width, const int height, const bool state) const {
-  for (int fillY = y; fillY < y + height; fillY++) {
-    drawLine(x, fillY, x + width - 1, fillY, state);
-  }
+  fillSpans(x, y, width, height, state ? Color::Black : Color::White);
 }
 
-// NOTE: Those are in critical path, and need to be templated to avoid runtime checks for every pixel.
-// Any branching must be done outside the loops to avoid performance degradation.
-template <>
-void GfxRenderer::drawPixelDither<Color::Clear>(const int x, const int y) const {
-  // Do nothing
+// Whether the fill pattern of a color inks the logical pixel (x,y)
+static inline bool isDitherInked(const Color color, const int x, const int y) {
+  switch (color) {
+    case Color::Black:
+      return true;
+    case Color::LightGray:
+      return x % 2 == 0 && y % 2 == 0;
+    case Color::DarkGray:
+      return (x + y) % 2 == 0;  // TODO: maybe find a better pattern?
+    default:
+      return false;
+  }
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::Black>(const int x, const int y) const {
-  drawPixel(x, y, true);
+// Framebuffer byte holding 8 pixels of a fill on a physical row. The patterns repeat every other pixel in both logical
+// directions, and every orientation maps a physical row onto a logical row or column, so two pixels describe the row.
+static inline uint8_t ditherRowPattern(const GfxRenderer::Orientation orientation, const Color color, const int phyY) {
+  int evenX, evenY, oddX, oddY;
+  unrotateCoordinates(orientation, 0, phyY, &evenX, &evenY);
+  unrotateCoordinates(orientation, 1, phyY, &oddX, &oddY);
+  // Set bits are white, MSB first
+  return (isDitherInked(color, evenX, evenY) ? 0x00 : 0xAA) | (isDitherInked(color, oddX, oddY) ? 0x00 : 0x55);
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::White>(const int x, const int y) const {
-  drawPixel(x, y, false);
-}
+// Writes pattern into the physical pixels x0..x1 (inclusive) of a framebuffer row: masked edge bytes, memset between
+static inline void writeSpan(uint8_t* row, const int x0, const int x1, const uint8_t pattern) {
+  const int firstByte = x0 / 8;
+  const int lastByte = x1 / 8;
+  const uint8_t firstMask = 0xFF >> (x0 % 8);
+  const uint8_t lastMask = static_cast<uint8_t>(0xFF << (7 - x1 % 8));
+
+  if (firstByte == lastByte) {
+    const uint8_t mask = firstMask & lastMask;
+    row[firstByte] = (row[firstByte] & ~mask) | (pattern & mask);
+    return;
+  }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::LightGray>(const int x, const int y) const {
-  drawPixel(x, y, x % 2 == 0 && y % 2 == 0);
+  row[firstByte] = (row[firstByte] & ~firstMask) | (pattern & firstMask);
+  memset(row + firstByte + 1, pattern, lastByte - firstByte - 1);
+  row[lastByte] = (row[lastByte] & ~lastMask) | (pattern & lastMask);
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::DarkGray>(const int x, const int y) const {
-  drawPixel(x, y, (x + y) % 2 == 0);  // TODO: maybe find a better pattern?
+// Fills a logical rectangle, clipped to the screen, one physical row span at a time. Every orientation maps the
+// rectangle onto a physical rectangle, so this never touches pixels one by one.
+void GfxRenderer::fillSpans(const int x, const int y, const int width, const int height, const Color color) const {
+  if (width <= 0 || height <= 0 || color == Color::Clear) {
+    return;
+  }
+
+  int phyX0, phyY0, phyX1, phyY1;
+  rotateCoordinates(orientation, x, y, &phyX0, &phyY0);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &phyX1, &phyY1);
+  if (phyX0 > phyX1) {
+    std::swap(phyX0, phyX1);
+  }
+  if (phyY0 > phyY1) {
+    std::swap(phyY0, phyY1);
+  }
+
+  phyX0 = std::max(phyX0, 0);
+  phyY0 = std::max(phyY0, 0);
+  phyX1 = std::min(phyX1, HalDisplay::DISPLAY_WIDTH - 1);
+  phyY1 = std::min(phyY1, HalDisplay::DISPLAY_HEIGHT - 1);
+  if (phyX0 > phyX1 || phyY0 > phyY1) {
+    return;
+  }
+  markDirty(phyX0, phyY0, phyX1, phyY1);
+
+  for (int phyY = phyY0; phyY <= phyY1; phyY++) {
+    writeSpan(frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES, phyX0, phyX1,
+              ditherRowPattern(orientation, color, phyY));
+  }
 }
 
 void GfxRenderer::fillRectDither(const int x, const int y, const int width, const int height, Color color) const {
-  if (color == Color::Clear) {
-  } else if (color == Color::Black) {
-    fillRect(x, y, width, height, true);
-  } else if (color == Color::White) {
-    fillRect(x, y, width, height, false);
-  } else if (color == Color::LightGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::LightGray>(fillX, fillY);
-      }
-    }
-  } else if (color == Color::DarkGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::DarkGray>(fillX, fillY);
-      }
-    }
-  }
+  fillSpans(x, y, width, height, color);
 }
 
-template <Color color>
-void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir) const {
+void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
+                          const Color color) const {
   const int radiusSq = maxRadius * maxRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      if (distSq <= radiusSq) {
-        drawPixelDither<color>(px, py);
-      }
+    int lastDx = 0;
+    while (lastDx < maxRadius && (lastDx + 1) * (lastDx + 1) + dy * dy <= radiusSq) {
+      lastDx++;
     }
+    const int px = xDir < 0 ? cx - lastDx : cx;
+    fillSpans(px, cy + yDir * dy, lastDx + 1, 1, color);
   }
 }
 
@@ -337,45 +448,26 @@ void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, con
     fillRectDither(x + width - maxRadius - 1, y + maxRadius + 1, maxRadius + 1, verticalHeight, color);
   }
 
-  auto fillArcTemplated = [this](int maxRadius, int cx, int cy, int xDir, int yDir, Color color) {
-    switch (color) {
-      case Color::Clear:
-        break;
-      case Color::Black:
-        fillArc<Color::Black>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::White:
-        fillArc<Color::White>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::LightGray:
-        fillArc<Color::LightGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::DarkGray:
-        fillArc<Color::DarkGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-    }
-  };
-
   if (roundTopLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
+    fillArc(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
   } else {
     fillRectDither(x, y, maxRadius + 1, maxRadius + 1, color);
   }
 
   if (roundTopRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
   } else {
     fillRectDither(x + width - maxRadius - 1, y, maxRadius + 1, maxRadius + 1, color);
   }
 
   if (roundBottomRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
   } else {
     fillRectDither(x + width - maxRadius - 1, y + height - maxRadius - 1, maxRadius + 1, maxRadius + 1, color);
   }
 
   if (roundBottomLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
+    fillArc(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
   } else {
     fillRectDither(x, y + height - maxRadius - 1, maxRadius + 1, maxRadius + 1, color);
   }
@@ -401,11 +493,17 @@ void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, co
       break;
   }
   // TODO: Rotate bits
+  markDirty(std::max(rotatedX, 0), std::max(rotatedY, 0),
+            std::min(rotatedX + width - 1, HalDisplay::DISPLAY_WIDTH - 1),
+            std::min(rotatedY + height - 1, HalDisplay::DISPLAY_HEIGHT - 1));
   display.drawImage(bitmap, rotatedX, rotatedY, width, height);
 }
 
 void GfxRenderer::drawIcon(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
-  display.drawImage(bitmap, y, getScreenWidth() - width - x, height, width);
+  const int phyY = getScreenWidth() - width - x;
+  markDirty(std::max(y, 0), std::max(phyY, 0), std::min(y + height - 1, HalDisplay::DISPLAY_WIDTH - 1),
+            std::min(phyY + width - 1, HalDisplay::DISPLAY_HEIGHT - 1));
+  display.drawImage(bitmap, y, phyY, height, width);
 }
 
 void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, const int maxWidth, const int maxHeight,
@@ -489,7 +587,10 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
 
       const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
 
-      if (renderMode == BW && val < 3) {
+      if (renderMode == GRAYSCALE_CAPTURE && val < 3) {
+        // Keep the gray level, like captured text
+        drawPixelGrayCapture(screenX, screenY, val);
+      } else if (renderMode == BW && val < 3) {
         drawPixel(screenX, screenY);
       } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
         drawPixel(screenX, screenY, false);
@@ -631,33 +732,145 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
       if (endX >= getScreenWidth()) endX = getScreenWidth() - 1;
 
       // Draw horizontal line
-      for (int x = startX; x <= endX; x++) {
-        drawPixel(x, scanY, state);
-      }
+      fillRect(startX, scanY, endX - startX + 1, 1, state);
     }
   }
 
   free(nodeX);
 }
 
-// For performance measurement (using static to allow "const" methods)
-static unsigned long start_ms = 0;
+// For performance measurement (using static to allow "const" methods). Microseconds, as UI screens draw in well under
+// a millisecond.
+static unsigned long start_us = 0;
 
 void GfxRenderer::clearScreen(const uint8_t color) const {
-  start_ms = millis();
+  start_us = micros();
+  // Clearing to the same color only changes what was drawn since the previous clear
+  if (color == lastClearColor) {
+    erasedRegion.add(drawnRegion);
+  } else {
+    erasedRegion.add(0, 0, HalDisplay::DISPLAY_WIDTH - 1, HalDisplay::DISPLAY_HEIGHT - 1);
+    lastClearColor = color;
+  }
+  drawnRegion.clear();
   display.clearScreen(color);
 }
 
 void GfxRenderer::invertScreen() const {
+  markAllDirty();
   for (int i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
     frameBuffer[i] = ~frameBuffer[i];
   }
 }
 
 void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
-  auto elapsed = millis() - start_ms;
-  LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
+  [[maybe_unused]] const auto elapsed = micros() - start_us;
+  LOG_DBG("GFX", "Time = %lu us from clearScreen to displayBuffer", elapsed);
   display.displayBuffer(refreshMode, fadingFix);
+  panelTilesValid = false;
+}
+
+void GfxRenderer::submitBuffer(const HalDisplay::RefreshMode refreshMode, std::function<void()> onComplete) const {
+  [[maybe_unused]] const auto elapsed = micros() - start_us;
+  LOG_DBG("GFX", "Time = %lu us from clearScreen to submitBuffer", elapsed);
+  display.submitBuffer(refreshMode, fadingFix, std::move(onComplete));
+  panelTilesValid = false;
+}
+
+void GfxRenderer::displayWindow(const int x, const int y, const int width, const int height) const {
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+
+  int phyX0, phyY0, phyX1, phyY1;
+  rotateCoordinates(orientation, x, y, &phyX0, &phyY0);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &phyX1, &phyY1);
+  // The panel only takes windows starting and ending on whole bytes
+  const int left = std::max(std::min(phyX0, phyX1), 0) & ~7;
+  const int right = std::min(std::max(phyX0, phyX1), HalDisplay::DISPLAY_WIDTH - 1) | 7;
+  const int top = std::max(std::min(phyY0, phyY1), 0);
+  const int bottom = std::min(std::max(phyY0, phyY1), HalDisplay::DISPLAY_HEIGHT - 1);
+  if (left > right || top > bottom) {
+    return;
+  }
+
+  display.displayWindow(left, top, right - left + 1, bottom - top + 1, fadingFix);
+  panelTilesValid = false;
+}
+
+uint32_t GfxRenderer::hashPanelTile(const int row, const int col) const {
+  const int firstByte = col * PANEL_TILE_WIDTH_BYTES;
+  const int widthBytes = std::min(PANEL_TILE_WIDTH_BYTES, HalDisplay::DISPLAY_WIDTH_BYTES - firstByte);
+  const uint8_t* line = frameBuffer + row * PANEL_TILE_HEIGHT * HalDisplay::DISPLAY_WIDTH_BYTES + firstByte;
+
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (int y = 0; y < PANEL_TILE_HEIGHT; y++, line += HalDisplay::DISPLAY_WIDTH_BYTES) {
+    for (int i = 0; i < widthBytes; i++) {
+      hash = (hash ^ line[i]) * 16777619u;
+    }
+  }
+  return hash;
+}
+
+void GfxRenderer::displayChanges(const HalDisplay::RefreshMode fallbackMode) const {
+  [[maybe_unused]] const auto elapsed = micros() - start_us;
+  LOG_DBG("GFX", "Time = %lu us from clearScreen to displayChanges", elapsed);
+
+  if (!panelTilesValid) {
+    // Unknown panel content: send everything once, later calls can then diff against it
+    display.displayBuffer(fallbackMode, fadingFix);
+    for (int row = 0; row < PANEL_TILE_ROWS; row++) {
+      for (int col = 0; col < PANEL_TILE_COLS; col++) {
+        panelTileHashes[row][col] = hashPanelTile(row, col);
+      }
+    }
+    panelTilesValid = true;
+    erasedRegion.clear();
+    return;
+  }
+
+  // Only tiles under drawn or erased areas can differ from the panel
+  DirtyRegion candidates = erasedRegion;
+  candidates.add(drawnRegion);
+  erasedRegion.clear();
+
+  int minRow = PANEL_TILE_ROWS, maxRow = -1, minCol = PANEL_TILE_COLS, maxCol = -1;
+  for (int i = 0; i < candidates.size(); i++) {
+    const DirtyRegion::Rect& rect = candidates[i];
+    for (int row = rect.y0 / PANEL_TILE_HEIGHT; row <= rect.y1 / PANEL_TILE_HEIGHT; row++) {
+      for (int col = rect.x0 / 8 / PANEL_TILE_WIDTH_BYTES; col <= rect.x1 / 8 / PANEL_TILE_WIDTH_BYTES; col++) {
+        const uint32_t hash = hashPanelTile(row, col);
+        if (hash == panelTileHashes[row][col]) {
+          continue;
+        }
+        panelTileHashes[row][col] = hash;
+        minRow = std::min(minRow, row);
+        maxRow = std::max(maxRow, row);
+        minCol = std::min(minCol, col);
+        maxCol = std::max(maxCol, col);
+      }
+    }
+  }
+
+  if (maxRow < 0) {
+    LOG_DBG("GFX", "Panel already up to date");
+    return;
+  }
+
+  const int x = minCol * PANEL_TILE_WIDTH_BYTES * 8;
+  const int right = std::min((maxCol + 1) * PANEL_TILE_WIDTH_BYTES * 8, static_cast<int>(HalDisplay::DISPLAY_WIDTH));
+  const int width = right - x;
+  const int y = minRow * PANEL_TILE_HEIGHT;
+  const int height = (maxRow - minRow + 1) * PANEL_TILE_HEIGHT;
+  // A window only pays off while it saves a good part of the transfer
+  if (width * height * 2 > HalDisplay::DISPLAY_WIDTH * HalDisplay::DISPLAY_HEIGHT) {
+    display.displayBuffer(fallbackMode, fadingFix);
+    return;
+  }
+
+  LOG_DBG("GFX", "Refreshing window (%d, %d) %dx%d", x, y, width, height);
+  display.displayWindow(x, y, width, height, fadingFix);
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
@@ -709,52 +922,52 @@ int GfxRenderer::getScreenHeight() const {
 }
 
 int GfxRenderer::getSpaceWidth(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  const EpdFontFamily* font = getFont(fontId);
+  if (!font) {
     return 0;
   }
 
-  return fontMap.at(fontId).getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
+  return font->getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
 }
 
 int GfxRenderer::getTextAdvanceX(const int fontId, const char* text) const {
-  if (fontMap.count(fontId) == 0) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  const EpdFontFamily* font = getFont(fontId);
+  if (!font) {
     return 0;
   }
 
   uint32_t cp;
   int width = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    width += fontMap.at(fontId).getGlyph(cp, EpdFontFamily::REGULAR)->advanceX;
+    width += font->getGlyph(cp, EpdFontFamily::REGULAR)->advanceX;
   }
   return width;
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  const EpdFontFamily* font = getFont(fontId);
+  if (!font) {
     return 0;
   }
 
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
+  return font->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 int GfxRenderer::getLineHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  const EpdFontFamily* font = getFont(fontId);
+  if (!font) {
     return 0;
   }
 
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->advanceY;
+  return font->getData(EpdFontFamily::REGULAR)->advanceY;
 }
 
 int GfxRenderer::getTextHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  const EpdFontFamily* font = getFont(fontId);
+  if (!font) {
     return 0;
   }
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
+  return font->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y, const char* text, const bool black,
@@ -764,14 +977,13 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     return;
   }
 
-  if (fontMap.count(fontId) == 0) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  const EpdFontFamily* font = getFont(fontId);
+  if (!font) {
     return;
   }
-  const auto font = fontMap.at(fontId);
 
   // No printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  if (!font->hasPrintableChars(text, style)) {
     return;
   }
 
@@ -783,22 +995,22 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
 
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    const EpdGlyph* glyph = font.getGlyph(cp, style);
+    const EpdGlyph* glyph = font->getGlyph(cp, style);
     if (!glyph) {
-      glyph = font.getGlyph(REPLACEMENT_GLYPH, style);
+      glyph = font->getGlyph(REPLACEMENT_GLYPH, style);
     }
     if (!glyph) {
       continue;
     }
 
-    const int is2Bit = font.getData(style)->is2Bit;
+    const int is2Bit = font->getData(style)->is2Bit;
     const uint32_t offset = glyph->dataOffset;
     const uint8_t width = glyph->width;
     const uint8_t height = glyph->height;
     const int left = glyph->left;
     const int top = glyph->top;
 
-    const uint8_t* bitmap = &font.getData(style)->bitmap[offset];
+    const uint8_t* bitmap = &font->getData(style)->bitmap[offset];
 
     if (bitmap != nullptr) {
       for (int glyphY = 0; glyphY < height; glyphY++) {
@@ -808,15 +1020,22 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
           // 90° clockwise rotation transformation:
           // screenX = x + (ascender - top + glyphY)
           // screenY = yPos - (left + glyphX)
-          const int screenX = x + (font.getData(style)->ascender - top + glyphY);
+          const int screenX = x + (font->getData(style)->ascender - top + glyphY);
           const int screenY = yPos - left - glyphX;
 
           if (is2Bit) {
             const uint8_t byte = bitmap[pixelPosition / 4];
             const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-            const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
-
-            if (renderMode == BW && bmpVal < 3) {
+            const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
+
+            if (renderMode == GRAYSCALE_CAPTURE && bmpVal < 3) {
+              // White text goes to the frame buffer, the capture only darkens
+              if (black) {
+                drawPixelGrayCapture(screenX, screenY, bmpVal);
+              } else {
+                drawPixel(screenX, screenY, false);
+              }
+            } else if (renderMode == BW && bmpVal < 3) {
               drawPixel(screenX, screenY, black);
             } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
               drawPixel(screenX, screenY, false);
@@ -840,7 +1059,11 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   }
 }
 
-uint8_t* GfxRenderer::getFrameBuffer() const { return frameBuffer; }
+uint8_t* GfxRenderer::getFrameBuffer() const {
+  // Callers may write anywhere
+  markAllDirty();
+  return frameBuffer;
+}
 
 size_t GfxRenderer::getBufferSize() { return HalDisplay::BUFFER_SIZE; }
 
@@ -851,7 +1074,10 @@ void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuff
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(frameBuffer); }
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
+void GfxRenderer::displayGrayBuffer() const {
+  display.displayGrayBuffer(fadingFix);
+  panelTilesValid = false;
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -869,6 +1095,7 @@ void GfxRenderer::freeBwBufferChunks() {
  * Returns true if buffer was stored successfully, false if allocation failed.
  */
 bool GfxRenderer::storeBwBuffer() {
+  HEAP_SCOPE(HeapTag::Renderer);
   // Allocate and copy each chunk
   for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
     // Check if any chunks are already allocated
@@ -926,6 +1153,7 @@ void GfxRenderer::restoreBwBuffer() {
     const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
     memcpy(frameBuffer + offset, bwBufferChunks[i], BW_BUFFER_CHUNK_SIZE);
   }
+  markAllDirty();
 
   display.cleanupGrayscaleBuffers(frameBuffer);
 
@@ -943,6 +1171,310 @@ void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   }
 }
 
+void GfxRenderer::freeGrayCaptureChunks() {
+  for (auto& plane : grayCaptureChunks) {
+    for (auto& chunk : plane) {
+      if (chunk) {
+        free(chunk);
+        chunk = nullptr;
+      }
+    }
+  }
+}
+
+/**
+ * Start capturing text into a planar 2bpp buffer instead of the frame buffer.
+ * While capturing, glyphs are decoded once and keep their gray levels; everything else (lines, status bar...) still
+ * goes to the BW frame buffer. `endGrayscaleCapture` must follow once the text has been rendered.
+ * Uses the same chunked allocation as `storeBwBuffer`. Returns false if allocation failed, in which case the caller
+ * should fall back to rendering the grayscale passes separately.
+ */
+bool GfxRenderer::beginGrayscaleCapture() {
+  if (grayCaptureChunks[0][0]) {
+    LOG_ERR("GFX", "!! Grayscale capture already active - this is likely a bug, freeing it");
+    freeGrayCaptureChunks();
+  }
+
+  for (auto& plane : grayCaptureChunks) {
+    for (auto& chunk : plane) {
+      chunk = static_cast<uint8_t*>(malloc(BW_BUFFER_CHUNK_SIZE));
+      if (!chunk) {
+        LOG_ERR("GFX", "!! Failed to allocate grayscale capture chunk (%zu bytes)", BW_BUFFER_CHUNK_SIZE);
+        freeGrayCaptureChunks();
+        return false;
+      }
+      // All white (value 3)
+      memset(chunk, 0xFF, BW_BUFFER_CHUNK_SIZE);
+    }
+  }
+
+  renderMode = GRAYSCALE_CAPTURE;
+  return true;
+}
+
+/**
+ * Stop capturing and merge the captured text into the frame buffer as black (any value below 3), so it can be
+ * displayed with `displayBuffer` like a normal BW render.
+ */
+void GfxRenderer::endGrayscaleCapture() {
+  renderMode = BW;
+  if (!grayCaptureChunks[0][0]) {
+    return;
+  }
+
+  markAllDirty();
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    uint8_t* out = frameBuffer + i * BW_BUFFER_CHUNK_SIZE;
+    const uint8_t* hi = grayCaptureChunks[0][i];
+    const uint8_t* lo = grayCaptureChunks[1][i];
+    for (size_t j = 0; j < BW_BUFFER_CHUNK_SIZE; j++) {
+      out[j] &= hi[j] & lo[j];
+    }
+  }
+}
+
+/**
+ * Derive the LSB and MSB planes from the capture, display them and leave the BW frame in the frame buffer again.
+ * This replaces the store/re-render/restore sequence: the page is never rasterized a second time.
+ */
+void GfxRenderer::displayGrayscaleCapture() {
+  if (!grayCaptureChunks[0][0]) {
+    LOG_ERR("GFX", "!! No grayscale capture to display - this is likely a bug");
+    return;
+  }
+
+  // Fold anything that was drawn directly into the frame buffer (status bar, underlines, ...) into the capture as
+  // black, so the capture describes the whole screen. Captured gray pixels are left untouched.
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    const uint8_t* bw = frameBuffer + i * BW_BUFFER_CHUNK_SIZE;
+    uint8_t* hi = grayCaptureChunks[0][i];
+    uint8_t* lo = grayCaptureChunks[1][i];
+    for (size_t j = 0; j < BW_BUFFER_CHUNK_SIZE; j++) {
+      const uint8_t keep = bw[j] | static_cast<uint8_t>(~(hi[j] & lo[j]));
+      hi[j] &= keep;
+      lo[j] &= keep;
+    }
+  }
+
+  // In the gray planes a set bit means "apply gray": LSB marks dark gray (1), MSB marks dark and light gray (1, 2)
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    uint8_t* out = frameBuffer + i * BW_BUFFER_CHUNK_SIZE;
+    const uint8_t* hi = grayCaptureChunks[0][i];
+    const uint8_t* lo = grayCaptureChunks[1][i];
+    for (size_t j = 0; j < BW_BUFFER_CHUNK_SIZE; j++) {
+      out[j] = static_cast<uint8_t>(~hi[j]) & lo[j];
+    }
+  }
+  display.copyGrayscaleLsbBuffers(frameBuffer);
+
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    uint8_t* out = frameBuffer + i * BW_BUFFER_CHUNK_SIZE;
+    const uint8_t* hi = grayCaptureChunks[0][i];
+    const uint8_t* lo = grayCaptureChunks[1][i];
+    for (size_t j = 0; j < BW_BUFFER_CHUNK_SIZE; j++) {
+      out[j] = hi[j] ^ lo[j];
+    }
+  }
+  display.copyGrayscaleMsbBuffers(frameBuffer);
+
+  display.displayGrayBuffer(fadingFix);
+  panelTilesValid = false;
+
+  // Rebuild the BW frame for the next differential refresh
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    uint8_t* out = frameBuffer + i * BW_BUFFER_CHUNK_SIZE;
+    const uint8_t* hi = grayCaptureChunks[0][i];
+    const uint8_t* lo = grayCaptureChunks[1][i];
+    for (size_t j = 0; j < BW_BUFFER_CHUNK_SIZE; j++) {
+      out[j] = hi[j] & lo[j];
+    }
+  }
+  display.cleanupGrayscaleBuffers(frameBuffer);
+
+  freeGrayCaptureChunks();
+}
+
+// Decodes one glyph row into pixel values: 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
+static void decodeGlyphRow(const uint8_t* bitmap, const bool is2Bit, const uint8_t width, const int glyphY,
+                           uint8_t* rowValues) {
+  for (int glyphX = 0; glyphX < width; glyphX++) {
+    const int pixelPosition = glyphY * width + glyphX;
+
+    if (is2Bit) {
+      const uint8_t byte = bitmap[pixelPosition / 4];
+      const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
+      // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
+      // we swap this to better match the way images and screen think about colors:
+      // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
+      rowValues[glyphX] = 3 - ((byte >> bit_index) & 0x3);
+    } else {
+      const uint8_t byte = bitmap[pixelPosition / 8];
+      const uint8_t bit_index = 7 - (pixelPosition % 8);
+      rowValues[glyphX] = ((byte >> bit_index) & 1) ? 0 : 3;
+    }
+  }
+}
+
+// Synthetic bold: the row is ORed with itself shifted right by up to `embolden` pixels, darkest value wins
+static inline uint8_t emboldenedValue(const uint8_t* rowValues, const int width, const int glyphX,
+                                      const int embolden) {
+  uint8_t value = 3;
+  for (int shift = 0; shift <= embolden; shift++) {
+    const int sourceX = glyphX - shift;
+    if (sourceX >= 0 && sourceX < width && rowValues[sourceX] < value) {
+      value = rowValues[sourceX];
+    }
+  }
+  return value;
+}
+
+// Physical offset of a logical offset (dx, dy), independent of where it is applied
+static inline void rotateOffset(const GfxRenderer::Orientation orientation, const int dx, const int dy, int* phyDx,
+                                int* phyDy) {
+  int originX = 0, originY = 0, pointX = 0, pointY = 0;
+  rotateCoordinates(orientation, 0, 0, &originX, &originY);
+  rotateCoordinates(orientation, dx, dy, &pointX, &pointY);
+  *phyDx = pointX - originX;
+  *phyDy = pointY - originY;
+}
+
+// Whether a glyph pixel value is drawn in the given (non capture) render mode
+static inline bool isInked(const GfxRenderer::RenderMode renderMode, const bool is2Bit, const uint8_t value) {
+  if (!is2Bit || renderMode == GfxRenderer::BW) {
+    return value < 3;
+  }
+  if (renderMode == GfxRenderer::GRAYSCALE_MSB) {
+    return value == 1 || value == 2;
+  }
+  return value == 1;
+}
+
+const GlyphCache::Entry* GfxRenderer::cacheGlyph(const EpdGlyph* glyph, const EpdFontData* fontData) const {
+  const int width = glyph->width + textEmbolden;
+  const int height = glyph->height;
+
+  // Physical bounding box of the glyph's logical box
+  int minX = 0, minY = 0, maxX = 0, maxY = 0;
+  const int cornersX[] = {0, width - 1, 0, width - 1};
+  const int cornersY[] = {0, 0, height - 1, height - 1};
+  for (int i = 0; i < 4; i++) {
+    int dx = 0, dy = 0;
+    rotateOffset(orientation, cornersX[i], cornersY[i], &dx, &dy);
+    minX = i == 0 ? dx : std::min(minX, dx);
+    minY = i == 0 ? dy : std::min(minY, dy);
+    maxX = i == 0 ? dx : std::max(maxX, dx);
+    maxY = i == 0 ? dy : std::max(maxY, dy);
+  }
+
+  const bool capture = renderMode == GRAYSCALE_CAPTURE;
+  const GlyphCache::Key key{glyph, static_cast<uint8_t>(renderMode), static_cast<uint8_t>(orientation), textEmbolden};
+  GlyphCache::Entry* entry = glyphCache.insert(key, minX, minY, maxX - minX + 1, maxY - minY + 1, capture ? 2 : 1);
+  if (!entry) {
+    return nullptr;
+  }
+  if (capture) {
+    // Both planes start white
+    memset(entry->data.get(), 0xFF, entry->sizeBytes());
+  }
+
+  // Logical step of one pixel along x and y, in physical coordinates
+  int stepXx = 0, stepXy = 0, stepYx = 0, stepYy = 0;
+  rotateOffset(orientation, 1, 0, &stepXx, &stepXy);
+  rotateOffset(orientation, 0, 1, &stepYx, &stepYy);
+
+  const uint8_t* bitmap = &fontData->bitmap[glyph->dataOffset];
+  uint8_t rowValues[UINT8_MAX + MAX_TEXT_EMBOLDEN];
+  for (int glyphY = 0; glyphY < height; glyphY++) {
+    decodeGlyphRow(bitmap, fontData->is2Bit, glyph->width, glyphY, rowValues);
+    for (int glyphX = 0; glyphX < width; glyphX++) {
+      const uint8_t value = emboldenedValue(rowValues, glyph->width, glyphX, textEmbolden);
+      if (value == 3) {
+        continue;
+      }
+
+      const int phyX = glyphX * stepXx + glyphY * stepYx - entry->offsetX;
+      const int phyY = glyphX * stepXy + glyphY * stepYy - entry->offsetY;
+      const size_t byteIndex = phyY * entry->rowBytes + phyX / 8;
+      const uint8_t mask = 1 << (7 - (phyX % 8));
+
+      if (capture) {
+        if (!(value & 2)) entry->plane(0)[byteIndex] &= ~mask;
+        if (!(value & 1)) entry->plane(1)[byteIndex] &= ~mask;
+      } else if (isInked(renderMode, fontData->is2Bit, value)) {
+        entry->plane(0)[byteIndex] |= mask;
+      }
+    }
+  }
+
+  return entry;
+}
+
+// Draws a cached glyph whose top-left logical pixel is at (screenX, screenY).
+// Returns false (and draws nothing) if the glyph isn't fully on the panel.
+bool GfxRenderer::drawCachedGlyph(const GlyphCache::Entry& entry, const int screenX, const int screenY,
+                                  const bool state) const {
+  int originX = 0, originY = 0;
+  rotateCoordinates(orientation, screenX, screenY, &originX, &originY);
+  const int phyX = originX + entry.offsetX;
+  const int phyY = originY + entry.offsetY;
+  if (phyX < 0 || phyY < 0 || phyX + entry.width > HalDisplay::DISPLAY_WIDTH ||
+      phyY + entry.height > HalDisplay::DISPLAY_HEIGHT) {
+    return false;
+  }
+  if (entry.planes == 1) {
+    markDirty(phyX, phyY, phyX + entry.width - 1, phyY + entry.height - 1);
+  }
+
+  const int firstByte = phyX / 8;
+  const int shift = phyX % 8;
+  const int lastByte = (phyX + entry.width - 1) / 8;
+
+  for (int row = 0; row < entry.height; row++) {
+    const int panelRow = phyY + row;
+
+    if (entry.planes == 1) {
+      const uint8_t* src = entry.plane(0) + row * entry.rowBytes;
+      uint8_t* dst = frameBuffer + panelRow * HalDisplay::DISPLAY_WIDTH_BYTES;
+      for (int i = 0; i <= lastByte - firstByte; i++) {
+        // Bits of this destination byte come from the end of the previous source byte and the start of this one
+        const uint8_t current = i < entry.rowBytes ? src[i] : 0;
+        const uint8_t previous = i > 0 ? src[i - 1] : 0;
+        const uint8_t bits = static_cast<uint8_t>((current >> shift) | (shift ? previous << (8 - shift) : 0));
+        if (state) {
+          dst[firstByte + i] &= ~bits;
+        } else {
+          dst[firstByte + i] |= bits;
+        }
+      }
+    } else {
+      const uint8_t* srcHi = entry.plane(0) + row * entry.rowBytes;
+      const uint8_t* srcLo = entry.plane(1) + row * entry.rowBytes;
+      const size_t rowOffset = (panelRow % GRAY_CAPTURE_ROWS_PER_CHUNK) * HalDisplay::DISPLAY_WIDTH_BYTES;
+      uint8_t* dstHi = grayCaptureChunks[0][panelRow / GRAY_CAPTURE_ROWS_PER_CHUNK] + rowOffset;
+      uint8_t* dstLo = grayCaptureChunks[1][panelRow / GRAY_CAPTURE_ROWS_PER_CHUNK] + rowOffset;
+      for (int i = 0; i <= lastByte - firstByte; i++) {
+        // Same shifting as above, but with white (1) shifted in so pixels outside the glyph are left untouched
+        const uint8_t currentHi = i < entry.rowBytes ? srcHi[i] : 0xFF;
+        const uint8_t previousHi = i > 0 ? srcHi[i - 1] : 0xFF;
+        const uint8_t currentLo = i < entry.rowBytes ? srcLo[i] : 0xFF;
+        const uint8_t previousLo = i > 0 ? srcLo[i - 1] : 0xFF;
+        const uint8_t newHi = static_cast<uint8_t>((currentHi >> shift) | (previousHi << (8 - shift)));
+        const uint8_t newLo = static_cast<uint8_t>((currentLo >> shift) | (previousLo << (8 - shift)));
+
+        // Per pixel minimum of the 2 bit values: a lower high bit wins, otherwise the low bits are combined
+        uint8_t& hi = dstHi[firstByte + i];
+        uint8_t& lo = dstLo[firstByte + i];
+        const uint8_t sameHi = static_cast<uint8_t>(~(hi ^ newHi));
+        lo = (sameHi & lo & newLo) | (static_cast<uint8_t>(~hi) & newHi & lo) |
+             (hi & static_cast<uint8_t>(~newHi) & newLo);
+        hi &= newHi;
+      }
+    }
+  }
+
+  return true;
+}
+
 void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp, int* x, const int* y,
                              const bool pixelState, const EpdFontFamily::Style style) const {
   const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
@@ -956,48 +1488,66 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
     return;
   }
 
-  const int is2Bit = fontFamily.getData(style)->is2Bit;
+  const EpdFontData* fontData = fontFamily.getData(style);
+  const int is2Bit = fontData->is2Bit;
   const uint32_t offset = glyph->dataOffset;
   const uint8_t width = glyph->width;
   const uint8_t height = glyph->height;
   const int left = glyph->left;
 
+  if (width == 0 || height == 0) {
+    *x += glyph->advanceX;
+    return;
+  }
+
+  // Fast path: blit the glyph from the cache of pre-rotated bitmaps
+  const GlyphCache::Entry* cached = glyphCache.find(
+      {glyph, static_cast<uint8_t>(renderMode), static_cast<uint8_t>(orientation), textEmbolden});
+  if (!cached) {
+    cached = cacheGlyph(glyph, fontData);
+  }
+  if (cached) {
+    // In the gray planes pixels are flagged in reverse, see below
+    const bool state = (!is2Bit || renderMode == BW) ? pixelState : false;
+    if (drawCachedGlyph(*cached, *x + left, *y - glyph->top, state)) {
+      *x += glyph->advanceX;
+      return;
+    }
+  }
+
   const uint8_t* bitmap = nullptr;
-  bitmap = &fontFamily.getData(style)->bitmap[offset];
+  bitmap = &fontData->bitmap[offset];
 
   if (bitmap != nullptr) {
+    // One decoded glyph row, with room for the pixels added by synthetic bold
+    uint8_t rowValues[UINT8_MAX + MAX_TEXT_EMBOLDEN];
+    const int emboldenedWidth = width + textEmbolden;
+
     for (int glyphY = 0; glyphY < height; glyphY++) {
       const int screenY = *y - glyph->top + glyphY;
-      for (int glyphX = 0; glyphX < width; glyphX++) {
-        const int pixelPosition = glyphY * width + glyphX;
-        const int screenX = *x + left + glyphX;
+      decodeGlyphRow(bitmap, is2Bit, width, glyphY, rowValues);
 
-        if (is2Bit) {
-          const uint8_t byte = bitmap[pixelPosition / 4];
-          const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
-
-          if (renderMode == BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            drawPixel(screenX, screenY, false);
-          } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            drawPixel(screenX, screenY, false);
-          }
-        } else {
-          const uint8_t byte = bitmap[pixelPosition / 8];
-          const uint8_t bit_index = 7 - (pixelPosition % 8);
+      for (int glyphX = 0; glyphX < emboldenedWidth; glyphX++) {
+        const uint8_t bmpVal = emboldenedValue(rowValues, width, glyphX, textEmbolden);
+        if (bmpVal == 3) {
+          continue;
+        }
 
-          if ((byte >> bit_index) & 1) {
-            drawPixel(screenX, screenY, pixelState);
-          }
+        const int screenX = *x + left + glyphX;
+
+        if (renderMode == GRAYSCALE_CAPTURE) {
+          // Keep the gray level, the BW and gray planes are derived from the capture later
+          drawPixelGrayCapture(screenX, screenY, bmpVal);
+        } else if (!is2Bit || renderMode == BW) {
+          // Black (also paints over the grays in BW mode)
+          drawPixel(screenX, screenY, pixelState);
+        } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+          // Light gray (also mark the MSB if it's going to be a dark gray too)
+          // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
+          drawPixel(screenX, screenY, false);
+        } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
+          // Dark gray
+          drawPixel(screenX, screenY, false);
         }
       }
     }
@@ -3,9 +3,13 @@
 #include <EpdFontFamily.h>
 #include <HalDisplay.h>
 
-#include <map>
+#include <algorithm>
+#include <functional>
 
 #include "Bitmap.h"
+#include "DirtyRegion.h"
+#include "FontRegistry.h"
+#include "GlyphCache.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -13,7 +17,8 @@ enum Color : uint8_t { Clear = 0x00, White = 0x01, LightGray = 0x05, DarkGray =
 
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // GRAYSCALE_CAPTURE is set by beginGrayscaleCapture() and should not be selected through setRenderMode()
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, GRAYSCALE_CAPTURE };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -28,26 +33,63 @@ class GfxRenderer {
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = HalDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == HalDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
+  static constexpr size_t GRAY_CAPTURE_ROWS_PER_CHUNK = BW_BUFFER_CHUNK_SIZE / HalDisplay::DISPLAY_WIDTH_BYTES;
+  static_assert(GRAY_CAPTURE_ROWS_PER_CHUNK * HalDisplay::DISPLAY_WIDTH_BYTES == BW_BUFFER_CHUNK_SIZE,
+                "Grayscale capture chunks must hold whole panel rows");
+  static constexpr size_t GLYPH_CACHE_BUDGET = 16 * 1024;
+  static constexpr uint16_t GLYPH_CACHE_ENTRIES = 128;
+  // Granularity at which displayChanges() compares the frame buffer with what the panel shows
+  static constexpr int PANEL_TILE_WIDTH_BYTES = 8;
+  static constexpr int PANEL_TILE_HEIGHT = 16;
+  static constexpr int PANEL_TILE_COLS =
+      (HalDisplay::DISPLAY_WIDTH_BYTES + PANEL_TILE_WIDTH_BYTES - 1) / PANEL_TILE_WIDTH_BYTES;
+  static constexpr int PANEL_TILE_ROWS = HalDisplay::DISPLAY_HEIGHT / PANEL_TILE_HEIGHT;
+  static_assert(PANEL_TILE_ROWS * PANEL_TILE_HEIGHT == HalDisplay::DISPLAY_HEIGHT,
+                "Panel tiles must cover whole panel rows");
 
   HalDisplay& display;
   RenderMode renderMode;
   Orientation orientation;
   bool fadingFix;
+  uint8_t textEmbolden;
   uint8_t* frameBuffer = nullptr;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
-  std::map<int, EpdFontFamily> fontMap;
+  // Planar 2bpp capture of grayscale text: [0] holds bit 1 and [1] holds bit 0 of the 0 (black) - 3 (white) value
+  uint8_t* grayCaptureChunks[2][BW_BUFFER_NUM_CHUNKS] = {{nullptr}};
+  FontRegistry fonts;
+  mutable GlyphCache glyphCache{GLYPH_CACHE_BUDGET, GLYPH_CACHE_ENTRIES};
+  // Physical areas drawn since the last clearScreen(), and areas wiped by clearScreen() since the last displayChanges()
+  mutable DirtyRegion drawnRegion;
+  mutable DirtyRegion erasedRegion;
+  mutable uint8_t lastClearColor = 0xFF;
+  // Hash of each panel tile as last sent by displayChanges(), invalid after any other refresh
+  mutable uint32_t panelTileHashes[PANEL_TILE_ROWS][PANEL_TILE_COLS] = {};
+  mutable bool panelTilesValid = false;
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
   void freeBwBufferChunks();
-  template <Color color>
-  void drawPixelDither(int x, int y) const;
-  template <Color color>
-  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir) const;
+  void freeGrayCaptureChunks();
+  void drawPixelGrayCapture(int x, int y, uint8_t value) const;
+  const GlyphCache::Entry* cacheGlyph(const EpdGlyph* glyph, const EpdFontData* fontData) const;
+  bool drawCachedGlyph(const GlyphCache::Entry& entry, int screenX, int screenY, bool state) const;
+  // Records physical pixels (inclusive, on panel) that were written outside of clearScreen()
+  void markDirty(const int phyX0, const int phyY0, const int phyX1, const int phyY1) const {
+    drawnRegion.add(phyX0, phyY0, phyX1, phyY1);
+  }
+  void markAllDirty() const { markDirty(0, 0, HalDisplay::DISPLAY_WIDTH - 1, HalDisplay::DISPLAY_HEIGHT - 1); }
+  uint32_t hashPanelTile(int row, int col) const;
+  void fillSpans(int x, int y, int width, int height, Color color) const;
+  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir, Color color) const;
 
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
-      : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+      : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false), textEmbolden(0) {}
+  ~GfxRenderer() {
+    freeBwBufferChunks();
+    freeGrayCaptureChunks();
+  }
+
+  static constexpr uint8_t MAX_TEXT_EMBOLDEN = 2;
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -65,12 +107,24 @@ class GfxRenderer {
   // Fading fix control
   void setFadingFix(const bool enabled) { fadingFix = enabled; }
 
+  // Synthetic bold: widen glyph strokes by 0-2 pixels while rendering text (doesn't change advances)
+  void setTextEmbolden(const uint8_t pixels) { textEmbolden = std::min(pixels, MAX_TEXT_EMBOLDEN); }
+  uint8_t getTextEmbolden() const { return textEmbolden; }
+
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
+  // Starts a refresh and returns while the panel waveform runs, see HalDisplay::submitBuffer().
+  // Nothing may be drawn until waitForRefresh() returns.
+  void submitBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH,
+                    std::function<void()> onComplete = nullptr) const;
+  uint32_t waitForRefresh() const { return display.waitForRefresh(); }
+  // Windowed fast refresh of a rectangular region only
+  void displayWindow(int x, int y, int width, int height) const;
+  // Refreshes only the window that changed since the last displayChanges(), or nothing if the panel is up to date.
+  // Falls back to displayBuffer(fallbackMode) when the panel content is unknown or most of it changed.
+  void displayChanges(HalDisplay::RefreshMode fallbackMode = HalDisplay::FAST_REFRESH) const;
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
@@ -98,6 +152,8 @@ class GfxRenderer {
   void fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state = true) const;
 
   // Text
+  // The font family registered as `fontId`, or nullptr. For measuring text without going through the renderer.
+  const EpdFontFamily* getFont(int fontId) const;
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawCenteredText(int fontId, int y, const char* text, bool black = true,
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
@@ -123,8 +179,17 @@ class GfxRenderer {
   bool storeBwBuffer();    // Returns true if buffer was stored successfully
   void restoreBwBuffer();  // Restore and free the stored buffer
   void cleanupGrayscaleWithFrameBuffer() const;
+  // Single-rasterization grayscale text: render once into a 2bpp capture and derive the BW, LSB and MSB planes from it
+  bool beginGrayscaleCapture();    // Returns false if the capture could not be allocated
+  void endGrayscaleCapture();      // Merges the captured text into the BW frame buffer
+  void displayGrayscaleCapture();  // Call after displayBuffer(), pushes the gray planes and frees the capture
+
+  // Glyph cache diagnostics
+  GlyphCache::Stats getGlyphCacheStats() const { return glyphCache.getStats(); }
 
   // Low level functions
-  uint8_t* getFrameBuffer() const;
+  uint8_t* getFrameBuffer() const;  // Marks the whole buffer as drawn, callers may write anywhere
+  // Read-only access that leaves the dirty tracking alone
+  const uint8_t* peekFrameBuffer() const { return frameBuffer; }
   static size_t getBufferSize();
 };
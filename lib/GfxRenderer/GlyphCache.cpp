@@ -0,0 +1,179 @@
+#include "GlyphCache.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+GlyphCache::GlyphCache(const size_t budgetBytes, const uint16_t maxEntries)
+    : budgetBytes(budgetBytes), maxEntries(maxEntries) {
+  uint32_t tableSize = 2;
+  while (tableSize < 2u * maxEntries) {
+    tableSize <<= 1;
+  }
+  tableMask = static_cast<uint16_t>(tableSize - 1);
+}
+
+uint16_t GlyphCache::bucket(const Key& key) const {
+  // Glyphs are array elements a few bytes apart, mix the address before masking
+  uint32_t hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(key.glyph)) ^
+                  (static_cast<uint32_t>(key.renderMode) << 24) ^ (static_cast<uint32_t>(key.orientation) << 27) ^
+                  (static_cast<uint32_t>(key.embolden) << 29);
+  hash *= 0x9E3779B1u;
+  return static_cast<uint16_t>((hash >> 16) & tableMask);
+}
+
+uint16_t GlyphCache::findSlot(const Key& key) const {
+  uint16_t position = bucket(key);
+  while (table[position] != NONE && !(slots[table[position]].key == key)) {
+    position = (position + 1) & tableMask;
+  }
+  return position;
+}
+
+const GlyphCache::Entry* GlyphCache::find(const Key& key) {
+  const uint16_t slot = table ? table[findSlot(key)] : NONE;
+  if (slot == NONE) {
+    misses++;
+    return nullptr;
+  }
+
+  hits++;
+  if (slot != newest) {
+    unlink(slot);
+    linkNewest(slot);
+  }
+  return &slots[slot];
+}
+
+bool GlyphCache::allocatePool() {
+  slots.reset(new (std::nothrow) Entry[maxEntries]);
+  table.reset(new (std::nothrow) uint16_t[tableMask + 1u]);
+  if (!slots || !table) {
+    LOG_ERR("GLC", "Failed to allocate glyph cache pool (%zu bytes)", poolBytes());
+    slots.reset();
+    table.reset();
+    return false;
+  }
+  for (uint16_t slot = 0; slot < maxEntries; slot++) {
+    slots[slot].older = slot + 1 < maxEntries ? slot + 1 : NONE;
+  }
+  freeSlots = 0;
+  std::fill_n(table.get(), tableMask + 1u, NONE);
+  bytesUsed = poolBytes();
+  return true;
+}
+
+GlyphCache::Entry* GlyphCache::insert(const Key& key, const int16_t offsetX, const int16_t offsetY,
+                                      const uint16_t width, const uint16_t height, const uint8_t planes) {
+  const uint8_t rowBytes = (width + 7) / 8;
+  const size_t dataSize = static_cast<size_t>(planes) * height * rowBytes;
+  if (poolBytes() + dataSize > budgetBytes) {
+    rejected++;
+    return nullptr;
+  }
+  if (!slots && !allocatePool()) {
+    return nullptr;
+  }
+
+  while (entries > 0 && (entries == maxEntries || bytesUsed + dataSize > budgetBytes)) {
+    evictOldest();
+  }
+
+  std::unique_ptr<uint8_t[]> data(new (std::nothrow) uint8_t[dataSize]);
+  if (!data) {
+    LOG_ERR("GLC", "Failed to allocate glyph cache entry (%zu bytes)", dataSize);
+    return nullptr;
+  }
+  memset(data.get(), 0, dataSize);
+
+  const uint16_t slot = freeSlots;
+  Entry& entry = slots[slot];
+  freeSlots = entry.older;
+  entry.key = key;
+  entry.offsetX = offsetX;
+  entry.offsetY = offsetY;
+  entry.width = width;
+  entry.height = height;
+  entry.rowBytes = rowBytes;
+  entry.planes = planes;
+  entry.data = std::move(data);
+  linkNewest(slot);
+  table[findSlot(key)] = slot;
+  entries++;
+  bytesUsed += dataSize;
+  return &entry;
+}
+
+void GlyphCache::unlink(const uint16_t slot) {
+  const Entry& entry = slots[slot];
+  if (entry.newer != NONE) {
+    slots[entry.newer].older = entry.older;
+  } else {
+    newest = entry.older;
+  }
+  if (entry.older != NONE) {
+    slots[entry.older].newer = entry.newer;
+  } else {
+    oldest = entry.newer;
+  }
+}
+
+void GlyphCache::linkNewest(const uint16_t slot) {
+  Entry& entry = slots[slot];
+  entry.newer = NONE;
+  entry.older = newest;
+  if (newest != NONE) {
+    slots[newest].newer = slot;
+  } else {
+    oldest = slot;
+  }
+  newest = slot;
+}
+
+void GlyphCache::removeFromTable(uint16_t position) {
+  // Backward shift deletion: move later entries of the probe run into the hole so lookups never stop early
+  table[position] = NONE;
+  for (uint16_t next = (position + 1) & tableMask; table[next] != NONE; next = (next + 1) & tableMask) {
+    const uint16_t home = bucket(slots[table[next]].key);
+    // Move the entry if its home bucket is not cyclically within (position, next]
+    if (((next - home) & tableMask) >= ((next - position) & tableMask)) {
+      table[position] = table[next];
+      table[next] = NONE;
+      position = next;
+    }
+  }
+}
+
+void GlyphCache::evictOldest() {
+  const uint16_t slot = oldest;
+  Entry& entry = slots[slot];
+  removeFromTable(findSlot(entry.key));
+  unlink(slot);
+  bytesUsed -= entry.sizeBytes();
+  entry.data.reset();
+  entry.older = freeSlots;
+  freeSlots = slot;
+  entries--;
+  evictions++;
+}
+
+void GlyphCache::clear() {
+  slots.reset();
+  table.reset();
+  entries = 0;
+  newest = oldest = freeSlots = NONE;
+  bytesUsed = 0;
+}
+
+GlyphCache::Stats GlyphCache::getStats() const {
+  return Stats{hits, misses, evictions, rejected, entries, bytesUsed, budgetBytes};
+}
+
+void GlyphCache::resetStats() {
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+  rejected = 0;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <EpdFontData.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Bounded LRU cache of glyphs that were already decoded and rotated into the panel's physical 1bpp layout.
+// Drawing a cached glyph is a handful of shifted byte writes instead of per-pixel unpacking and rotation.
+// Entries live in a fixed pool of slots linked into the LRU list by index and found through an open addressing table,
+// so only the glyph bitmaps are allocated per entry.
+class GlyphCache {
+ public:
+  struct Key {
+    const EpdGlyph* glyph;  // Unique per font, style and glyph index
+    uint8_t renderMode;
+    uint8_t orientation;
+    uint8_t embolden;
+
+    bool operator==(const Key& other) const {
+      return glyph == other.glyph && renderMode == other.renderMode && orientation == other.orientation &&
+             embolden == other.embolden;
+    }
+  };
+
+  struct Entry {
+    Key key;
+    int16_t offsetX;  // Physical position of the bitmap's top-left corner relative to the glyph's top-left pixel
+    int16_t offsetY;
+    uint16_t width;  // Physical size in pixels
+    uint16_t height;
+    uint8_t rowBytes;
+    // 1: ink mask (set bit = draw the pixel). 2: grayscale capture, plane 0 holds bit 1 and plane 1 holds bit 0 of the
+    // pixel value, white (3) outside the glyph.
+    uint8_t planes;
+    std::unique_ptr<uint8_t[]> data;  // planes * height * rowBytes
+    uint16_t newer;                   // LRU neighbours, slot indices owned by the cache
+    uint16_t older;
+
+    uint8_t* plane(const int index) const { return data.get() + index * height * rowBytes; }
+    size_t sizeBytes() const { return static_cast<size_t>(planes) * height * rowBytes; }
+  };
+
+  struct Stats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t rejected;  // Glyphs too large to ever fit in the budget
+    uint32_t entries;
+    size_t bytesUsed;
+    size_t budgetBytes;
+  };
+
+  // The slot pool (allocated on first insert) and the bitmaps share budgetBytes
+  GlyphCache(size_t budgetBytes, uint16_t maxEntries);
+
+  // Returns the cached glyph and marks it as most recently used, or nullptr. Counts a hit or a miss.
+  const Entry* find(const Key& key);
+  // Allocates a new entry (data zeroed), evicting the least recently used glyphs to stay within budget.
+  // Returns nullptr if the entry can't fit or allocation failed.
+  Entry* insert(const Key& key, int16_t offsetX, int16_t offsetY, uint16_t width, uint16_t height, uint8_t planes);
+  void clear();
+
+  Stats getStats() const;
+  void resetStats();
+
+ private:
+  static constexpr uint16_t NONE = 0xFFFF;
+
+  size_t budgetBytes;
+  uint16_t maxEntries;
+  uint16_t tableMask;  // Table size - 1, a power of two at least twice maxEntries
+  size_t bytesUsed = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t evictions = 0;
+  uint32_t rejected = 0;
+
+  std::unique_ptr<Entry[]> slots;
+  std::unique_ptr<uint16_t[]> table;  // Slot index or NONE, linear probing
+  uint16_t entries = 0;
+  uint16_t newest = NONE;
+  uint16_t oldest = NONE;
+  uint16_t freeSlots = NONE;  // Unused slots chained through Entry::older
+
+  size_t poolBytes() const { return maxEntries * sizeof(Entry) + (tableMask + 1u) * sizeof(uint16_t); }
+  uint16_t bucket(const Key& key) const;
+  uint16_t findSlot(const Key& key) const;  // Table position of the key, or of the empty bucket ending its probe
+  bool allocatePool();
+  void unlink(uint16_t slot);
+  void linkNewest(uint16_t slot);
+  void removeFromTable(uint16_t position);
+  void evictOldest();
+};
@@ -34,7 +34,7 @@ bool KOReaderCredentialStore::saveToFile() const {
   // Make sure the directory exists
   Storage.mkdir("/.crosspoint");
 
-  FsFile file;
+  HalFile file;
   if (!Storage.openFileForWrite("KRS", KOREADER_FILE, file)) {
     return false;
   }
@@ -63,7 +63,7 @@ bool KOReaderCredentialStore::saveToFile() const {
 }
 
 bool KOReaderCredentialStore::loadFromFile() {
-  FsFile file;
+  HalFile file;
   if (!Storage.openFileForRead("KRS", KOREADER_FILE, file)) {
     LOG_DBG("KRS", "No credentials file found");
     return false;
@@ -0,0 +1,141 @@
+#include "HeapAccounting.h"
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace {
+constexpr const char* TAG_NAMES[] = {"other", "zip", "parser", "layout", "renderer", "network", "image"};
+static_assert(sizeof(TAG_NAMES) / sizeof(TAG_NAMES[0]) == static_cast<size_t>(HeapTag::COUNT));
+
+struct AtomicTagStats {
+  std::atomic<uint32_t> allocations{0};
+  std::atomic<uint32_t> allocatedBytes{0};
+  std::atomic<uint32_t> scopes{0};
+  std::atomic<uint32_t> lastPeakBytes{0};
+  std::atomic<uint32_t> maxPeakBytes{0};
+};
+
+AtomicTagStats stats[static_cast<size_t>(HeapTag::COUNT)];
+
+// Per task: the tag of the innermost scope and the lowest free heap seen since that scope started
+thread_local HeapTag currentTag = HeapTag::Other;
+thread_local uint32_t scopeMinFree = UINT32_MAX;
+
+AtomicTagStats& statsFor(const HeapTag tag) { return stats[static_cast<size_t>(tag)]; }
+}  // namespace
+
+#ifdef HEAP_ACCOUNTING
+#if CROSSPOINT_EMULATED == 0
+// Targets of the --wrap linker flags in platformio.ini. free() isn't wrapped, scopes measure the free heap instead.
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(const size_t size) {
+  void* ptr = __real_malloc(size);
+  if (ptr) {
+    HeapAccounting::onAllocation(size);
+  }
+  return ptr;
+}
+
+void* __wrap_calloc(const size_t count, const size_t size) {
+  void* ptr = __real_calloc(count, size);
+  if (ptr) {
+    HeapAccounting::onAllocation(count * size);
+  }
+  return ptr;
+}
+
+void* __wrap_realloc(void* ptr, const size_t size) {
+  void* result = __real_realloc(ptr, size);
+  if (result && size > 0) {
+    HeapAccounting::onAllocation(size);
+  }
+  return result;
+}
+}
+#endif
+
+void HeapAccounting::onAllocation(const size_t size) {
+  AtomicTagStats& tagStats = statsFor(currentTag);
+  tagStats.allocations.fetch_add(1, std::memory_order_relaxed);
+  tagStats.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  if (scopeMinFree != UINT32_MAX) {
+    scopeMinFree = std::min(scopeMinFree, static_cast<uint32_t>(ESP.getFreeHeap()));
+  }
+}
+
+HeapAccounting::Scope::Scope(const HeapTag tag) : tag(tag), outerTag(currentTag), outerMinFree(scopeMinFree) {
+  startFree = ESP.getFreeHeap();
+  currentTag = tag;
+  scopeMinFree = startFree;
+  statsFor(tag).scopes.fetch_add(1, std::memory_order_relaxed);
+}
+
+HeapAccounting::Scope::~Scope() {
+  const uint32_t minFree = std::min(scopeMinFree, static_cast<uint32_t>(ESP.getFreeHeap()));
+  const uint32_t peak = startFree > minFree ? startFree - minFree : 0;
+  AtomicTagStats& tagStats = statsFor(tag);
+  tagStats.lastPeakBytes.store(peak, std::memory_order_relaxed);
+  uint32_t maxPeak = tagStats.maxPeakBytes.load(std::memory_order_relaxed);
+  while (peak > maxPeak && !tagStats.maxPeakBytes.compare_exchange_weak(maxPeak, peak, std::memory_order_relaxed)) {
+  }
+  currentTag = outerTag;
+  // The outer scope's low point includes this one's
+  scopeMinFree = outerMinFree == UINT32_MAX ? UINT32_MAX : std::min(outerMinFree, minFree);
+}
+#else
+void HeapAccounting::onAllocation(size_t) {}
+HeapAccounting::Scope::Scope(const HeapTag tag)
+    : tag(tag), outerTag(HeapTag::Other), startFree(0), outerMinFree(UINT32_MAX) {}
+HeapAccounting::Scope::~Scope() {}
+#endif
+
+const char* HeapAccounting::tagName(const HeapTag tag) { return TAG_NAMES[static_cast<size_t>(tag)]; }
+
+HeapAccounting::TagStats HeapAccounting::tagStats(const HeapTag tag) {
+  const AtomicTagStats& source = statsFor(tag);
+  TagStats result;
+  result.allocations = source.allocations.load(std::memory_order_relaxed);
+  result.allocatedBytes = source.allocatedBytes.load(std::memory_order_relaxed);
+  result.scopes = source.scopes.load(std::memory_order_relaxed);
+  result.lastPeakBytes = source.lastPeakBytes.load(std::memory_order_relaxed);
+  result.maxPeakBytes = source.maxPeakBytes.load(std::memory_order_relaxed);
+  return result;
+}
+
+HeapAccounting::HeapSummary HeapAccounting::summary() {
+  HeapSummary result;
+  result.totalBytes = ESP.getHeapSize();
+  result.freeBytes = ESP.getFreeHeap();
+  result.minFreeBytes = ESP.getMinFreeHeap();
+  result.largestFreeBlock = ESP.getMaxAllocHeap();
+  result.fragmentationPercent =
+      result.freeBytes > 0 ? 100 - std::min<uint32_t>(100, result.largestFreeBlock * 100ull / result.freeBytes) : 0;
+  return result;
+}
+
+void HeapAccounting::printReport(Print& out) {
+  const HeapSummary heap = summary();
+  out.printf("HEAP: free %lu of %lu bytes, min free %lu, largest block %lu, fragmentation %u%%\n",
+             static_cast<unsigned long>(heap.freeBytes), static_cast<unsigned long>(heap.totalBytes),
+             static_cast<unsigned long>(heap.minFreeBytes), static_cast<unsigned long>(heap.largestFreeBlock),
+             heap.fragmentationPercent);
+#ifdef HEAP_ACCOUNTING
+  out.printf("HEAP: %-9s %10s %12s %7s %10s %10s\n", "tag", "allocs", "bytes", "scopes", "last peak", "max peak");
+  for (size_t i = 0; i < static_cast<size_t>(HeapTag::COUNT); i++) {
+    const auto tag = static_cast<HeapTag>(i);
+    const TagStats tagStats = HeapAccounting::tagStats(tag);
+    out.printf("HEAP: %-9s %10lu %12lu %7lu %10lu %10lu\n", tagName(tag),
+               static_cast<unsigned long>(tagStats.allocations), static_cast<unsigned long>(tagStats.allocatedBytes),
+               static_cast<unsigned long>(tagStats.scopes), static_cast<unsigned long>(tagStats.lastPeakBytes),
+               static_cast<unsigned long>(tagStats.maxPeakBytes));
+  }
+#else
+  out.printf("HEAP: per subsystem accounting needs a HEAP_ACCOUNTING build\n");
+#endif
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Print.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+Heap accounting per subsystem, to tell what a low-memory crash was doing.
+
+Define HEAP_ACCOUNTING to compile it in, otherwise HEAP_SCOPE is empty. Allocations are counted by allocator hooks:
+the -Wl,--wrap=malloc/calloc/realloc linker flags on the device, the malloc wrappers of host/src/HostStats.cpp on the
+host. An allocation counts towards the innermost HEAP_SCOPE of the allocating task, or "other" outside of any.
+
+    bool Section::build() {
+      HEAP_SCOPE(HeapTag::Layout);  // Counts allocations and records how far the free heap dropped in this scope
+      ...
+    }
+
+The drop is measured against the free heap when the scope started, so it also covers allocations of other tasks and
+of heap_caps_malloc() callers that the hooks don't see. CMD:HEAP prints the report, GET /api/heap returns it as JSON.
+*/
+
+enum class HeapTag : uint8_t { Other, Zip, Parser, Layout, Renderer, Network, Image, COUNT };
+
+namespace HeapAccounting {
+struct TagStats {
+  uint32_t allocations = 0;
+  uint32_t allocatedBytes = 0;
+  uint32_t scopes = 0;
+  // How far the free heap dropped below its value at the start of the last completed scope, and the worst of them
+  uint32_t lastPeakBytes = 0;
+  uint32_t maxPeakBytes = 0;
+};
+
+struct HeapSummary {
+  uint32_t totalBytes;
+  uint32_t freeBytes;
+  uint32_t minFreeBytes;
+  uint32_t largestFreeBlock;
+  // Share of the free heap that can't be had in one allocation, 100 * (1 - largest block / free)
+  uint8_t fragmentationPercent;
+};
+
+// Called by the allocator hooks after every successful allocation
+void onAllocation(size_t size);
+
+const char* tagName(HeapTag tag);
+TagStats tagStats(HeapTag tag);
+HeapSummary summary();
+void printReport(Print& out);
+
+class Scope {
+  HeapTag tag;
+  HeapTag outerTag;
+  uint32_t startFree;
+  uint32_t outerMinFree;
+
+ public:
+  explicit Scope(HeapTag tag);
+  ~Scope();
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+};
+}  // namespace HeapAccounting
+
+#ifdef HEAP_ACCOUNTING
+#define HEAP_SCOPE_CONCAT_INNER(a, b) a##b
+#define HEAP_SCOPE_CONCAT(a, b) HEAP_SCOPE_CONCAT_INNER(a, b)
+#define HEAP_SCOPE(tag) const HeapAccounting::Scope HEAP_SCOPE_CONCAT(heapScope, __LINE__)(tag)
+#else
+#define HEAP_SCOPE(tag)
+#endif
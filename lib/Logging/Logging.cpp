@@ -1,5 +1,8 @@
 #include "Logging.h"
 
+#include <algorithm>
+#include <cstdarg>
+
 // Since logging can take a large amount of flash, we want to make the format string as short as possible.
 // This logPrintf prepend the timestamp, level and origin to the user-provided message, so that the user only needs to
 // provide the format string for the message itself.
@@ -45,3 +48,27 @@ void logPrintf(const char* level, const char* origin, const char* format, ...) {
   va_end(args);
   logSerial.print(buf);
 }
+
+// Serial is MySerialImpl::instance outside this file's logSerial, so direct Serial.printf calls still reach the port
+MySerialImpl MySerialImpl::instance;
+
+size_t MySerialImpl::printf(const char* format, ...) {
+  if (!logSerial) {
+    return 0;
+  }
+  va_list args;
+  va_start(args, format);
+  char buf[256];
+  const int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0) {
+    return 0;
+  }
+  return logSerial.write(reinterpret_cast<const uint8_t*>(buf), std::min(static_cast<size_t>(len), sizeof(buf) - 1));
+}
+
+size_t MySerialImpl::write(const uint8_t b) { return logSerial.write(b); }
+
+size_t MySerialImpl::write(const uint8_t* buffer, const size_t size) { return logSerial.write(buffer, size); }
+
+void MySerialImpl::flush() { logSerial.flush(); }
@@ -0,0 +1,58 @@
+#include "Trace.h"
+
+#ifdef ENABLE_TRACE
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+
+namespace {
+struct Event {
+  uint32_t timestampUs;
+  uint32_t arg;
+  const char* name;
+  TaskHandle_t task;
+  TraceModule module;
+  Trace::Phase phase;
+};
+
+constexpr const char* MODULE_NAMES[] = {"reader", "section", "zip", "display", "worker"};
+static_assert(sizeof(MODULE_NAMES) / sizeof(MODULE_NAMES[0]) == static_cast<size_t>(TraceModule::COUNT));
+
+Event events[TRACE_BUFFER_EVENTS];
+// Total events recorded, the slot of an event is its number modulo the buffer size
+std::atomic<uint32_t> recorded{0};
+}  // namespace
+
+void Trace::record(const TraceModule module, const Phase phase, const char* name, const uint32_t arg) {
+  const uint32_t number = recorded.fetch_add(1, std::memory_order_relaxed);
+  Event& event = events[number % TRACE_BUFFER_EVENTS];
+  event.timestampUs = micros();
+  event.arg = arg;
+  event.name = name;
+  event.task = xTaskGetCurrentTaskHandle();
+  event.module = module;
+  event.phase = phase;
+}
+
+void Trace::clear() { recorded.store(0, std::memory_order_relaxed); }
+
+void Trace::dump(Print& out) {
+  // Events recorded while dumping may overwrite the oldest ones, the dump is still one line per slot
+  const uint32_t total = recorded.load(std::memory_order_relaxed);
+  const uint32_t count = total < TRACE_BUFFER_EVENTS ? total : TRACE_BUFFER_EVENTS;
+  out.printf("TRACE_START:%lu,%lu\n", static_cast<unsigned long>(count), static_cast<unsigned long>(total - count));
+  for (uint32_t number = total - count; number < total; number++) {
+    const Event& event = events[number % TRACE_BUFFER_EVENTS];
+    out.printf("TRACE:%lu,%c,%s,%p,%lu,%s\n", static_cast<unsigned long>(event.timestampUs),
+               static_cast<char>(event.phase), MODULE_NAMES[static_cast<size_t>(event.module)],
+               static_cast<void*>(event.task), static_cast<unsigned long>(event.arg), event.name);
+  }
+  out.printf("TRACE_END\n");
+}
+#else
+void Trace::record(TraceModule, Phase, const char*, uint32_t) {}
+void Trace::clear() {}
+void Trace::dump(Print& out) { out.printf("TRACE_START:0,0\nTRACE_END\n"); }
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Print.h>
+
+#include <cstdint>
+
+/*
+Binary trace events, for timing work without the cost (and the timing distortion) of formatted logging.
+
+Define ENABLE_TRACE to compile them in, otherwise the macros are empty. Events are a timestamp in microseconds, the
+module, a name, a 32 bit argument and the FreeRTOS task, written to a fixed RAM ring buffer of TRACE_BUFFER_EVENTS
+entries (the oldest are overwritten). Names must be string literals, only the pointer is stored.
+
+    void Section::build() {
+      TRACE_SCOPE(TraceModule::Section, "buildSection", spineIndex);  // Begin now, end when the scope exits
+      ...
+      TRACE_INSTANT(TraceModule::Section, "pageDone", pageCount);
+    }
+
+CMD:TRACE on the serial port dumps the buffer (CMD:TRACE_CLEAR empties it), scripts/debugging_monitor.py saves the
+dump as Chrome trace JSON for chrome://tracing or ui.perfetto.dev.
+*/
+
+#ifndef TRACE_BUFFER_EVENTS
+#define TRACE_BUFFER_EVENTS 256
+#endif
+
+enum class TraceModule : uint8_t { Reader, Section, Zip, Display, Worker, COUNT };
+
+namespace Trace {
+enum class Phase : uint8_t { Begin = 'B', End = 'E', Instant = 'i' };
+
+void record(TraceModule module, Phase phase, const char* name, uint32_t arg);
+void clear();
+// Writes the buffered events oldest first, one line each, between TRACE_START:<count>,<dropped> and TRACE_END
+void dump(Print& out);
+
+class Scope {
+  TraceModule module;
+  const char* name;
+  uint32_t arg;
+
+ public:
+  Scope(const TraceModule module, const char* name, const uint32_t arg) : module(module), name(name), arg(arg) {
+    record(module, Phase::Begin, name, arg);
+  }
+  ~Scope() { record(module, Phase::End, name, arg); }
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+};
+}  // namespace Trace
+
+#ifdef ENABLE_TRACE
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(module, name, arg) const Trace::Scope TRACE_CONCAT(traceScope, __LINE__)(module, name, arg)
+#define TRACE_INSTANT(module, name, arg) Trace::record(module, Trace::Phase::Instant, name, arg)
+#else
+#define TRACE_SCOPE(module, name, arg)
+#define TRACE_INSTANT(module, name, arg)
+#endif
@@ -0,0 +1,223 @@
+#include "TxtPaginator.h"
+
+#include <Utf8.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+size_t codepointLength(const char lead) {
+  const auto c = static_cast<unsigned char>(lead);
+  if ((c >> 5) == 0x6) return 2;
+  if ((c >> 4) == 0xE) return 3;
+  if ((c >> 3) == 0x1E) return 4;
+  return 1;  // ASCII, or an invalid byte on its own like utf8NextCodepoint() takes it
+}
+}  // namespace
+
+TxtPaginator::TxtPaginator(const EpdFontFamily& font, const int maxWidth, const int linesPerPage)
+    : font(font), maxWidth(maxWidth), linesPerPage(linesPerPage) {}
+
+void TxtPaginator::restart(const size_t offset) {
+  this->offset = offset;
+  resetLine(offset);
+  pageLines = 0;
+  stopped = false;
+  pendingCR = false;
+  sequenceLength = 0;
+}
+
+bool TxtPaginator::feed(const uint8_t* data, const size_t length) {
+  for (size_t i = 0; i < length && !stopped; i++, offset++) {
+    const char c = static_cast<char>(data[i]);
+    if (sequenceLength > 0) {
+      if (c != '\n') {
+        sequence[sequenceLength++] = c;
+        if (sequenceLength == sequenceExpected) {
+          sequenceLength = 0;
+          addCodepoint(sequence, sequenceExpected);
+        }
+        continue;
+      }
+      // A line end cuts the sequence short
+      const size_t cut = sequenceLength;
+      sequenceLength = 0;
+      addCodepoint(sequence, cut);
+    }
+
+    if (pendingCR) {
+      pendingCR = false;
+      if (c == '\n') {
+        endLine(offset + 1);
+        continue;
+      }
+      addCodepoint("\r", 1);
+    }
+
+    if (c == '\r') {
+      pendingCR = true;
+    } else if (c == '\n') {
+      endLine(offset + 1);
+    } else if (const size_t expected = codepointLength(c); expected == 1) {
+      addCodepoint(&c, 1);
+    } else {
+      sequence[0] = c;
+      sequenceLength = 1;
+      sequenceExpected = expected;
+    }
+  }
+  return !stopped;
+}
+
+void TxtPaginator::finish() {
+  if (sequenceLength > 0 && !stopped) {
+    const size_t cut = sequenceLength;
+    sequenceLength = 0;
+    addCodepoint(sequence, cut);
+  }
+  // A CR right before the end of the file ends the line too
+  pendingCR = false;
+  endLine(offset);
+}
+
+const EpdGlyph* TxtPaginator::glyphOf(const uint32_t cp) {
+  if (cp < 128 && asciiGlyphs[cp]) {
+    return asciiGlyphs[cp];
+  }
+  const EpdGlyph* glyph = font.getGlyph(cp);
+  if (!glyph) {
+    glyph = font.getGlyph(REPLACEMENT_GLYPH);
+  }
+  if (cp < 128) {
+    asciiGlyphs[cp] = glyph;
+  }
+  return glyph;
+}
+
+void TxtPaginator::addCodepoint(const char* bytes, const size_t length) {
+  if (lineHeld) {
+    releaseLine();
+  }
+  appendCodepoint(bytes, length);
+  if (maxX - minX <= maxWidth) {
+    return;
+  }
+  if (endsWithSpace()) {
+    holdLine();
+    return;
+  }
+
+  // Break the line and lay out what followed the break again, it can overflow the next line too
+  std::string carried = breakLine();
+  size_t i = 0;
+  while (i < carried.size() && !stopped) {
+    const size_t n = std::min(codepointLength(carried[i]), carried.size() - i);
+    appendCodepoint(carried.data() + i, n);
+    i += n;
+    if (maxX - minX > maxWidth) {
+      if (i == carried.size() && endsWithSpace()) {
+        holdLine();
+        break;
+      }
+      carried = breakLine() + carried.substr(i);
+      i = 0;
+    }
+  }
+}
+
+bool TxtPaginator::endsWithSpace() const { return lastSpace != NO_SPACE && lastSpace + 1 == line.size(); }
+
+// The line overflowed at a space that ends it. If the source line ends there too the next line starts after the line
+// end rather than at it, so the line waits for the next byte.
+void TxtPaginator::holdLine() {
+  line.pop_back();
+  lineHeld = true;
+}
+
+void TxtPaginator::releaseLine() {
+  const size_t nextOffset = lineOffset + line.size() + 1;
+  emitLine(line, nextOffset);
+  resetLine(nextOffset);
+}
+
+// Same bounds as EpdFont::getTextBounds() for the line so far
+void TxtPaginator::appendCodepoint(const char* bytes, const size_t length) {
+  if (bytes[0] == ' ' && !line.empty()) {
+    lastSpace = line.size();
+  }
+  line.append(bytes, length);
+  lastCharBytes = length;
+
+  uint32_t cp = static_cast<unsigned char>(bytes[0]);
+  if (length > 1) {
+    unsigned char buffer[5] = {};
+    memcpy(buffer, bytes, length);
+    const unsigned char* next = buffer;
+    cp = utf8NextCodepoint(&next);
+  }
+  if (cp == 0) {
+    return;  // getTextWidth() stops at a NUL
+  }
+
+  const EpdGlyph* glyph = glyphOf(cp);
+  if (!glyph) {
+    return;
+  }
+  minX = std::min(minX, cursorX + glyph->left);
+  maxX = std::max(maxX, cursorX + glyph->left + glyph->width);
+  cursorX += glyph->advanceX;
+}
+
+// Emits the part of the overflowing line that fits and returns the text after the break
+std::string TxtPaginator::breakLine() {
+  size_t cut;
+  size_t next;
+  if (lastSpace != NO_SPACE) {
+    cut = lastSpace;
+    next = lastSpace + 1;
+  } else {
+    // Before the character that didn't fit, unless it is alone on the line
+    cut = line.size() > lastCharBytes ? line.size() - lastCharBytes : line.size();
+    next = cut;
+  }
+
+  std::string carried = line.substr(next);
+  line.resize(cut);
+  const size_t nextOffset = lineOffset + next;
+  emitLine(line, nextOffset);
+  resetLine(nextOffset);
+  return carried;
+}
+
+void TxtPaginator::endLine(const size_t nextOffset) {
+  if (!line.empty()) {
+    emitLine(line, nextOffset);
+  }
+  resetLine(nextOffset);
+}
+
+void TxtPaginator::emitLine(const std::string_view text, const size_t nextOffset) {
+  if (stopped) {
+    return;
+  }
+  if (onLine) {
+    onLine(text, nextOffset);
+  }
+  if (++pageLines == linesPerPage) {
+    pageLines = 0;
+    if (onPage && !onPage(nextOffset)) {
+      stopped = true;
+    }
+  }
+}
+
+void TxtPaginator::resetLine(const size_t nextOffset) {
+  line.clear();
+  lineOffset = nextOffset;
+  lastSpace = NO_SPACE;
+  lastCharBytes = 0;
+  lineHeld = false;
+  cursorX = 0;
+  minX = 0;
+  maxX = 0;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+// Word wraps plain text into lines and pages in a single pass over the file. Bytes are fed in as they are read, every
+// codepoint is measured once and the line's width is kept up to date as it grows, so the work is linear in the text
+// however long its lines are. Widths are the ink bounds getTextWidth() measures. A line breaks at its last space
+// that fits (the space is dropped) or, without one, before the first character that doesn't fit. Empty lines take
+// no room, CR LF line ends are accepted.
+class TxtPaginator {
+ public:
+  // A line of the page and the file offset of the line after it
+  using LineFn = std::function<void(std::string_view line, size_t nextOffset)>;
+  // Called when a page is full with the file offset the next page starts at, returning false stops feed()
+  using PageFn = std::function<bool(size_t nextPageOffset)>;
+
+  TxtPaginator(const EpdFontFamily& font, int maxWidth, int linesPerPage);
+
+  LineFn onLine;
+  PageFn onPage;
+
+  // Starts over at `offset`, which has to be where a page starts
+  void restart(size_t offset);
+  // Lays out the next bytes of the file. Returns false if onPage stopped it, the rest of `data` is then unused.
+  bool feed(const uint8_t* data, size_t length);
+  // The end of the file, lays out the last line
+  void finish();
+
+ private:
+  static constexpr size_t NO_SPACE = SIZE_MAX;
+
+  const EpdFontFamily& font;
+  const int maxWidth;
+  const int linesPerPage;
+  // Glyphs of ASCII codepoints, looked up once
+  const EpdGlyph* asciiGlyphs[128] = {};
+
+  std::string line;
+  size_t lineOffset = 0;  // File offset of line[0]
+  size_t offset = 0;      // File offset of the next byte fed
+  size_t lastSpace = NO_SPACE;
+  size_t lastCharBytes = 0;
+  bool lineHeld = false;  // See holdLine()
+  int cursorX = 0;
+  int minX = 0;
+  int maxX = 0;
+  int pageLines = 0;
+  bool stopped = false;
+  bool pendingCR = false;
+  char sequence[4] = {};  // UTF-8 sequence split between two feeds
+  size_t sequenceLength = 0;
+  size_t sequenceExpected = 0;
+
+  const EpdGlyph* glyphOf(uint32_t cp);
+  void addCodepoint(const char* bytes, size_t length);
+  bool endsWithSpace() const;
+  void holdLine();
+  void releaseLine();
+  void appendCodepoint(const char* bytes, size_t length);
+  std::string breakLine();
+  void endLine(size_t nextOffset);
+  void emitLine(std::string_view text, size_t nextOffset);
+  void resetLine(size_t nextOffset);
+};
@@ -1,12 +1,15 @@
 #include "ZipFile.h"
 
 #include <HalStorage.h>
+#include <HeapAccounting.h>
 #include <Logging.h>
+#include <Trace.h>
 #include <miniz.h>
 
 #include <algorithm>
 
 bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t* outputBuf, const size_t inflatedSize) {
+  TRACE_SCOPE(TraceModule::Zip, "inflate", inflatedSize);
   // Setup inflator
   const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
   if (!inflator) {
@@ -379,6 +382,7 @@ int ZipFile::fillUncompressedSizes(std::vector<SizeTarget>& targets, std::vector
 }
 
 uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const bool trailingNullByte) {
+  HEAP_SCOPE(HeapTag::Zip);
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return nullptr;
@@ -475,6 +479,7 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
 }
 
 bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize) {
+  HEAP_SCOPE(HeapTag::Zip);
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return false;
@@ -529,6 +534,7 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
   }
 
   if (fileStat.method == MZ_DEFLATED) {
+    TRACE_SCOPE(TraceModule::Zip, "inflateStream", inflatedDataSize);
     // Setup inflator
     const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
     if (!inflator) {
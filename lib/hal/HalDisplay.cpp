@@ -1,13 +1,56 @@
 #include <HalDisplay.h>
 #include <HalGPIO.h>
+#include <Logging.h>
+#include <Trace.h>
 
 #define SD_SPI_MISO 7
 
+EInkDisplay::RefreshMode convertRefreshMode(HalDisplay::RefreshMode mode) {
+  switch (mode) {
+    case HalDisplay::FULL_REFRESH:
+      return EInkDisplay::FULL_REFRESH;
+    case HalDisplay::HALF_REFRESH:
+      return EInkDisplay::HALF_REFRESH;
+    case HalDisplay::FAST_REFRESH:
+    default:
+      return EInkDisplay::FAST_REFRESH;
+  }
+}
+
 HalDisplay::HalDisplay() : einkDisplay(EPD_SCLK, EPD_MOSI, EPD_CS, EPD_DC, EPD_RST, EPD_BUSY) {}
 
 HalDisplay::~HalDisplay() {}
 
-void HalDisplay::begin() { einkDisplay.begin(); }
+void HalDisplay::begin() {
+  einkDisplay.begin();
+
+#ifndef DISPLAY_SYNCHRONOUS_REFRESH
+  refreshDone = xSemaphoreCreateBinary();
+  // Same priority as the activity tasks, the driver polls BUSY for most of a refresh
+  xTaskCreate(&HalDisplay::refreshTaskTrampoline, "DisplayRefreshTask", 3072, this, 1, &refreshTaskHandle);
+#endif
+}
+
+void HalDisplay::refreshTaskTrampoline(void* param) {
+  auto* self = static_cast<HalDisplay*>(param);
+  self->refreshTaskLoop();
+}
+
+void HalDisplay::refreshTaskLoop() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    {
+      TRACE_SCOPE(TraceModule::Display, "refresh", submittedMode);
+      einkDisplay.displayBuffer(convertRefreshMode(submittedMode), submittedTurnOffScreen);
+    }
+    refreshing = false;
+    if (refreshCallback) {
+      refreshCallback();
+      refreshCallback = nullptr;
+    }
+    xSemaphoreGive(refreshDone);
+  }
+}
 
 void HalDisplay::clearScreen(uint8_t color) const { einkDisplay.clearScreen(color); }
 
@@ -16,38 +59,90 @@ void HalDisplay::drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uin
   einkDisplay.drawImage(imageData, x, y, w, h, fromProgmem);
 }
 
-EInkDisplay::RefreshMode convertRefreshMode(HalDisplay::RefreshMode mode) {
-  switch (mode) {
-    case HalDisplay::FULL_REFRESH:
-      return EInkDisplay::FULL_REFRESH;
-    case HalDisplay::HALF_REFRESH:
-      return EInkDisplay::HALF_REFRESH;
-    case HalDisplay::FAST_REFRESH:
-    default:
-      return EInkDisplay::FAST_REFRESH;
+void HalDisplay::displayBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen) {
+  waitForRefresh();
+  TRACE_SCOPE(TraceModule::Display, "refresh", mode);
+  einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
+}
+
+void HalDisplay::submitBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen, std::function<void()> onComplete) {
+  waitForRefresh();
+  if (!refreshTaskHandle) {
+    // begin() hasn't run or DISPLAY_SYNCHRONOUS_REFRESH is set, refresh synchronously
+    einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
+    if (onComplete) {
+      onComplete();
+    }
+    return;
+  }
+
+  TRACE_SCOPE(TraceModule::Display, "submit", mode);
+  [[maybe_unused]] const auto start = millis();
+  submittedMode = mode;
+  submittedTurnOffScreen = turnOffScreen;
+  refreshCallback = std::move(onComplete);
+  refreshSubmitted = true;
+  refreshing = true;
+  xTaskNotifyGive(refreshTaskHandle);
+
+  // The controller raises BUSY once the frame buffer is in its RAM and the waveform runs
+  while (refreshing && digitalRead(EPD_BUSY) == LOW) {
+    vTaskDelay(1);
   }
+  LOG_DBG("DSP", "Frame buffer submitted in %lums", millis() - start);
 }
 
-void HalDisplay::displayBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen) {
-  einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
+uint32_t HalDisplay::waitForRefresh() {
+  if (!refreshSubmitted) {
+    return 0;
+  }
+  TRACE_SCOPE(TraceModule::Display, "waitForRefresh", 0);
+  const auto start = millis();
+  xSemaphoreTake(refreshDone, portMAX_DELAY);
+  refreshSubmitted = false;
+  return millis() - start;
+}
+
+void HalDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen) {
+  waitForRefresh();
+  TRACE_SCOPE(TraceModule::Display, "windowRefresh", static_cast<uint32_t>(w) * h);
+  einkDisplay.displayWindow(x, y, w, h, turnOffScreen);
 }
 
 void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen) {
+  waitForRefresh();
   einkDisplay.refreshDisplay(convertRefreshMode(mode), turnOffScreen);
 }
 
-void HalDisplay::deepSleep() { einkDisplay.deepSleep(); }
+void HalDisplay::deepSleep() {
+  waitForRefresh();
+  einkDisplay.deepSleep();
+}
 
 uint8_t* HalDisplay::getFrameBuffer() const { return einkDisplay.getFrameBuffer(); }
 
 void HalDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+  waitForRefresh();
   einkDisplay.copyGrayscaleBuffers(lsbBuffer, msbBuffer);
 }
 
-void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) { einkDisplay.copyGrayscaleLsbBuffers(lsbBuffer); }
+void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) {
+  waitForRefresh();
+  einkDisplay.copyGrayscaleLsbBuffers(lsbBuffer);
+}
 
-void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { einkDisplay.copyGrayscaleMsbBuffers(msbBuffer); }
+void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) {
+  waitForRefresh();
+  einkDisplay.copyGrayscaleMsbBuffers(msbBuffer);
+}
 
-void HalDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) { einkDisplay.cleanupGrayscaleBuffers(bwBuffer); }
+void HalDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) {
+  waitForRefresh();
+  einkDisplay.cleanupGrayscaleBuffers(bwBuffer);
+}
 
-void HalDisplay::displayGrayBuffer(bool turnOffScreen) { einkDisplay.displayGrayBuffer(turnOffScreen); }
+void HalDisplay::displayGrayBuffer(bool turnOffScreen) {
+  waitForRefresh();
+  TRACE_SCOPE(TraceModule::Display, "grayRefresh", 0);
+  einkDisplay.displayGrayBuffer(turnOffScreen);
+}
@@ -1,6 +1,12 @@
 #pragma once
 #include <Arduino.h>
 #include <EInkDisplay.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <functional>
 
 class HalDisplay {
  public:
@@ -32,6 +38,25 @@ class HalDisplay {
                  bool fromProgmem = false) const;
 
   void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  // Split version of displayBuffer(): the refresh runs on the display refresh task, and this returns as soon as the
+  // frame buffer has been sent and the panel waveform has started. The caller can then do work that doesn't touch the
+  // frame buffer (e.g. SD reads) until waitForRefresh(). onComplete is called from the refresh task once the refresh
+  // is over.
+  //
+  // SD and panel share one SPI bus. In single buffer mode the driver writes the frame buffer to the panel's second RAM
+  // once the waveform is over, which can coincide with SD traffic of the caller. That is only safe while both the
+  // driver and SdFat wrap their transfers in SPI.beginTransaction(), which holds the bus lock of the Arduino core, and
+  // each drives its own chip select. This has not been verified against the SDK driver on hardware, so the firmware
+  // is built with DISPLAY_SYNCHRONOUS_REFRESH, which makes submitBuffer() refresh synchronously like displayBuffer().
+  // The async_refresh environment in platformio.ini builds it with the overlap.
+  void submitBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false,
+                    std::function<void()> onComplete = nullptr);
+  // Blocks until the refresh started by submitBuffer() is over, returns the time spent waiting in ms
+  uint32_t waitForRefresh();
+  bool isRefreshing() const { return refreshing; }
+  // Transfers and fast-refreshes a window of the frame buffer only
+  // Physical coordinates, x and w must be multiples of 8
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
   void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
 
   // Power management
@@ -49,4 +74,15 @@ class HalDisplay {
 
  private:
   EInkDisplay einkDisplay;
+
+  TaskHandle_t refreshTaskHandle = nullptr;
+  SemaphoreHandle_t refreshDone = nullptr;
+  std::atomic<bool> refreshing{false};  // Cleared by the refresh task
+  bool refreshSubmitted = false;        // Set until the submitter has waited for the refresh
+  RefreshMode submittedMode = FAST_REFRESH;
+  bool submittedTurnOffScreen = false;
+  std::function<void()> refreshCallback;
+
+  static void refreshTaskTrampoline(void* param);
+  [[noreturn]] void refreshTaskLoop();
 };
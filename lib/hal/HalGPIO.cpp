@@ -1,3 +1,5 @@
+// Device backend, host builds (CROSSPOINT_EMULATED) use host/src/HalGPIO.cpp
+#if CROSSPOINT_EMULATED == 0
 #include <HalGPIO.h>
 #include <SPI.h>
 #include <esp_sleep.h>
@@ -61,4 +63,6 @@ HalGPIO::WakeupReason HalGPIO::getWakeupReason() const {
     return WakeupReason::AfterUSBPower;
   }
   return WakeupReason::Other;
-}
\ No newline at end of file
+}
+
+#endif  // CROSSPOINT_EMULATED == 0
@@ -2,10 +2,106 @@
 
 #include <SDCardManager.h>
 
+#include <atomic>
+#include <cstring>
+
 #define SDCard SDCardManager::getInstance()
 
 HalStorage HalStorage::instance;
 
+namespace {
+// Module tags are registered on first use, slot 0 collects untagged I/O and tags beyond the table
+constexpr uint8_t MAX_MODULES = 32;
+
+struct ModuleCounters {
+  std::atomic<const char*> module{nullptr};
+  std::atomic<uint32_t> opens{0};
+  std::atomic<uint32_t> reads{0};
+  std::atomic<uint32_t> writes{0};
+  std::atomic<uint32_t> seeks{0};
+  std::atomic<uint32_t> bytesRead{0};
+  std::atomic<uint32_t> bytesWritten{0};
+  std::atomic<uint32_t> busyUs{0};
+};
+
+ModuleCounters counters[MAX_MODULES];
+
+uint8_t moduleIndex(const char* moduleName) {
+  for (uint8_t i = 1; i < MAX_MODULES; i++) {
+    const char* registered = counters[i].module.load(std::memory_order_acquire);
+    if (!registered) {
+      // Free slot, claim it unless another task just did
+      if (counters[i].module.compare_exchange_strong(registered, moduleName, std::memory_order_acq_rel)) {
+        return i;
+      }
+    }
+    if (strcmp(registered, moduleName) == 0) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+void count(std::atomic<uint32_t>& operations, std::atomic<uint32_t>& busyUs, const unsigned long startUs) {
+  operations.fetch_add(1, std::memory_order_relaxed);
+  busyUs.fetch_add(micros() - startUs, std::memory_order_relaxed);
+}
+}  // namespace
+
+int HalFile::read() {
+  const unsigned long start = micros();
+  const int result = file.read();
+  ModuleCounters& stats = counters[module];
+  count(stats.reads, stats.busyUs, start);
+  if (result >= 0) {
+    stats.bytesRead.fetch_add(1, std::memory_order_relaxed);
+  }
+  return result;
+}
+
+int HalFile::read(void* buffer, const size_t size) {
+  const unsigned long start = micros();
+  const int result = file.read(buffer, size);
+  ModuleCounters& stats = counters[module];
+  count(stats.reads, stats.busyUs, start);
+  if (result > 0) {
+    stats.bytesRead.fetch_add(result, std::memory_order_relaxed);
+  }
+  return result;
+}
+
+size_t HalFile::write(const uint8_t b) { return write(&b, 1); }
+
+size_t HalFile::write(const uint8_t* buffer, const size_t size) {
+  const unsigned long start = micros();
+  const size_t written = file.write(buffer, size);
+  ModuleCounters& stats = counters[module];
+  count(stats.writes, stats.busyUs, start);
+  stats.bytesWritten.fetch_add(written, std::memory_order_relaxed);
+  return written;
+}
+
+bool HalFile::seekSet(const size_t position) {
+  const unsigned long start = micros();
+  const bool result = file.seekSet(position);
+  count(counters[module].seeks, counters[module].busyUs, start);
+  return result;
+}
+
+bool HalFile::seekCur(const int64_t offset) {
+  const unsigned long start = micros();
+  const bool result = file.seekCur(offset);
+  count(counters[module].seeks, counters[module].busyUs, start);
+  return result;
+}
+
+bool HalFile::seekEnd(const int64_t offset) {
+  const unsigned long start = micros();
+  const bool result = file.seekEnd(offset);
+  count(counters[module].seeks, counters[module].busyUs, start);
+  return result;
+}
+
 HalStorage::HalStorage() {}
 
 bool HalStorage::begin() { return SDCard.begin(); }
@@ -28,7 +124,12 @@ bool HalStorage::writeFile(const char* path, const String& content) { return SDC
 
 bool HalStorage::ensureDirectoryExists(const char* path) { return SDCard.ensureDirectoryExists(path); }
 
-FsFile HalStorage::open(const char* path, const oflag_t oflag) { return SDCard.open(path, oflag); }
+HalFile HalStorage::open(const char* path, const oflag_t oflag) {
+  const unsigned long start = micros();
+  HalFile file(SDCard.open(path, oflag), 0);
+  count(counters[0].opens, counters[0].busyUs, start);
+  return file;
+}
 
 bool HalStorage::mkdir(const char* path, const bool pFlag) { return SDCard.mkdir(path, pFlag); }
 
@@ -38,28 +139,86 @@ bool HalStorage::remove(const char* path) { return SDCard.remove(path); }
 
 bool HalStorage::rmdir(const char* path) { return SDCard.rmdir(path); }
 
-bool HalStorage::openFileForRead(const char* moduleName, const char* path, FsFile& file) {
-  return SDCard.openFileForRead(moduleName, path, file);
+bool HalStorage::openFileForRead(const char* moduleName, const char* path, HalFile& file) {
+  const unsigned long start = micros();
+  const uint8_t module = moduleIndex(moduleName);
+  const bool result = SDCard.openFileForRead(moduleName, path, file.file);
+  file.module = module;
+  count(counters[module].opens, counters[module].busyUs, start);
+  return result;
 }
 
-bool HalStorage::openFileForRead(const char* moduleName, const std::string& path, FsFile& file) {
+bool HalStorage::openFileForRead(const char* moduleName, const std::string& path, HalFile& file) {
   return openFileForRead(moduleName, path.c_str(), file);
 }
 
-bool HalStorage::openFileForRead(const char* moduleName, const String& path, FsFile& file) {
+bool HalStorage::openFileForRead(const char* moduleName, const String& path, HalFile& file) {
   return openFileForRead(moduleName, path.c_str(), file);
 }
 
-bool HalStorage::openFileForWrite(const char* moduleName, const char* path, FsFile& file) {
-  return SDCard.openFileForWrite(moduleName, path, file);
+bool HalStorage::openFileForWrite(const char* moduleName, const char* path, HalFile& file) {
+  const unsigned long start = micros();
+  const uint8_t module = moduleIndex(moduleName);
+  const bool result = SDCard.openFileForWrite(moduleName, path, file.file);
+  file.module = module;
+  count(counters[module].opens, counters[module].busyUs, start);
+  return result;
 }
 
-bool HalStorage::openFileForWrite(const char* moduleName, const std::string& path, FsFile& file) {
+bool HalStorage::openFileForWrite(const char* moduleName, const std::string& path, HalFile& file) {
   return openFileForWrite(moduleName, path.c_str(), file);
 }
 
-bool HalStorage::openFileForWrite(const char* moduleName, const String& path, FsFile& file) {
+bool HalStorage::openFileForWrite(const char* moduleName, const String& path, HalFile& file) {
   return openFileForWrite(moduleName, path.c_str(), file);
 }
 
-bool HalStorage::removeDir(const char* path) { return SDCard.removeDir(path); }
\ No newline at end of file
+bool HalStorage::removeDir(const char* path) { return SDCard.removeDir(path); }
+std::vector<HalStorage::ModuleStats> HalStorage::stats() const {
+  std::vector<ModuleStats> result;
+  for (uint8_t i = 0; i < MAX_MODULES; i++) {
+    const ModuleCounters& source = counters[i];
+    const char* module = i == 0 ? "other" : source.module.load(std::memory_order_acquire);
+    if (!module) {
+      break;
+    }
+    ModuleStats entry;
+    entry.module = module;
+    entry.opens = source.opens.load(std::memory_order_relaxed);
+    entry.reads = source.reads.load(std::memory_order_relaxed);
+    entry.writes = source.writes.load(std::memory_order_relaxed);
+    entry.seeks = source.seeks.load(std::memory_order_relaxed);
+    entry.bytesRead = source.bytesRead.load(std::memory_order_relaxed);
+    entry.bytesWritten = source.bytesWritten.load(std::memory_order_relaxed);
+    entry.busyUs = source.busyUs.load(std::memory_order_relaxed);
+    if (entry.opens || entry.reads || entry.writes || entry.seeks) {
+      result.push_back(entry);
+    }
+  }
+  return result;
+}
+
+void HalStorage::resetStats() {
+  // Module registrations stay, open handles keep their slot
+  for (auto& module : counters) {
+    module.opens.store(0, std::memory_order_relaxed);
+    module.reads.store(0, std::memory_order_relaxed);
+    module.writes.store(0, std::memory_order_relaxed);
+    module.seeks.store(0, std::memory_order_relaxed);
+    module.bytesRead.store(0, std::memory_order_relaxed);
+    module.bytesWritten.store(0, std::memory_order_relaxed);
+    module.busyUs.store(0, std::memory_order_relaxed);
+  }
+}
+
+void HalStorage::printStats(Print& out) const {
+  out.printf("SD: %-6s %6s %8s %8s %8s %10s %10s %8s\n", "module", "opens", "reads", "writes", "seeks", "read B",
+             "written B", "busy ms");
+  for (const auto& entry : stats()) {
+    out.printf("SD: %-6s %6lu %8lu %8lu %8lu %10lu %10lu %8lu\n", entry.module,
+               static_cast<unsigned long>(entry.opens), static_cast<unsigned long>(entry.reads),
+               static_cast<unsigned long>(entry.writes), static_cast<unsigned long>(entry.seeks),
+               static_cast<unsigned long>(entry.bytesRead), static_cast<unsigned long>(entry.bytesWritten),
+               static_cast<unsigned long>(entry.busyUs / 1000));
+  }
+}
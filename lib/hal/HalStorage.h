@@ -2,8 +2,51 @@
 
 #include <SDCardManager.h>
 
+#include <cstdint>
 #include <vector>
 
+// A file opened through HalStorage. Forwards to FsFile and counts every open, read, write and seek, with the time it
+// took, against the module tag it was opened with ("SCT", "ZIP", ...), see HalStorage::printStats().
+class HalFile : public Stream {
+  FsFile file;
+  uint8_t module = 0;
+
+  friend class HalStorage;
+  HalFile(const FsFile& file, const uint8_t module) : file(file), module(module) {}
+
+ public:
+  HalFile() = default;
+
+  bool isOpen() const { return file.isOpen(); }
+  operator bool() const { return isOpen(); }
+  void close() { file.close(); }
+
+  int read() override;
+  int read(void* buffer, size_t size);
+  int peek() override { return file.peek(); }
+  int available() override { return file.available(); }
+  using Print::write;
+  size_t write(uint8_t b) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  size_t write(const void* buffer, const size_t size) { return write(static_cast<const uint8_t*>(buffer), size); }
+  void flush() override { file.flush(); }
+
+  bool seek(const size_t position) { return seekSet(position); }
+  bool seekSet(size_t position);
+  bool seekCur(int64_t offset);
+  bool seekEnd(int64_t offset = 0);
+  size_t position() const { return file.curPosition(); }
+  size_t size() const { return file.fileSize(); }
+  size_t fileSize() const { return size(); }
+
+  bool isDirectory() const { return file.isDirectory(); }
+  // Entries inherit the module of their directory
+  HalFile openNextFile(const oflag_t oflag = O_RDONLY) { return HalFile(file.openNextFile(oflag), module); }
+  void rewindDirectory() { file.rewindDirectory(); }
+  size_t getName(char* name, const size_t size) { return file.getName(name, size); }
+  bool rename(const char* newPath) { return file.rename(newPath); }
+};
+
 class HalStorage {
  public:
   HalStorage();
@@ -24,20 +67,37 @@ class HalStorage {
   // Ensure a directory exists, creating it if necessary. Returns true on success.
   bool ensureDirectoryExists(const char* path);
 
-  FsFile open(const char* path, const oflag_t oflag = O_RDONLY);
+  // Not attributed to a module, counted as "other"
+  HalFile open(const char* path, const oflag_t oflag = O_RDONLY);
   bool mkdir(const char* path, const bool pFlag = true);
   bool exists(const char* path);
   bool remove(const char* path);
   bool rmdir(const char* path);
 
-  bool openFileForRead(const char* moduleName, const char* path, FsFile& file);
-  bool openFileForRead(const char* moduleName, const std::string& path, FsFile& file);
-  bool openFileForRead(const char* moduleName, const String& path, FsFile& file);
-  bool openFileForWrite(const char* moduleName, const char* path, FsFile& file);
-  bool openFileForWrite(const char* moduleName, const std::string& path, FsFile& file);
-  bool openFileForWrite(const char* moduleName, const String& path, FsFile& file);
+  bool openFileForRead(const char* moduleName, const char* path, HalFile& file);
+  bool openFileForRead(const char* moduleName, const std::string& path, HalFile& file);
+  bool openFileForRead(const char* moduleName, const String& path, HalFile& file);
+  bool openFileForWrite(const char* moduleName, const char* path, HalFile& file);
+  bool openFileForWrite(const char* moduleName, const std::string& path, HalFile& file);
+  bool openFileForWrite(const char* moduleName, const String& path, HalFile& file);
   bool removeDir(const char* path);
 
+  // I/O of the files opened through HalStorage, per module tag
+  struct ModuleStats {
+    const char* module;
+    uint32_t opens;
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t seeks;
+    uint32_t bytesRead;
+    uint32_t bytesWritten;
+    uint32_t busyUs;  // Time spent in opens, reads, writes and seeks
+  };
+  // Modules that did any I/O since boot or the last resetStats(), "other" first
+  std::vector<ModuleStats> stats() const;
+  void resetStats();
+  void printStats(Print& out) const;
+
   static HalStorage& getInstance() { return instance; }
 
  private:
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Compare two HostBench JSON reports and flag stages that got slower or hungrier.
+
+Exits with 1 if any stage regressed by more than the threshold, so it can gate a commit.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import sys
+
+METRICS = ('ms', 'allocations', 'peakHeapBytes', 'retainedHeapBytes', 'sdBytesRead', 'sdBytesWritten')
+
+
+def load(path: str) -> dict[tuple[str, str], dict]:
+    with open(path, encoding='utf-8') as f:
+        report = json.load(f)
+    stages = {}
+    for book in report['books']:
+        for stage, values in book['stages'].items():
+            stages[(book['path'], stage)] = values
+    return stages
+
+
+def change(before: float, after: float) -> float:
+    if before == 0:
+        return 0.0 if after == 0 else float('inf')
+    return (after - before) * 100.0 / before
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='Percent increase of a metric that counts as a regression (default 10)')
+    parser.add_argument('--min-ms', type=float, default=1.0,
+                        help='Ignore timing changes of stages faster than this in both reports (default 1ms)')
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    regressions = 0
+    print(f'{"book":<28} {"stage":<10} ' + ' '.join(f'{m:>22}' for m in METRICS))
+    for key in sorted(baseline.keys() & current.keys()):
+        before, after = baseline[key], current[key]
+        cells = []
+        for metric in METRICS:
+            if metric not in before or metric not in after:
+                # Reports of older HostBench versions lack some metrics
+                cells.append(f'{"-":>22}')
+                continue
+            delta = change(before[metric], after[metric])
+            noisy = metric == 'ms' and max(before[metric], after[metric]) < args.min_ms
+            flag = ' '
+            if delta > args.threshold and not noisy:
+                flag = '!'
+                regressions += 1
+            value = f'{after[metric]:.3f}' if metric == 'ms' else str(after[metric])
+            cells.append(f'{value:>12} {delta:>+7.1f}%{flag}')
+        print(f'{key[0][-28:]:<28} {key[1]:<10} ' + ' '.join(cells))
+    for key in sorted(baseline.keys() - current.keys()):
+        print(f'missing in current: {key[0]} {key[1]}')
+
+    if regressions:
+        print(f'{regressions} metric(s) regressed by more than {args.threshold:g}%')
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
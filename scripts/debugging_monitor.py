@@ -11,6 +11,7 @@ Features:
 - Interactive memory usage graphing with matplotlib
 - Command input interface for sending commands to the ESP32 device
 - Screenshot capture and processing (1-bit black/white format)
+- Trace capture (CMD:TRACE), saved as Chrome trace JSON
 - Graceful shutdown handling with Ctrl-C signal processing
 - Configurable filtering and suppression of log messages
 - Thread-safe operation with coordinated shutdown events
@@ -35,6 +36,8 @@ import threading
 from collections import deque
 from datetime import datetime
 
+from trace_to_chrome import write_chrome_trace
+
 # Try to import potentially missing packages
 PACKAGE_MAPPING: dict[str, str] = {
     "serial": "pyserial",
@@ -216,6 +219,7 @@ def serial_worker(ser, kwargs: dict[str, str]) -> None:
     expecting_screenshot = False
     screenshot_size = 0
     screenshot_data = b""
+    trace_lines: list[str] | None = None
 
     try:
         while not shutdown_event.is_set():
@@ -259,6 +263,22 @@ def serial_worker(ser, kwargs: dict[str, str]) -> None:
                     elif clean_line == "SCREENSHOT_END":
                         continue  # ignore
 
+                    if clean_line.startswith("TRACE_START:"):
+                        trace_lines = []
+                        continue
+                    if trace_lines is not None:
+                        if clean_line == "TRACE_END":
+                            trace_file = f"trace-{datetime.now().strftime('%Y%m%d-%H%M%S')}.json"
+                            count = write_chrome_trace(trace_lines, trace_file)
+                            print(
+                                f"{Fore.GREEN}Trace with {count} events saved to {trace_file}{Style.RESET_ALL}"
+                            )
+                            trace_lines = None
+                            continue
+                        if clean_line.startswith("TRACE:"):
+                            trace_lines.append(clean_line)
+                            continue
+
                     # Add PC timestamp
                     pc_time = datetime.now().strftime("%H:%M:%S")
                     formatted_line = re.sub(r"^\[\d+\]", f"[{pc_time}]", clean_line)
@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""Generate the fixed book corpus used by the host benchmark (host/HostBench.cpp).
+
+The books are synthetic but deterministic, so results stay comparable between commits. They cover the cases the
+reading pipeline cares about: a small EPUB 2 book, a long EPUB 3 book with nested inline markup, a stylesheet-heavy
+book, a book that is a single 2 MB block of text, a large TXT file and an XTC file of pre-rendered pages.
+"""
+
+from __future__ import annotations
+
+import argparse
+import pathlib
+import random
+import struct
+import zipfile
+
+WORDS = (
+    'the of and to in a is that for it as was with be by on not he this are or his from at which but have an they '
+    'you were her she there one all we their been has would when who will more no if out so said what up its about '
+    'into than them can only other new some could time these two may then do first any my now such like our over '
+    'man me even most made after also did many before must through back years where much your way well down should '
+    'because each just those people how too little state good very make world still own see men work long get here '
+    'between both life being under never day same another know while last might us great old year off come since '
+    'against go came right used take three extraordinary characteristically incomprehensible responsibility '
+    'notwithstanding interdisciplinary electroencephalography counterrevolutionary uncharacteristically '
+    'internationalization misunderstanding photosynthesis circumnavigation'
+).split()
+
+LANGUAGES = ('en', 'en', 'de', 'fr')
+
+
+def sentence(rng: random.Random) -> str:
+    words = [rng.choice(WORDS) for _ in range(rng.randint(6, 22))]
+    words[0] = words[0].capitalize()
+    return ' '.join(words) + rng.choice('....?!')
+
+
+def paragraph(rng: random.Random, inline_markup: bool) -> str:
+    parts = []
+    for _ in range(rng.randint(2, 7)):
+        text = sentence(rng)
+        if inline_markup and rng.random() < 0.3:
+            tag = rng.choice(('em', 'strong', 'span class="smallcaps"', 'i', 'b', 'span class="note"'))
+            words = text.split(' ')
+            at = rng.randrange(len(words))
+            words[at] = f'<{tag}>{words[at]}</{tag.split()[0]}>'
+            text = ' '.join(words)
+        parts.append(text)
+    return ' '.join(parts)
+
+
+def chapter_xhtml(rng: random.Random, index: int, paragraphs: int, inline_markup: bool, css_files: list[str]) -> str:
+    links = ''.join(f'<link rel="stylesheet" type="text/css" href="{css}"/>' for css in css_files)
+    body = [f'<h2 class="chapter">Chapter {index + 1}</h2>']
+    for p in range(paragraphs):
+        cls = ' class="first"' if p == 0 else (' class="indent"' if rng.random() < 0.5 else '')
+        body.append(f'<p{cls}>{paragraph(rng, inline_markup)}</p>')
+        if inline_markup and rng.random() < 0.05:
+            items = ''.join(f'<li>{sentence(rng)}</li>' for _ in range(rng.randint(2, 5)))
+            body.append(f'<ul class="list">{items}</ul>')
+        if inline_markup and rng.random() < 0.03:
+            style = 'font-style: italic; text-align: right'
+            body.append(f'<blockquote><p style="{style}">{sentence(rng)}</p></blockquote>')
+    return ('<?xml version="1.0" encoding="utf-8"?>\n'
+            '<html xmlns="http://www.w3.org/1999/xhtml" xmlns:epub="http://www.idpf.org/2007/ops">'
+            f'<head><title>Chapter {index + 1}</title>{links}</head><body><div class="text">'
+            + '\n'.join(body) + '</div></body></html>')
+
+
+def paragraphless_xhtml(rng: random.Random, index: int, size: int, css_files: list[str]) -> str:
+    # One run of text straight inside a div, the way TXT converters write books
+    links = ''.join(f'<link rel="stylesheet" type="text/css" href="{css}"/>' for css in css_files)
+    sentences = []
+    length = 0
+    while length < size:
+        sentences.append(sentence(rng))
+        length += len(sentences[-1]) + 1
+    return ('<?xml version="1.0" encoding="utf-8"?>\n'
+            '<html xmlns="http://www.w3.org/1999/xhtml">'
+            f'<head><title>Chapter {index + 1}</title>{links}</head><body><div class="text">'
+            + ' '.join(sentences) + '</div></body></html>')
+
+
+def stylesheet(rng: random.Random, rules: int) -> str:
+    base = [
+        'body { margin: 0; padding: 0; }',
+        'p { text-indent: 1.2em; margin: 0; text-align: justify; }',
+        'p.first { text-indent: 0; }',
+        'h2.chapter { font-weight: bold; text-align: center; margin-top: 2em; margin-bottom: 1em; }',
+        '.smallcaps { font-variant: small-caps; }',
+        '.note { font-size: 0.8em; font-style: italic; }',
+        'blockquote { margin-left: 2em; margin-right: 2em; }',
+        'ul.list li { margin-left: 1em; }',
+        'div.text > p.first { margin-top: 1em; }',
+        'blockquote p { text-indent: 0; }',
+    ]
+    properties = ('text-align: center', 'text-align: left', 'font-weight: bold', 'font-style: italic',
+                  'text-indent: 1em', 'margin-top: 0.5em', 'margin-bottom: 0.5em', 'padding-left: 1em',
+                  'text-decoration: underline', 'font-size: 0.9em', 'line-height: 1.4')
+    generated = []
+    for i in range(rules):
+        kind = rng.randrange(4)
+        if kind == 0:
+            selector = f'.c{i}'
+        elif kind == 1:
+            selector = f'p.c{i}'
+        elif kind == 2:
+            selector = f'div.text .c{i}, span.c{i}'
+        else:
+            selector = f'#id{i}'
+        declarations = '; '.join(rng.sample(properties, rng.randint(1, 4)))
+        generated.append(f'{selector} {{ {declarations}; }}')
+    return '\n'.join(base + generated) + '\n'
+
+
+def write_epub(path: pathlib.Path, seed: int, title: str, chapters: int, paragraphs: int, epub3: bool,
+               inline_markup: bool, css_rules: list[int], paragraphless_bytes: int = 0) -> None:
+    rng = random.Random(seed)
+    css_files = [f'css/style{i}.css' for i in range(len(css_rules))]
+    language = LANGUAGES[seed % len(LANGUAGES)]
+    manifest = []
+    spine = []
+    files = {}
+    for i, rules in enumerate(css_rules):
+        files[f'OEBPS/{css_files[i]}'] = stylesheet(rng, rules)
+        manifest.append(f'<item id="css{i}" href="{css_files[i]}" media-type="text/css"/>')
+    for i in range(chapters):
+        name = f'text/chapter{i + 1:03d}.xhtml'
+        chapter_css = [f'../{c}' for c in css_files]
+        if paragraphless_bytes:
+            files[f'OEBPS/{name}'] = paragraphless_xhtml(rng, i, paragraphless_bytes, chapter_css)
+        else:
+            files[f'OEBPS/{name}'] = chapter_xhtml(rng, i, paragraphs, inline_markup, chapter_css)
+        manifest.append(f'<item id="ch{i + 1}" href="{name}" media-type="application/xhtml+xml"/>')
+        spine.append(f'<itemref idref="ch{i + 1}"/>')
+
+    if epub3:
+        nav_items = ''.join(f'<li><a href="text/chapter{i + 1:03d}.xhtml">Chapter {i + 1}</a></li>'
+                            for i in range(chapters))
+        files['OEBPS/nav.xhtml'] = (
+            '<?xml version="1.0" encoding="utf-8"?>\n'
+            '<html xmlns="http://www.w3.org/1999/xhtml" xmlns:epub="http://www.idpf.org/2007/ops"><head>'
+            f'<title>{title}</title></head><body><nav epub:type="toc"><ol>{nav_items}</ol></nav></body></html>')
+        manifest.append('<item id="nav" href="nav.xhtml" media-type="application/xhtml+xml" properties="nav"/>')
+    nav_points = ''.join(
+        f'<navPoint id="np{i + 1}" playOrder="{i + 1}"><navLabel><text>Chapter {i + 1}</text></navLabel>'
+        f'<content src="text/chapter{i + 1:03d}.xhtml"/></navPoint>' for i in range(chapters))
+    files['OEBPS/toc.ncx'] = (
+        '<?xml version="1.0" encoding="utf-8"?>\n'
+        '<ncx xmlns="http://www.daisy.org/z3986/2005/ncx/" version="2005-1">'
+        f'<head><meta name="dtb:uid" content="bench-{seed}"/></head><docTitle><text>{title}</text></docTitle>'
+        f'<navMap>{nav_points}</navMap></ncx>')
+    manifest.append('<item id="ncx" href="toc.ncx" media-type="application/x-dtbncx+xml"/>')
+
+    version = '3.0' if epub3 else '2.0'
+    files['OEBPS/content.opf'] = (
+        '<?xml version="1.0" encoding="utf-8"?>\n'
+        f'<package xmlns="http://www.idpf.org/2007/opf" version="{version}" unique-identifier="uid">'
+        '<metadata xmlns:dc="http://purl.org/dc/elements/1.1/">'
+        f'<dc:identifier id="uid">bench-{seed}</dc:identifier><dc:title>{title}</dc:title>'
+        f'<dc:creator>CrossPoint Benchmarks</dc:creator><dc:language>{language}</dc:language></metadata>'
+        f'<manifest>{"".join(manifest)}</manifest><spine toc="ncx">{"".join(spine)}</spine></package>')
+    files['META-INF/container.xml'] = (
+        '<?xml version="1.0"?>\n'
+        '<container version="1.0" xmlns="urn:oasis:names:tc:opendocument:xmlns:container"><rootfiles>'
+        '<rootfile full-path="OEBPS/content.opf" media-type="application/oebps-package+xml"/>'
+        '</rootfiles></container>')
+
+    with zipfile.ZipFile(path, 'w') as epub:
+        # The mimetype entry has to come first and be stored
+        epub.writestr(zipfile.ZipInfo('mimetype', date_time=(2024, 1, 1, 0, 0, 0)), 'application/epub+zip',
+                      compress_type=zipfile.ZIP_STORED)
+        for name, content in files.items():
+            info = zipfile.ZipInfo(name, date_time=(2024, 1, 1, 0, 0, 0))
+            epub.writestr(info, content, compress_type=zipfile.ZIP_DEFLATED)
+
+
+def write_txt(path: pathlib.Path, seed: int, paragraphs: int) -> None:
+    rng = random.Random(seed)
+    with path.open('w', encoding='utf-8') as txt:
+        for _ in range(paragraphs):
+            txt.write(paragraph(rng, False) + '\n\n')
+
+
+def write_xtc(path: pathlib.Path, seed: int, pages: int) -> None:
+    # 1-bit XTC, see lib/Xtc/Xtc/XtcTypes.h. Pages are random "text lines" of black runs on white.
+    rng = random.Random(seed)
+    width, height = 480, 800
+    row_bytes = (width + 7) // 8
+    page_size = 22 + row_bytes * height
+    header_size = 56
+    table_offset = header_size
+    data_offset = table_offset + 16 * pages
+    header = struct.pack('<IBBHBBBBIQQQQII', 0x00435458, 1, 0, pages, 0, 0, 0, 0, 1, 0, table_offset, data_offset,
+                         0, 0, 0)
+    table = b''.join(struct.pack('<QIHH', data_offset + i * page_size, page_size, width, height) for i in range(pages))
+    with path.open('wb') as xtc:
+        xtc.write(header)
+        xtc.write(table)
+        for _ in range(pages):
+            bitmap = bytearray(b'\xff' * (row_bytes * height))
+            for line_top in range(40, height - 60, 32):
+                x = 20
+                while x < width - 40:
+                    word = rng.randint(10, 70)
+                    for y in range(line_top, line_top + 18):
+                        for px in range(x, min(x + word, width - 20)):
+                            bitmap[y * row_bytes + px // 8] &= ~(0x80 >> (px % 8))
+                    x += word + 8
+            xtc.write(struct.pack('<IHHBBIQ', 0x00475458, width, height, 0, 0, len(bitmap), 0))
+            xtc.write(bitmap)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument('output', help='Directory to write the corpus to, e.g. <sd root>/bench')
+    args = parser.parse_args()
+
+    out = pathlib.Path(args.output)
+    out.mkdir(parents=True, exist_ok=True)
+    write_epub(out / 'short.epub', 1, 'Short Book', chapters=5, paragraphs=60, epub3=False, inline_markup=False,
+               css_rules=[0])
+    write_epub(out / 'long.epub', 2, 'Long Book', chapters=40, paragraphs=120, epub3=True, inline_markup=True,
+               css_rules=[40, 20])
+    write_epub(out / 'styled.epub', 3, 'Styled Book', chapters=8, paragraphs=80, epub3=True, inline_markup=True,
+               css_rules=[1500])
+    write_epub(out / 'sheets.epub', 6, 'Many Stylesheets', chapters=12, paragraphs=20, epub3=True, inline_markup=True,
+               css_rules=[25] * 40)
+    write_epub(out / 'giant.epub', 7, 'Giant Paragraph', chapters=1, paragraphs=0, epub3=True, inline_markup=False,
+               css_rules=[0], paragraphless_bytes=2 * 1024 * 1024)
+    write_txt(out / 'plain.txt', 4, paragraphs=4000)
+    write_xtc(out / 'pages.xtc', 5, pages=40)
+    for path in sorted(out.iterdir()):
+        print(f'wrote {path} ({path.stat().st_size} bytes)')
+
+
+if __name__ == '__main__':
+    main()
@@ -1,14 +1,34 @@
 #!/usr/bin/env python3
-"""Embed hypher-generated `.bin` tries into constexpr headers."""
+"""Embed hypher-generated `.bin` tries into constexpr headers, or package them as trie files for the SD card.
+
+The output kind follows the destination name: `hyph-*.trie.h` is a header for the firmware, `hyph-*.trie` a file for
+the `/hyphenation` directory of the SD card (firmware built with HYPHENATION_TRIES_ON_SD, the `sd_tries` environment).
+An existing generated header is accepted as input too, so SD files can be made without the original `.bin`.
+
+`--dense-table` appends the direct-index table over the first two trie levels described in
+docs/hyphenation-trie-format.md, `--no-dense-table` removes it. Without either the input is kept as it is.
+"""
 
 from __future__ import annotations
 
 import argparse
 import pathlib
+import re
+import struct
 
+# Must match kHyphenationTrieFile* in lib/Epub/Epub/hyphenation/SerializedHyphenationTrie.h
+TRIE_FILE_MAGIC = b'HYPT'
+TRIE_FILE_VERSION = 1
+TRIE_FILE_HEADER_SIZE = 512
 
-def _format_bytes(blob: bytes, per_line: int = 16) -> str:
-    # Render the blob as a comma separated list of hex literals with consistent wrapping.
+# Dense table, must match LiangHyphenation.cpp
+DENSE_TABLE_FLAG = 0x80000000
+DENSE_NO_NODE = 0xFFFFFF
+DENSE_HAS_LEVELS = 0x800000
+
+
+def _format_bytes(blob: bytes, per_line: int = 19) -> str:
+    # Render the blob as a comma separated list of hex literals, wrapped the way clang-format wraps them.
     lines = []
     for i in range(0, len(blob), per_line):
         chunk = ', '.join(f"0x{b:02X}" for b in blob[i : i + per_line])
@@ -31,6 +51,77 @@ def _symbol_from_output(path: pathlib.Path) -> str:
     return name
 
 
+def _parse_node(blob: bytes, addr: int) -> tuple[bool, list[tuple[int, int]]]:
+    # Decode one trie node into (has levels, [(transition byte, absolute child address)]).
+    header = blob[addr]
+    pos = addr + 1
+    stride = (header >> 5) & 0x03 or 1
+    count = header & 0x1F
+    if count == 31:
+        count = blob[pos]
+        pos += 1
+    has_levels = bool(header >> 7)
+    if has_levels:
+        pos += 2
+    labels = blob[pos:pos + count]
+    pos += count
+    children = []
+    for i, label in enumerate(labels):
+        raw = blob[pos + i * stride:pos + (i + 1) * stride]
+        if stride == 3:
+            delta = int.from_bytes(raw, 'big') - (1 << 23)
+        else:
+            delta = int.from_bytes(raw, 'big', signed=True)
+        children.append((label, addr + delta))
+    return has_levels, children
+
+
+def add_dense_table(blob: bytes) -> bytes:
+    # Append the level 1/2 direct-index table and flag it in the root offset.
+    root = int.from_bytes(blob[:4], 'big')
+    if root & DENSE_TABLE_FLAG:
+        return blob
+    if len(blob) >= DENSE_HAS_LEVELS:
+        raise SystemExit('trie too large for a dense table')
+
+    level1 = dict(_parse_node(blob, root)[1])
+    level2 = {}
+    for first, addr in level1.items():
+        for second, child in _parse_node(blob, addr)[1]:
+            level2[(first, second)] = child
+    alphabet = sorted(set(level1) | {second for _, second in level2})
+    # The size is stored in one byte and index 0xFF marks bytes outside the alphabet
+    if len(alphabet) >= 0xFF:
+        raise SystemExit(f'alphabet of {len(alphabet)} bytes too large for a dense table (at most 254)')
+    index = {symbol: i for i, symbol in enumerate(alphabet)}
+
+    def entry(addr: int | None) -> bytes:
+        if addr is None:
+            return DENSE_NO_NODE.to_bytes(3, 'big')
+        flag = DENSE_HAS_LEVELS if _parse_node(blob, addr)[0] else 0
+        return (addr | flag).to_bytes(3, 'big')
+
+    table = bytearray([len(alphabet)])
+    table += bytes(index.get(b, 0xFF) for b in range(256))
+    for first in alphabet:
+        table += entry(level1.get(first))
+    for first in alphabet:
+        for second in alphabet:
+            table += entry(level2.get((first, second)))
+    table_offset = len(blob)
+    header = (root | DENSE_TABLE_FLAG).to_bytes(4, 'big')
+    return header + blob[4:] + bytes(table) + table_offset.to_bytes(4, 'big')
+
+
+def strip_dense_table(blob: bytes) -> bytes:
+    # Inverse of add_dense_table.
+    root = int.from_bytes(blob[:4], 'big')
+    if not root & DENSE_TABLE_FLAG:
+        return blob
+    table_offset = int.from_bytes(blob[-4:], 'big')
+    return (root & ~DENSE_TABLE_FLAG).to_bytes(4, 'big') + blob[4:table_offset]
+
+
 def write_header(path: pathlib.Path, blob: bytes, symbol: str) -> None:
     # Emit a constexpr header containing the raw bytes plus a SerializedHyphenationPatterns descriptor.
     path.parent.mkdir(parents=True, exist_ok=True)
@@ -57,12 +148,32 @@ constexpr SerializedHyphenationPatterns {patterns_symbol} = {{
     path.write_text(content)
 
 
+def write_trie_file(path: pathlib.Path, blob: bytes) -> None:
+    # Header (magic, version, blob size as little-endian uint32) padded to one SD sector, followed by the blob.
+    path.parent.mkdir(parents=True, exist_ok=True)
+    header = TRIE_FILE_MAGIC + struct.pack('<II', TRIE_FILE_VERSION, len(blob))
+    path.write_bytes(header.ljust(TRIE_FILE_HEADER_SIZE, b'\0') + blob)
+
+
+def read_blob(path: pathlib.Path) -> tuple[bytes, str | None]:
+    # Raw hypher `.bin`, or the byte array and symbol of a header previously written by write_header.
+    if not path.name.endswith('.h'):
+        return path.read_bytes(), None
+    text = path.read_text()
+    array = text.split('[] = {', 1)[1].split('};', 1)[0]
+    symbol = re.search(r'SerializedHyphenationPatterns (\w+)_patterns', text)
+    blob = bytes(int(value, 16) for value in re.findall(r'0x([0-9A-Fa-f]{2})', array))
+    return blob, symbol.group(1) if symbol else None
+
+
 def main() -> None:
     parser = argparse.ArgumentParser()
     parser.add_argument('--input', dest='inputs', action='append', required=True,
-                        help='Path to a hypher-generated .bin trie')
+                        help='Path to a hypher-generated .bin trie or a generated hyph-*.trie.h header')
     parser.add_argument('--output', dest='outputs', action='append', required=True,
-                        help='Destination header path (hyph-*.trie.h)')
+                        help='Destination header path (hyph-*.trie.h) or SD card trie file (hyph-*.trie)')
+    parser.add_argument('--dense-table', action=argparse.BooleanOptionalAction,
+                        help='Add (or remove) the direct-index table over the first two trie levels')
     args = parser.parse_args()
 
     if len(args.inputs) != len(args.outputs):
@@ -70,12 +181,18 @@ def main() -> None:
 
     for src, dst in zip(args.inputs, args.outputs):
         # Process each input/output pair independently so mixed-language refreshes work in one invocation.
-        src_path = pathlib.Path(src)
-        blob = src_path.read_bytes()
+        blob, symbol = read_blob(pathlib.Path(src))
+        if args.dense_table is not None:
+            blob = strip_dense_table(blob)
+        size = len(blob)
+        if args.dense_table:
+            blob = add_dense_table(blob)
         out_path = pathlib.Path(dst)
-        symbol = _symbol_from_output(out_path)
-        write_header(out_path, blob, symbol)
-        print(f'wrote {dst} ({len(blob)} bytes payload)')
+        if out_path.name.endswith('.trie'):
+            write_trie_file(out_path, blob)
+        else:
+            write_header(out_path, blob, symbol or _symbol_from_output(out_path))
+        print(f'wrote {dst} ({len(blob)} bytes payload, dense table {len(blob) - size} bytes)')
 
 
 if __name__ == '__main__':
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Convert a CMD:TRACE dump (see lib/Logging/Trace.h) to Chrome trace JSON.
+
+Open the result in chrome://tracing or https://ui.perfetto.dev. scripts/debugging_monitor.py does this automatically
+when it sees a dump; this script converts a saved one, e.g. from `HostReader --trace`.
+
+Usage:
+    python trace_to_chrome.py trace.txt [trace.json]
+"""
+
+from __future__ import annotations
+
+import json
+import sys
+
+
+def parse_event(line: str) -> dict | None:
+    """Parses 'TRACE:<us>,<phase>,<module>,<task>,<arg>,<name>', None for anything else."""
+    if not line.startswith("TRACE:"):
+        return None
+    fields = line[len("TRACE:"):].split(",", 5)
+    if len(fields) != 6:
+        return None
+    timestamp, phase, module, task, arg, name = fields
+    try:
+        return {
+            "ts": int(timestamp),
+            "ph": phase,
+            "cat": module,
+            "task": task,
+            "arg": int(arg),
+            "name": name,
+        }
+    except ValueError:
+        return None
+
+
+def trace_to_chrome(lines: list[str]) -> dict:
+    """Builds the Chrome trace object from the lines of a dump."""
+    events = []
+    tids: dict[str, int] = {}
+    open_scopes: dict[int, list[str]] = {}
+    wraps = 0
+    previous = None
+    for line in lines:
+        event = parse_event(line.strip())
+        if event is None:
+            continue
+        # Timestamps are 32 bit microseconds and wrap every ~71 minutes
+        if previous is not None and event["ts"] < previous - (1 << 31):
+            wraps += 1
+        previous = event["ts"]
+        timestamp = event["ts"] + (wraps << 32)
+
+        task = event["task"]
+        if task not in tids:
+            tids[task] = len(tids) + 1
+            events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": tids[task],
+                           "args": {"name": f"task {task}"}})
+        tid = tids[task]
+
+        # The ring buffer may have dropped the begin of the oldest scopes, skip their ends
+        scopes = open_scopes.setdefault(tid, [])
+        if event["ph"] == "B":
+            scopes.append(event["name"])
+        elif event["ph"] == "E":
+            if not scopes or scopes[-1] != event["name"]:
+                continue
+            scopes.pop()
+
+        chrome_event = {
+            "name": event["name"],
+            "cat": event["cat"],
+            "ph": event["ph"],
+            "ts": timestamp,
+            "pid": 1,
+            "tid": tid,
+            "args": {"arg": event["arg"]},
+        }
+        if event["ph"] == "i":
+            chrome_event["s"] = "t"
+        events.append(chrome_event)
+    return {"traceEvents": events, "displayTimeUnit": "ms"}
+
+
+def write_chrome_trace(lines: list[str], path: str) -> int:
+    """Converts and writes the trace, returns the number of events written."""
+    trace = trace_to_chrome(lines)
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump(trace, f)
+    return sum(1 for event in trace["traceEvents"] if event["ph"] != "M")
+
+
+def main() -> None:
+    if len(sys.argv) not in (2, 3):
+        print(__doc__)
+        sys.exit(2)
+    source = sys.argv[1]
+    target = sys.argv[2] if len(sys.argv) == 3 else source.rsplit(".", 1)[0] + ".json"
+    with open(source, encoding="utf-8", errors="replace") as f:
+        count = write_chrome_trace(f.readlines(), target)
+    print(f"Wrote {count} events to {target}")
+
+
+if __name__ == "__main__":
+    main()
@@ -11,7 +11,7 @@
 // Initialize the static instance
 CrossPointSettings CrossPointSettings::instance;
 
-void readAndValidate(FsFile& file, uint8_t& member, const uint8_t maxValue) {
+void readAndValidate(HalFile& file, uint8_t& member, const uint8_t maxValue) {
   uint8_t tempValue;
   serialization::readPod(file, tempValue);
   if (tempValue < maxValue) {
@@ -74,7 +74,7 @@ void applyLegacyFrontButtonLayout(CrossPointSettings& settings) {
 bool CrossPointSettings::saveToFile() const {
   Storage.mkdir("/.crosspoint");
 
-  FsFile outputFile;
+  HalFile outputFile;
   if (!Storage.openFileForWrite("CPS", SETTINGS_FILE, outputFile)) {
     return false;
   }
@@ -123,7 +123,7 @@ bool CrossPointSettings::saveToFile() const {
 }
 
 bool CrossPointSettings::loadFromFile() {
-  FsFile inputFile;
+  HalFile inputFile;
   if (!Storage.openFileForRead("CPS", SETTINGS_FILE, inputFile)) {
     return false;
   }
@@ -12,7 +12,7 @@ constexpr char STATE_FILE[] = "/.crosspoint/state.bin";
 CrossPointState CrossPointState::instance;
 
 bool CrossPointState::saveToFile() const {
-  FsFile outputFile;
+  HalFile outputFile;
   if (!Storage.openFileForWrite("CPS", STATE_FILE, outputFile)) {
     return false;
   }
@@ -27,7 +27,7 @@ bool CrossPointState::saveToFile() const {
 }
 
 bool CrossPointState::loadFromFile() {
-  FsFile inputFile;
+  HalFile inputFile;
   if (!Storage.openFileForRead("CPS", STATE_FILE, inputFile)) {
     return false;
   }
@@ -0,0 +1,154 @@
+#include "WorkerService.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <Trace.h>
+
+#include <algorithm>
+
+WorkerService WorkerService::instance;
+
+void WorkerService::begin() {
+  if (!lock) {
+    lock = xSemaphoreCreateMutex();
+  }
+  startLane(laneFor(Priority::Render));
+}
+
+bool WorkerService::startLane(Lane& lane) {
+  if (lane.taskHandle) {
+    return true;
+  }
+  if (xTaskCreate(&WorkerService::taskTrampoline, lane.name, lane.stackSize, &lane, 1, &lane.taskHandle) != pdPASS) {
+    LOG_ERR("WRK", "Could not create %s task", lane.name);
+    lane.taskHandle = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void WorkerService::taskTrampoline(void* param) { instance.laneLoop(*static_cast<Lane*>(param)); }
+
+bool WorkerService::submit(const Priority priority, const void* owner, const CancelToken& token, JobFn fn,
+                           const uint32_t delayMs) {
+  if (!lock) {
+    LOG_ERR("WRK", "Job submitted before begin()");
+    return false;
+  }
+
+  Lane& lane = laneFor(priority);
+  xSemaphoreTake(lock, portMAX_DELAY);
+  if (!startLane(lane) || lane.queued >= MAX_QUEUED_JOBS) {
+    xSemaphoreGive(lock);
+    LOG_ERR("WRK", "%s can't take more jobs, dropping one", lane.name);
+    return false;
+  }
+  Job& job = lane.jobs[lane.queued++];
+  job.owner = owner;
+  job.token = token;
+  job.fn = std::move(fn);
+  job.notBefore = millis() + delayMs;
+  lane.maxQueued = std::max(lane.maxQueued, lane.queued);
+  xSemaphoreGive(lock);
+
+  xTaskNotifyGive(lane.taskHandle);
+  return true;
+}
+
+void WorkerService::cancel(const void* owner) {
+  if (!lock) {
+    return;
+  }
+
+  const TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  for (Lane& lane : lanes) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    int kept = 0;
+    for (int i = 0; i < lane.queued; i++) {
+      if (lane.jobs[i].owner != owner) {
+        if (kept != i) {
+          lane.jobs[kept] = std::move(lane.jobs[i]);
+        }
+        kept++;
+      }
+    }
+    for (int i = kept; i < lane.queued; i++) {
+      lane.jobs[i].fn = nullptr;
+    }
+    lane.queued = kept;
+    if (lane.runningOwner == owner) {
+      lane.runningToken->cancel();
+    }
+    xSemaphoreGive(lock);
+
+    // A job cancelling its own owner can't wait for itself
+    if (lane.taskHandle == self) {
+      continue;
+    }
+    while (true) {
+      xSemaphoreTake(lock, portMAX_DELAY);
+      const bool running = lane.runningOwner == owner;
+      xSemaphoreGive(lock);
+      if (!running) {
+        break;
+      }
+      vTaskDelay(1);
+    }
+  }
+}
+
+void WorkerService::laneLoop(Lane& lane) {
+  // Reused for every job, moving jobs in and out of the queue doesn't allocate
+  Job job;
+  while (true) {
+    bool haveJob = false;
+    TickType_t wait = portMAX_DELAY;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    const unsigned long now = millis();
+    for (int i = 0; i < lane.queued; i++) {
+      const long remaining = static_cast<long>(lane.jobs[i].notBefore - now);
+      if (remaining <= 0) {
+        job = std::move(lane.jobs[i]);
+        for (int j = i + 1; j < lane.queued; j++) {
+          lane.jobs[j - 1] = std::move(lane.jobs[j]);
+        }
+        lane.jobs[--lane.queued].fn = nullptr;
+        lane.runningOwner = job.owner;
+        lane.runningToken = &job.token;
+        haveJob = true;
+        break;
+      }
+      wait = std::min(wait, static_cast<TickType_t>(pdMS_TO_TICKS(remaining)));
+    }
+    xSemaphoreGive(lock);
+
+    if (!haveJob) {
+      ulTaskNotifyTake(pdTRUE, wait);
+      continue;
+    }
+
+    if (!job.token.isCancelled()) {
+      TRACE_SCOPE(TraceModule::Worker, lane.name, lane.jobsRun);
+      job.fn(job.token);
+    }
+
+    job.fn = nullptr;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    lane.runningOwner = nullptr;
+    lane.runningToken = nullptr;
+    lane.jobsRun++;
+    xSemaphoreGive(lock);
+  }
+}
+
+void WorkerService::logStats() const {
+  for (const Lane& lane : lanes) {
+    if (!lane.taskHandle) {
+      continue;
+    }
+    LOG_INF("WRK", "%s: %lu jobs, max %d queued, stack high-water %lu of %lu bytes free", lane.name, lane.jobsRun,
+            lane.maxQueued, static_cast<uint32_t>(uxTaskGetStackHighWaterMark(lane.taskHandle)), lane.stackSize);
+  }
+}
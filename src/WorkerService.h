@@ -0,0 +1,92 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+// Tells a job it is no longer wanted. Copies share the same flag, so the submitter keeps one and cancels all jobs
+// handed out with it. Long jobs should check it between steps.
+class CancelToken {
+  std::shared_ptr<std::atomic<bool>> cancelled = std::make_shared<std::atomic<bool>>(false);
+
+ public:
+  void cancel() const {
+    if (cancelled) {
+      *cancelled = true;
+    }
+  }
+  bool isCancelled() const { return cancelled && *cancelled; }
+};
+
+// Long-lived tasks running jobs for activities, instead of every activity creating and deleting its own task.
+// Render jobs and background jobs (network syncs, indexing, thumbnails) run on separate tasks, so a render never
+// waits behind background work. Within a priority, jobs run in submission order.
+class WorkerService {
+ public:
+  enum class Priority : uint8_t { Render, Background };
+  using JobFn = std::function<void(const CancelToken& token)>;
+
+  static constexpr int MAX_QUEUED_JOBS = 8;
+  // The EPUB reader needs the largest stack to lay out and render a page
+  static constexpr uint32_t RENDER_STACK_SIZE = 8192;
+  // Cover thumbnails load the EPUB and decode its JPEG cover, they ran on the home screen's 8KB display task before
+  static constexpr uint32_t BACKGROUND_STACK_SIZE = 8192;
+
+ private:
+  struct Job {
+    const void* owner = nullptr;
+    CancelToken token;
+    JobFn fn;
+    unsigned long notBefore = 0;
+  };
+
+  struct Lane {
+    const char* name;
+    uint32_t stackSize;
+    TaskHandle_t taskHandle = nullptr;
+    Job jobs[MAX_QUEUED_JOBS];
+    int queued = 0;
+    const void* runningOwner = nullptr;
+    const CancelToken* runningToken = nullptr;
+
+    // Instrumentation
+    uint32_t jobsRun = 0;
+    int maxQueued = 0;
+
+    Lane(const char* name, const uint32_t stackSize) : name(name), stackSize(stackSize) {}
+  };
+
+  // Static instance
+  static WorkerService instance;
+
+  SemaphoreHandle_t lock = nullptr;
+  Lane lanes[2] = {{"RenderWorker", RENDER_STACK_SIZE}, {"BackgroundWorker", BACKGROUND_STACK_SIZE}};
+
+  Lane& laneFor(const Priority priority) { return lanes[static_cast<int>(priority)]; }
+  bool startLane(Lane& lane);
+  static void taskTrampoline(void* param);
+  [[noreturn]] void laneLoop(Lane& lane);
+
+ public:
+  // Get singleton instance
+  static WorkerService& getInstance() { return instance; }
+
+  // Creates the render task. The background task is created by the first background job, most sessions never need
+  // it. Both live until the device sleeps.
+  void begin();
+
+  // Queues fn to run after delayMs. owner identifies the jobs for cancel(). Returns false if the queue is full.
+  bool submit(Priority priority, const void* owner, const CancelToken& token, JobFn fn, uint32_t delayMs = 0);
+  // Drops the queued jobs of owner and waits for its running job to return. Must not be called with a lock that
+  // the running job waits for, unless the job gives up on cancellation.
+  void cancel(const void* owner);
+
+  // Logs jobs run, queue depth and stack high-water mark of each task
+  void logStats() const;
+};
+
+// Helper macro to access the worker service
+#define WORKER WorkerService::getInstance()
@@ -0,0 +1,100 @@
+#include "DisplayTask.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <Trace.h>
+
+void DisplayTask::start(const char* taskName, SemaphoreHandle_t mutex, RenderFn renderFn, CanRenderFn canRenderFn) {
+  name = taskName;
+  renderingMutex = mutex;
+  render = std::move(renderFn);
+  canRender = std::move(canRenderFn);
+  token = CancelToken();
+  startedAt = millis();
+  wakeups = 0;
+  renders = 0;
+  requests = 0;
+  active = true;
+
+  // Requests made before start(), usually the first render from onEnter()
+  if (pending) {
+    schedule();
+  }
+}
+
+void DisplayTask::stop() {
+  if (!active) {
+    return;
+  }
+  active = false;
+  token.cancel();
+  WORKER.cancel(this);
+  queued = false;
+
+  const unsigned long elapsed = millis() - startedAt;
+  [[maybe_unused]] const unsigned long perMinute = elapsed > 0 ? static_cast<uint64_t>(wakeups) * 60000 / elapsed : 0;
+  LOG_DBG("ACT", "%s: %lu wakeups, %lu renders for %lu requests in %lums (%lu wakeups/min)", name, wakeups, renders,
+          requests.load(), elapsed, perMinute);
+}
+
+void DisplayTask::requestUpdate() {
+  if (!pending.exchange(true)) {
+    firstRequestAt = millis();
+  }
+  requests++;
+  if (active) {
+    schedule();
+  }
+}
+
+void DisplayTask::schedule(const uint32_t delayMs) {
+  // One queued job serves every request made before it runs
+  if (queued.exchange(true)) {
+    return;
+  }
+  const auto job = [this](const CancelToken& jobToken) { runJob(jobToken); };
+  if (!WORKER.submit(WorkerService::Priority::Render, this, token, job, delayMs)) {
+    queued = false;
+  }
+}
+
+void DisplayTask::runJob(const CancelToken& jobToken) {
+  queued = false;
+  wakeups++;
+
+  if (!pending) {
+    return;
+  }
+  if (canRender && !canRender()) {
+    // The state it waits for (e.g. a subactivity exiting) doesn't always come with a request
+    schedule(BLOCKED_RECHECK_MS);
+    return;
+  }
+
+  // Waiting for the mutex here would hold up the render lane for every other activity, try again shortly instead.
+  // stop() cancels this job while holding the mutex, then it isn't tried again.
+  if (xSemaphoreTake(renderingMutex, 0) != pdTRUE) {
+    if (!jobToken.isCancelled()) {
+      schedule(MUTEX_RETRY_MS);
+    }
+    return;
+  }
+  if (jobToken.isCancelled()) {
+    xSemaphoreGive(renderingMutex);
+    return;
+  }
+
+  rendering = true;
+  pending = false;
+  const unsigned long renderStart = millis();
+  [[maybe_unused]] const unsigned long latency = renderStart - firstRequestAt;
+  {
+    TRACE_SCOPE(TraceModule::Display, name, renders);
+    render();
+  }
+  rendering = false;
+  xSemaphoreGive(renderingMutex);
+
+  renders++;
+  LOG_DBG("ACT", "%s: render started %lums after request, took %lums", name, latency, millis() - renderStart);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <atomic>
+#include <functional>
+
+#include "WorkerService.h"
+
+// Renders an activity on the shared render worker whenever an update is requested.
+// Nothing runs between requests, and requests made before a render starts are coalesced into that render.
+class DisplayTask final {
+  using RenderFn = std::function<void()>;
+  using CanRenderFn = std::function<bool()>;
+
+  static constexpr uint32_t BLOCKED_RECHECK_MS = 50;
+  // How soon a render that found the activity's mutex taken tries again
+  static constexpr uint32_t MUTEX_RETRY_MS = 5;
+
+  const char* name = nullptr;
+  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderFn render;
+  CanRenderFn canRender;
+  CancelToken token;
+  bool active = false;
+
+  std::atomic<bool> pending{false};
+  std::atomic<bool> queued{false};
+  std::atomic<bool> rendering{false};
+
+  // Instrumentation
+  unsigned long startedAt = 0;
+  unsigned long firstRequestAt = 0;
+  uint32_t wakeups = 0;
+  uint32_t renders = 0;
+  std::atomic<uint32_t> requests{0};
+
+  void schedule(uint32_t delayMs = 0);
+  void runJob(const CancelToken& jobToken);
+
+ public:
+  DisplayTask() = default;
+  DisplayTask(const DisplayTask&) = delete;
+  DisplayTask& operator=(const DisplayTask&) = delete;
+
+  // Starts serving requests. render is called on the render worker with renderingMutex held. Requests stay pending
+  // while canRender returns false, e.g. while a subactivity owns the screen, and are rechecked periodically.
+  void start(const char* taskName, SemaphoreHandle_t mutex, RenderFn renderFn, CanRenderFn canRenderFn = nullptr);
+  // Cancels queued renders and waits for a running one. Call with renderingMutex held so a render is never cut off,
+  // a render that finds the mutex taken gives up.
+  void stop();
+
+  // Schedules a render, can be called from any task and before start()
+  void requestUpdate();
+  // True from a request until the render serving it has finished
+  bool isUpdatePending() const { return pending || rendering; }
+};
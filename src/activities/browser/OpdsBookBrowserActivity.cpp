@@ -19,11 +19,6 @@ namespace {
 constexpr int PAGE_ITEMS = 23;
 }  // namespace
 
-void OpdsBookBrowserActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<OpdsBookBrowserActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void OpdsBookBrowserActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -35,14 +30,9 @@ void OpdsBookBrowserActivity::onEnter() {
   selectorIndex = 0;
   errorMessage.clear();
   statusMessage = "Checking WiFi...";
-  updateRequired = true;
+  displayTask.requestUpdate();
 
-  xTaskCreate(&OpdsBookBrowserActivity::taskTrampoline, "OpdsBookBrowserTask",
-              4096,               // Stack size (larger for HTTP operations)
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.start("OpdsBookBrowserTask", renderingMutex, [this] { render(); });
 
   // Check WiFi and connect if needed, then fetch feed
   checkAndConnectWifi();
@@ -55,10 +45,7 @@ void OpdsBookBrowserActivity::onExit() {
   WiFi.mode(WIFI_OFF);
 
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
   entries.clear();
@@ -81,7 +68,7 @@ void OpdsBookBrowserActivity::loop() {
         LOG_DBG("OPDS", "Retry: WiFi connected, retrying fetch");
         state = BrowserState::LOADING;
         statusMessage = "Loading...";
-        updateRequired = true;
+        displayTask.requestUpdate();
         fetchFeed(currentPath);
       } else {
         // WiFi not connected - launch WiFi selection
@@ -134,39 +121,27 @@ void OpdsBookBrowserActivity::loop() {
     if (!entries.empty()) {
       buttonNavigator.onNextRelease([this] {
         selectorIndex = ButtonNavigator::nextIndex(selectorIndex, entries.size());
-        updateRequired = true;
+        displayTask.requestUpdate();
       });
 
       buttonNavigator.onPreviousRelease([this] {
         selectorIndex = ButtonNavigator::previousIndex(selectorIndex, entries.size());
-        updateRequired = true;
+        displayTask.requestUpdate();
       });
 
       buttonNavigator.onNextContinuous([this] {
         selectorIndex = ButtonNavigator::nextPageIndex(selectorIndex, entries.size(), PAGE_ITEMS);
-        updateRequired = true;
+        displayTask.requestUpdate();
       });
 
       buttonNavigator.onPreviousContinuous([this] {
         selectorIndex = ButtonNavigator::previousPageIndex(selectorIndex, entries.size(), PAGE_ITEMS);
-        updateRequired = true;
+        displayTask.requestUpdate();
       });
     }
   }
 }
 
-void OpdsBookBrowserActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void OpdsBookBrowserActivity::render() const {
   renderer.clearScreen();
 
@@ -260,7 +235,7 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   if (strlen(serverUrl) == 0) {
     state = BrowserState::ERROR;
     errorMessage = "No server URL configured";
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -274,7 +249,7 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
     if (!HttpDownloader::fetchUrl(url, stream)) {
       state = BrowserState::ERROR;
       errorMessage = "Failed to fetch feed";
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     }
   }
@@ -282,7 +257,7 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   if (!parser) {
     state = BrowserState::ERROR;
     errorMessage = "Failed to parse feed";
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -293,12 +268,12 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   if (entries.empty()) {
     state = BrowserState::ERROR;
     errorMessage = "No entries found";
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
   state = BrowserState::BROWSING;
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
@@ -310,7 +285,7 @@ void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
   statusMessage = "Loading...";
   entries.clear();
   selectorIndex = 0;
-  updateRequired = true;
+  displayTask.requestUpdate();
 
   fetchFeed(currentPath);
 }
@@ -328,7 +303,7 @@ void OpdsBookBrowserActivity::navigateBack() {
     statusMessage = "Loading...";
     entries.clear();
     selectorIndex = 0;
-    updateRequired = true;
+    displayTask.requestUpdate();
 
     fetchFeed(currentPath);
   }
@@ -339,7 +314,7 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
   statusMessage = book.title;
   downloadProgress = 0;
   downloadTotal = 0;
-  updateRequired = true;
+  displayTask.requestUpdate();
 
   // Build full download URL
   std::string downloadUrl = UrlUtils::buildUrl(SETTINGS.opdsServerUrl, book.href);
@@ -357,7 +332,7 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
       HttpDownloader::downloadToFile(downloadUrl, filename, [this](const size_t downloaded, const size_t total) {
         downloadProgress = downloaded;
         downloadTotal = total;
-        updateRequired = true;
+        displayTask.requestUpdate();
       });
 
   if (result == HttpDownloader::OK) {
@@ -369,11 +344,11 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
     LOG_DBG("OPDS", "Cleared cache for: %s", filename.c_str());
 
     state = BrowserState::BROWSING;
-    updateRequired = true;
+    displayTask.requestUpdate();
   } else {
     state = BrowserState::ERROR;
     errorMessage = "Download failed";
-    updateRequired = true;
+    displayTask.requestUpdate();
   }
 }
 
@@ -382,7 +357,7 @@ void OpdsBookBrowserActivity::checkAndConnectWifi() {
   if (WiFi.status() == WL_CONNECTED && WiFi.localIP() != IPAddress(0, 0, 0, 0)) {
     state = BrowserState::LOADING;
     statusMessage = "Loading...";
-    updateRequired = true;
+    displayTask.requestUpdate();
     fetchFeed(currentPath);
     return;
   }
@@ -393,7 +368,7 @@ void OpdsBookBrowserActivity::checkAndConnectWifi() {
 
 void OpdsBookBrowserActivity::launchWifiSelection() {
   state = BrowserState::WIFI_SELECTION;
-  updateRequired = true;
+  displayTask.requestUpdate();
 
   enterNewActivity(new WifiSelectionActivity(renderer, mappedInput,
                                              [this](const bool connected) { onWifiSelectionComplete(connected); }));
@@ -406,7 +381,7 @@ void OpdsBookBrowserActivity::onWifiSelectionComplete(const bool connected) {
     LOG_DBG("OPDS", "WiFi connected via selection, fetching feed");
     state = BrowserState::LOADING;
     statusMessage = "Loading...";
-    updateRequired = true;
+    displayTask.requestUpdate();
     fetchFeed(currentPath);
   } else {
     LOG_DBG("OPDS", "WiFi selection cancelled/failed");
@@ -416,6 +391,6 @@ void OpdsBookBrowserActivity::onWifiSelectionComplete(const bool connected) {
     WiFi.mode(WIFI_OFF);
     state = BrowserState::ERROR;
     errorMessage = "WiFi connection failed";
-    updateRequired = true;
+    displayTask.requestUpdate();
   }
 }
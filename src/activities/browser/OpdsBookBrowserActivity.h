@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "../ActivityWithSubactivity.h"
+#include "../DisplayTask.h"
 #include "util/ButtonNavigator.h"
 
 /**
@@ -36,10 +37,9 @@ class OpdsBookBrowserActivity final : public ActivityWithSubactivity {
   void loop() override;
 
  private:
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
-  bool updateRequired = false;
 
   BrowserState state = BrowserState::LOADING;
   std::vector<OpdsEntry> entries;
@@ -52,9 +52,6 @@ class OpdsBookBrowserActivity final : public ActivityWithSubactivity {
   size_t downloadTotal = 0;
 
   const std::function<void()> onGoHome;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
 
   void checkAndConnectWifi();
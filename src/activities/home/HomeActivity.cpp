@@ -4,6 +4,7 @@
 #include <Epub.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
+#include <Logging.h>
 #include <Utf8.h>
 #include <Xtc.h>
 
@@ -15,15 +16,11 @@
 #include "CrossPointState.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
+#include "WorkerService.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 #include "util/StringUtils.h"
 
-void HomeActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<HomeActivity*>(param);
-  self->displayTaskLoop();
-}
-
 int HomeActivity::getMenuItemCount() const {
   int count = 4;  // My Library, Recents, File transfer, Settings
   if (!recentBooks.empty()) {
@@ -55,13 +52,27 @@ void HomeActivity::loadRecentBooks(int maxBooks) {
   }
 }
 
-void HomeActivity::loadRecentCovers(int coverHeight) {
+void HomeActivity::startRecentCovers(const int coverHeight) {
   recentsLoading = true;
+  coverToken = CancelToken();
+  const auto job = [this, coverHeight](const CancelToken& token) { loadRecentCovers(coverHeight, token); };
+  if (!WORKER.submit(WorkerService::Priority::Background, this, coverToken, job)) {
+    LOG_ERR("HOME", "Failed to queue cover thumbnails");
+    recentsLoading = false;
+    recentsLoaded = true;
+  }
+}
+
+void HomeActivity::loadRecentCovers(const int coverHeight, const CancelToken& token) {
   bool showingLoading = false;
+  bool coversChanged = false;
   Rect popupRect;
 
-  int progress = 0;
-  for (RecentBook& book : recentBooks) {
+  // The mutex guards the SD card and the renderer, it is held for one book at a time so the home screen can render
+  // in between. onExit() cancels this job before taking the mutex, so waiting for it can't deadlock.
+  for (size_t progress = 0; progress < recentBooks.size() && !token.isCancelled(); progress++) {
+    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    RecentBook& book = recentBooks[progress];
     if (!book.coverBmpPath.empty()) {
       std::string coverPath = UITheme::getCoverThumbPath(book.coverBmpPath, coverHeight);
       if (!Storage.exists(coverPath.c_str())) {
@@ -83,7 +94,7 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
             book.coverBmpPath = "";
           }
           coverRendered = false;
-          updateRequired = true;
+          coversChanged = true;
         } else if (StringUtils::checkFileExtension(book.path, ".xtch") ||
                    StringUtils::checkFileExtension(book.path, ".xtc")) {
           // Handle XTC file
@@ -101,16 +112,21 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
               book.coverBmpPath = "";
             }
             coverRendered = false;
-            updateRequired = true;
+            coversChanged = true;
           }
         }
       }
     }
-    progress++;
+    xSemaphoreGive(renderingMutex);
   }
 
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
   recentsLoaded = true;
   recentsLoading = false;
+  xSemaphoreGive(renderingMutex);
+  if (coversChanged) {
+    displayTask.requestUpdate();
+  }
 }
 
 void HomeActivity::onEnter() {
@@ -127,25 +143,21 @@ void HomeActivity::onEnter() {
   loadRecentBooks(metrics.homeRecentBooksCount);
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&HomeActivity::taskTrampoline, "HomeActivityTask",
-              8192,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.requestUpdate();
+
+  displayTask.start("HomeActivityTask", renderingMutex, [this] { render(); });
 }
 
 void HomeActivity::onExit() {
   Activity::onExit();
 
+  // Thumbnail generation waits for renderingMutex between books, stop it before taking the mutex
+  coverToken.cancel();
+  WORKER.cancel(this);
+
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 
@@ -154,7 +166,7 @@ void HomeActivity::onExit() {
 }
 
 bool HomeActivity::storeCoverBuffer() {
-  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  const uint8_t* frameBuffer = renderer.peekFrameBuffer();
   if (!frameBuffer) {
     return false;
   }
@@ -200,12 +212,12 @@ void HomeActivity::loop() {
 
   buttonNavigator.onNext([this, menuCount] {
     selectorIndex = ButtonNavigator::nextIndex(selectorIndex, menuCount);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPrevious([this, menuCount] {
     selectorIndex = ButtonNavigator::previousIndex(selectorIndex, menuCount);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
@@ -234,18 +246,6 @@ void HomeActivity::loop() {
   }
 }
 
-void HomeActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void HomeActivity::render() {
   auto metrics = UITheme::getInstance().getMetrics();
   const auto pageWidth = renderer.getScreenWidth();
@@ -278,13 +278,13 @@ void HomeActivity::render() {
   const auto labels = mappedInput.mapLabels("", "Select", "Up", "Down");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 
   if (!firstRenderDone) {
     firstRenderDone = true;
-    updateRequired = true;
+    displayTask.requestUpdate();
   } else if (!recentsLoaded && !recentsLoading) {
-    recentsLoading = true;
-    loadRecentCovers(metrics.homeCoverHeight);
+    // Thumbnails take seconds per book, they are generated in the background and shown by a later render
+    startRecentCovers(metrics.homeCoverHeight);
   }
 }
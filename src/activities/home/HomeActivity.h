@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "../Activity.h"
+#include "../DisplayTask.h"
 #include "./MyLibraryActivity.h"
 #include "util/ButtonNavigator.h"
 
@@ -14,13 +15,13 @@ struct RecentBook;
 struct Rect;
 
 class HomeActivity final : public Activity {
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
   int selectorIndex = 0;
-  bool updateRequired = false;
   bool recentsLoading = false;
   bool recentsLoaded = false;
+  CancelToken coverToken;
   bool firstRenderDone = false;
   bool hasOpdsUrl = false;
   bool coverRendered = false;      // Track if cover has been rendered once
@@ -33,16 +34,14 @@ class HomeActivity final : public Activity {
   const std::function<void()> onSettingsOpen;
   const std::function<void()> onFileTransferOpen;
   const std::function<void()> onOpdsBrowserOpen;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
   int getMenuItemCount() const;
   bool storeCoverBuffer();    // Store frame buffer for cover image
   bool restoreCoverBuffer();  // Restore frame buffer from stored cover
   void freeCoverBuffer();     // Free the stored cover buffer
   void loadRecentBooks(int maxBooks);
-  void loadRecentCovers(int coverHeight);
+  void startRecentCovers(int coverHeight);
+  void loadRecentCovers(int coverHeight, const CancelToken& token);
 
  public:
   explicit HomeActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
@@ -66,11 +66,6 @@ void sortFileList(std::vector<std::string>& strs) {
   });
 }
 
-void MyLibraryActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<MyLibraryActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void MyLibraryActivity::loadFiles() {
   files.clear();
 
@@ -114,14 +109,9 @@ void MyLibraryActivity::onEnter() {
   loadFiles();
 
   selectorIndex = 0;
-  updateRequired = true;
-
-  xTaskCreate(&MyLibraryActivity::taskTrampoline, "MyLibraryActivityTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.requestUpdate();
+
+  displayTask.start("MyLibraryActivityTask", renderingMutex, [this] { render(); });
 }
 
 void MyLibraryActivity::onExit() {
@@ -129,10 +119,7 @@ void MyLibraryActivity::onExit() {
 
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 
@@ -146,7 +133,7 @@ void MyLibraryActivity::loop() {
     basepath = "/";
     loadFiles();
     selectorIndex = 0;
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -162,7 +149,7 @@ void MyLibraryActivity::loop() {
       basepath += files[selectorIndex].substr(0, files[selectorIndex].length() - 1);
       loadFiles();
       selectorIndex = 0;
-      updateRequired = true;
+      displayTask.requestUpdate();
     } else {
       onSelectBook(basepath + files[selectorIndex]);
       return;
@@ -183,7 +170,7 @@ void MyLibraryActivity::loop() {
         const std::string dirName = oldPath.substr(pos + 1) + "/";
         selectorIndex = findEntry(dirName);
 
-        updateRequired = true;
+        displayTask.requestUpdate();
       } else {
         onGoHome();
       }
@@ -194,37 +181,25 @@ void MyLibraryActivity::loop() {
 
   buttonNavigator.onNextRelease([this, listSize] {
     selectorIndex = ButtonNavigator::nextIndex(static_cast<int>(selectorIndex), listSize);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPreviousRelease([this, listSize] {
     selectorIndex = ButtonNavigator::previousIndex(static_cast<int>(selectorIndex), listSize);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onNextContinuous([this, listSize, pageItems] {
     selectorIndex = ButtonNavigator::nextPageIndex(static_cast<int>(selectorIndex), listSize, pageItems);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPreviousContinuous([this, listSize, pageItems] {
     selectorIndex = ButtonNavigator::previousPageIndex(static_cast<int>(selectorIndex), listSize, pageItems);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 }
 
-void MyLibraryActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void MyLibraryActivity::render() const {
   renderer.clearScreen();
 
@@ -249,7 +224,7 @@ void MyLibraryActivity::render() const {
   const auto labels = mappedInput.mapLabels(basepath == "/" ? "« Home" : "« Back", "Open", "Up", "Down");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
 
 size_t MyLibraryActivity::findEntry(const std::string& name) const {
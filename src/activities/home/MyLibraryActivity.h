@@ -8,17 +8,17 @@
 #include <vector>
 
 #include "../Activity.h"
+#include "../DisplayTask.h"
 #include "RecentBooksStore.h"
 #include "util/ButtonNavigator.h"
 
 class MyLibraryActivity final : public Activity {
  private:
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
 
   size_t selectorIndex = 0;
-  bool updateRequired = false;
 
   // Files state
   std::string basepath = "/";
@@ -27,9 +27,6 @@ class MyLibraryActivity final : public Activity {
   // Callbacks
   const std::function<void(const std::string& path)> onSelectBook;
   const std::function<void()> onGoHome;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
 
   // Data loading
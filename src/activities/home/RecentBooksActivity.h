@@ -8,17 +8,17 @@
 #include <vector>
 
 #include "../Activity.h"
+#include "../DisplayTask.h"
 #include "RecentBooksStore.h"
 #include "util/ButtonNavigator.h"
 
 class RecentBooksActivity final : public Activity {
  private:
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
 
   size_t selectorIndex = 0;
-  bool updateRequired = false;
 
   // Recent tab state
   std::vector<RecentBook> recentBooks;
@@ -26,9 +26,6 @@ class RecentBooksActivity final : public Activity {
   // Callbacks
   const std::function<void(const std::string& path)> onSelectBook;
   const std::function<void()> onGoHome;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
 
   // Data loading
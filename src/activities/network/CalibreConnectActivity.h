@@ -8,6 +8,7 @@
 #include <string>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 #include "network/CrossPointWebServer.h"
 
 enum class CalibreConnectState { WIFI_SELECTION, SERVER_STARTING, SERVER_RUNNING, ERROR };
@@ -17,9 +18,8 @@ enum class CalibreConnectState { WIFI_SELECTION, SERVER_STARTING, SERVER_RUNNING
  * but renders Calibre-specific instructions instead of the web transfer UI.
  */
 class CalibreConnectActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  DisplayTask displayTask;
   CalibreConnectState state = CalibreConnectState::WIFI_SELECTION;
   const std::function<void()> onComplete;
 
@@ -33,9 +33,6 @@ class CalibreConnectActivity final : public ActivityWithSubactivity {
   std::string lastCompleteName;
   unsigned long lastCompleteAt = 0;
   bool exitRequested = false;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   void renderServerRunning() const;
 
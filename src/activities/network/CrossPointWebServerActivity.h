@@ -9,6 +9,7 @@
 
 #include "NetworkModeSelectionActivity.h"
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 #include "network/CrossPointWebServer.h"
 
 // Web server activity states
@@ -31,9 +32,8 @@ enum class WebServerActivityState {
  * - Cleans up the server and shuts down WiFi on exit
  */
 class CrossPointWebServerActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  DisplayTask displayTask;
   WebServerActivityState state = WebServerActivityState::MODE_SELECTION;
   const std::function<void()> onGoBack;
 
@@ -50,9 +50,6 @@ class CrossPointWebServerActivity final : public ActivityWithSubactivity {
 
   // Performance monitoring
   unsigned long lastHandleClientTime = 0;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   void renderServerRunning() const;
 
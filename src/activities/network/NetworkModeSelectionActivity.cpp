@@ -16,11 +16,6 @@ const char* MENU_DESCRIPTIONS[MENU_ITEM_COUNT] = {
 };
 }  // namespace
 
-void NetworkModeSelectionActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<NetworkModeSelectionActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void NetworkModeSelectionActivity::onEnter() {
   Activity::onEnter();
 
@@ -30,14 +25,9 @@ void NetworkModeSelectionActivity::onEnter() {
   selectedIndex = 0;
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&NetworkModeSelectionActivity::taskTrampoline, "NetworkModeTask",
-              2048,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.requestUpdate();
+
+  displayTask.start("NetworkModeTask", renderingMutex, [this] { render(); });
 }
 
 void NetworkModeSelectionActivity::onExit() {
@@ -45,10 +35,7 @@ void NetworkModeSelectionActivity::onExit() {
 
   // Wait until not rendering to delete task
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
@@ -75,27 +62,15 @@ void NetworkModeSelectionActivity::loop() {
   // Handle navigation
   buttonNavigator.onNext([this] {
     selectedIndex = ButtonNavigator::nextIndex(selectedIndex, MENU_ITEM_COUNT);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPrevious([this] {
     selectedIndex = ButtonNavigator::previousIndex(selectedIndex, MENU_ITEM_COUNT);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 }
 
-void NetworkModeSelectionActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void NetworkModeSelectionActivity::render() const {
   renderer.clearScreen();
 
@@ -131,5 +106,5 @@ void NetworkModeSelectionActivity::render() const {
   const auto labels = mappedInput.mapLabels("« Back", "Select", "", "");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
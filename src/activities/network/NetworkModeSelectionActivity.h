@@ -6,6 +6,7 @@
 #include <functional>
 
 #include "../Activity.h"
+#include "../DisplayTask.h"
 #include "util/ButtonNavigator.h"
 
 // Enum for network mode selection
@@ -21,17 +22,13 @@ enum class NetworkMode { JOIN_NETWORK, CONNECT_CALIBRE, CREATE_HOTSPOT };
  * The onCancel callback is called if the user presses back.
  */
 class NetworkModeSelectionActivity final : public Activity {
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
 
   int selectedIndex = 0;
-  bool updateRequired = false;
   const std::function<void(NetworkMode)> onModeSelected;
   const std::function<void()> onCancel;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
 
  public:
@@ -12,11 +12,6 @@
 #include "components/UITheme.h"
 #include "fontIds.h"
 
-void WifiSelectionActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<WifiSelectionActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void WifiSelectionActivity::onEnter() {
   Activity::onEnter();
 
@@ -50,12 +45,9 @@ void WifiSelectionActivity::onEnter() {
   cachedMacAddress = std::string(macStr);
 
   // Task creation
-  xTaskCreate(&WifiSelectionActivity::taskTrampoline, "WifiSelectionTask",
-              4096,               // Stack size (larger for WiFi operations)
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  // Nothing to render while the keyboard subactivity is up or we're just transitioning back from it
+  displayTask.start("WifiSelectionTask", renderingMutex, [this] { render(); },
+                    [this] { return !subActivity && state != WifiSelectionState::PASSWORD_ENTRY; });
 
   // Attempt to auto-connect to the last network
   if (allowAutoConnect) {
@@ -70,7 +62,7 @@ void WifiSelectionActivity::onEnter() {
         usedSavedPassword = true;
         autoConnecting = true;
         attemptConnection();
-        updateRequired = true;
+        displayTask.requestUpdate();
         return;
       }
     }
@@ -102,11 +94,8 @@ void WifiSelectionActivity::onExit() {
   // Delete the display task (we now hold the mutex, so task is blocked if it
   // needs it)
   LOG_DBG("WIFI", "Deleting display task...");
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-    LOG_DBG("WIFI", "Display task deleted");
-  }
+  displayTask.stop();
+  LOG_DBG("WIFI", "Display task deleted");
 
   // Now safe to delete the mutex since we own it
   LOG_DBG("WIFI", "Deleting mutex...");
@@ -121,7 +110,7 @@ void WifiSelectionActivity::startWifiScan() {
   autoConnecting = false;
   state = WifiSelectionState::SCANNING;
   networks.clear();
-  updateRequired = true;
+  displayTask.requestUpdate();
 
   // Set WiFi mode to station
   WiFi.mode(WIFI_STA);
@@ -142,7 +131,7 @@ void WifiSelectionActivity::processWifiScanResults() {
 
   if (scanResult == WIFI_SCAN_FAILED) {
     state = WifiSelectionState::NETWORK_LIST;
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -191,7 +180,7 @@ void WifiSelectionActivity::processWifiScanResults() {
   WiFi.scanDelete();
   state = WifiSelectionState::NETWORK_LIST;
   selectedNetworkIndex = 0;
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void WifiSelectionActivity::selectNetwork(const int index) {
@@ -234,10 +223,10 @@ void WifiSelectionActivity::selectNetwork(const int index) {
         },
         [this] {
           state = WifiSelectionState::NETWORK_LIST;
-          updateRequired = true;
+          displayTask.requestUpdate();
           exitActivity();
         }));
-    updateRequired = true;
+    displayTask.requestUpdate();
     xSemaphoreGive(renderingMutex);
   } else {
     // Connect directly for open networks
@@ -250,7 +239,7 @@ void WifiSelectionActivity::attemptConnection() {
   connectionStartTime = millis();
   connectedIP.clear();
   connectionError.clear();
-  updateRequired = true;
+  displayTask.requestUpdate();
 
   WiFi.mode(WIFI_STA);
 
@@ -287,7 +276,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
     if (!usedSavedPassword && !enteredPassword.empty()) {
       state = WifiSelectionState::SAVE_PROMPT;
       savePromptSelection = 0;  // Default to "Yes"
-      updateRequired = true;
+      displayTask.requestUpdate();
     } else {
       // Using saved password or open network - complete immediately
       LOG_DBG("WIFI",
@@ -304,7 +293,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
       connectionError = "Error: Network not found";
     }
     state = WifiSelectionState::CONNECTION_FAILED;
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -313,7 +302,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
     WiFi.disconnect();
     connectionError = "Error: Connection timeout";
     state = WifiSelectionState::CONNECTION_FAILED;
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 }
@@ -348,13 +337,13 @@ void WifiSelectionActivity::loop() {
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       if (savePromptSelection > 0) {
         savePromptSelection--;
-        updateRequired = true;
+        displayTask.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       if (savePromptSelection < 1) {
         savePromptSelection++;
-        updateRequired = true;
+        displayTask.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
       if (savePromptSelection == 0) {
@@ -378,13 +367,13 @@ void WifiSelectionActivity::loop() {
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       if (forgetPromptSelection > 0) {
         forgetPromptSelection--;
-        updateRequired = true;
+        displayTask.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       if (forgetPromptSelection < 1) {
         forgetPromptSelection++;
-        updateRequired = true;
+        displayTask.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
       if (forgetPromptSelection == 1) {
@@ -430,7 +419,7 @@ void WifiSelectionActivity::loop() {
         // Go back to network list on failure for non-saved credentials
         state = WifiSelectionState::NETWORK_LIST;
       }
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     }
   }
@@ -465,7 +454,7 @@ void WifiSelectionActivity::loop() {
         selectedSSID = networks[selectedNetworkIndex].ssid;
         state = WifiSelectionState::FORGET_PROMPT;
         forgetPromptSelection = 0;  // Default to "Cancel"
-        updateRequired = true;
+        displayTask.requestUpdate();
         return;
       }
     }
@@ -473,12 +462,12 @@ void WifiSelectionActivity::loop() {
     // Handle navigation
     buttonNavigator.onNext([this] {
       selectedNetworkIndex = ButtonNavigator::nextIndex(selectedNetworkIndex, networks.size());
-      updateRequired = true;
+      displayTask.requestUpdate();
     });
 
     buttonNavigator.onPrevious([this] {
       selectedNetworkIndex = ButtonNavigator::previousIndex(selectedNetworkIndex, networks.size());
-      updateRequired = true;
+      displayTask.requestUpdate();
     });
   }
 }
@@ -500,31 +489,6 @@ std::string WifiSelectionActivity::getSignalStrengthIndicator(const int32_t rssi
   return "    ";  // Very weak
 }
 
-void WifiSelectionActivity::displayTaskLoop() {
-  while (true) {
-    // If a subactivity is active, yield CPU time but don't render
-    if (subActivity) {
-      vTaskDelay(10 / portTICK_PERIOD_MS);
-      continue;
-    }
-
-    // Don't render if we're in PASSWORD_ENTRY state - we're just transitioning
-    // from the keyboard subactivity back to the main activity
-    if (state == WifiSelectionState::PASSWORD_ENTRY) {
-      vTaskDelay(10 / portTICK_PERIOD_MS);
-      continue;
-    }
-
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void WifiSelectionActivity::render() const {
   renderer.clearScreen();
 
@@ -555,7 +519,7 @@ void WifiSelectionActivity::render() const {
       break;
   }
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
 
 void WifiSelectionActivity::renderNetworkList() const {
@@ -4,6 +4,7 @@
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
+#include <Trace.h>
 
 #include <sstream>
 #include <string>
@@ -21,7 +22,7 @@
 #include "fontIds.h"
 
 namespace {
-// pagesPerRefresh now comes from SETTINGS.getRefreshFrequency()
+// Cleaning refreshes are scheduled by ReaderRefreshScheduler, scaled by SETTINGS.getRefreshFrequency()
 constexpr unsigned long skipChapterMs = 700;
 constexpr unsigned long goHomeMs = 1000;
 constexpr unsigned long formattingToggleMs = 500;
@@ -116,11 +117,6 @@ void drawHelpBox(const GfxRenderer& renderer, int x, int y, const char* text, Bo
 
 }  // namespace
 
-void EpubReaderActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<EpubReaderActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void EpubReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -139,7 +135,7 @@ void EpubReaderActivity::onEnter() {
 
   epub->setupCacheDir();
 
-  FsFile f;
+  HalFile f;
   if (Storage.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
     uint8_t data[6];
     int dataSize = f.read(data, 6);
@@ -168,9 +164,9 @@ void EpubReaderActivity::onEnter() {
   APP_STATE.saveToFile();
   RECENT_BOOKS.addBook(epub->getPath(), epub->getTitle(), epub->getAuthor(), epub->getThumbBmpPath());
 
-  updateRequired = true;
+  displayTask.requestUpdate();
 
-  xTaskCreate(&EpubReaderActivity::taskTrampoline, "EpubReaderActivityTask", 8192, this, 1, &displayTaskHandle);
+  displayTask.start("EpubReaderActivityTask", renderingMutex, [this] { renderScreen(); });
 }
 
 void EpubReaderActivity::onExit() {
@@ -179,14 +175,12 @@ void EpubReaderActivity::onExit() {
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  prefetchedPage.reset();
   section.reset();
   epub.reset();
 }
@@ -196,7 +190,7 @@ void EpubReaderActivity::loop() {
   static unsigned long clearPopupTimer = 0;
   if (clearPopupTimer > 0 && millis() > clearPopupTimer) {
     clearPopupTimer = 0;
-    updateRequired = true;
+    displayTask.requestUpdate();
   }
 
   // --- HELP OVERLAY INTERCEPTION ---
@@ -209,7 +203,7 @@ void EpubReaderActivity::loop() {
         mappedInput.wasReleased(MappedInputManager::Button::PageForward) ||
         mappedInput.wasReleased(MappedInputManager::Button::Power)) {
       showHelpOverlay = false;
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     }
     return;
@@ -226,7 +220,7 @@ void EpubReaderActivity::loop() {
     if (pendingSubactivityExit) {
       pendingSubactivityExit = false;
       exitActivity();
-      updateRequired = true;
+      displayTask.requestUpdate();
       skipNextButtonCheck = true;
     }
     if (pendingGoHome) {
@@ -263,7 +257,7 @@ void EpubReaderActivity::loop() {
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     if (SETTINGS.buttonModMode == CrossPointSettings::MOD_FULL && mappedInput.getHeldTime() > formattingToggleMs) {
       showHelpOverlay = true;
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     }
 
@@ -277,6 +271,8 @@ void EpubReaderActivity::loop() {
     }
     const int bookProgressPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
     exitActivity();
+    // The menu and the screens it opens cover the page, clean their ghosting off with the page they return to
+    refreshScheduler.reset();
     enterNewActivity(new EpubReaderMenuActivity(
         this->renderer, this->mappedInput, epub->getTitle(), currentPage, totalPages, bookProgressPercent,
         SETTINGS.orientation, [this](const uint8_t orientation) { onReaderMenuBack(orientation); },
@@ -300,7 +296,7 @@ void EpubReaderActivity::loop() {
         isNightMode = !isNightMode;
         GUI.drawPopup(renderer, isNightMode ? "Dark Mode" : "Light Mode");
         clearPopupTimer = millis() + 1000;
-        updateRequired = true;
+        displayTask.requestUpdate();
         return;
       } else {
         waitingForBack = true;
@@ -371,7 +367,7 @@ void EpubReaderActivity::loop() {
       xSemaphoreGive(renderingMutex);
       GUI.drawPopup(renderer, spacingMsg);
       clearPopupTimer = millis() + 1000;
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     } else {
       if (SETTINGS.buttonModMode == CrossPointSettings::MOD_FULL && waitingForFormatDec &&
@@ -394,7 +390,7 @@ void EpubReaderActivity::loop() {
         section.reset();
         xSemaphoreGive(renderingMutex);
         clearPopupTimer = millis() + 1000;
-        updateRequired = true;
+        displayTask.requestUpdate();
         return;
       } else {
         if (SETTINGS.buttonModMode == CrossPointSettings::MOD_SIMPLE) {
@@ -433,7 +429,7 @@ void EpubReaderActivity::loop() {
     }
     xSemaphoreGive(renderingMutex);
     if (changed) {
-      updateRequired = true;
+      displayTask.requestUpdate();
     } else if (limitReached) {
       GUI.drawPopup(renderer, "Min Size Reached");
       clearPopupTimer = millis() + 1000;
@@ -453,7 +449,7 @@ void EpubReaderActivity::loop() {
       const char* orientMsg = (newOrientation == CrossPointSettings::ORIENTATION::PORTRAIT) ? "Portrait" : "Landscape";
       GUI.drawPopup(renderer, orientMsg);
       clearPopupTimer = millis() + 1000;
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     } else {
       if (SETTINGS.buttonModMode == CrossPointSettings::MOD_FULL && waitingForFormatInc &&
@@ -487,7 +483,7 @@ void EpubReaderActivity::loop() {
         xSemaphoreGive(renderingMutex);
         GUI.drawPopup(renderer, boldMsg);
         clearPopupTimer = millis() + 1000;
-        updateRequired = true;
+        displayTask.requestUpdate();
         return;
       } else {
         if (SETTINGS.buttonModMode == CrossPointSettings::MOD_SIMPLE) {
@@ -526,7 +522,7 @@ void EpubReaderActivity::loop() {
     }
     xSemaphoreGive(renderingMutex);
     if (changed) {
-      updateRequired = true;
+      displayTask.requestUpdate();
     } else if (limitReached) {
       GUI.drawPopup(renderer, "Max Size Reached");
       clearPopupTimer = millis() + 1000;
@@ -557,11 +553,13 @@ void EpubReaderActivity::loop() {
   if (!prevTriggered && !nextTriggered) {
     return;
   }
+  // Marks the button press, the render and refresh that follow show how long the turn took
+  TRACE_INSTANT(TraceModule::Reader, "pageTurn", nextTriggered);
 
   if (currentSpineIndex > 0 && currentSpineIndex >= epub->getSpineItemsCount()) {
     currentSpineIndex = epub->getSpineItemsCount() - 1;
     nextPageNumber = UINT16_MAX;
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -573,12 +571,12 @@ void EpubReaderActivity::loop() {
     currentSpineIndex = nextTriggered ? currentSpineIndex + 1 : currentSpineIndex - 1;
     section.reset();
     xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
   if (!section) {
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -592,7 +590,7 @@ void EpubReaderActivity::loop() {
       section.reset();
       xSemaphoreGive(renderingMutex);
     }
-    updateRequired = true;
+    displayTask.requestUpdate();
   } else {
     if (section->currentPage < section->pageCount - 1) {
       section->currentPage++;
@@ -603,14 +601,14 @@ void EpubReaderActivity::loop() {
       section.reset();
       xSemaphoreGive(renderingMutex);
     }
-    updateRequired = true;
+    displayTask.requestUpdate();
   }
 }
 
 void EpubReaderActivity::onReaderMenuBack(const uint8_t orientation) {
   exitActivity();
   applyOrientation(orientation);
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void EpubReaderActivity::jumpToPercent(int percent) {
@@ -680,7 +678,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
           this->renderer, this->mappedInput, epub, path, spineIdx, currentP, totalP,
           [this] {
             exitActivity();
-            updateRequired = true;
+            displayTask.requestUpdate();
           },
           [this](const int newSpineIndex) {
             if (currentSpineIndex != newSpineIndex) {
@@ -689,7 +687,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
               section.reset();
             }
             exitActivity();
-            updateRequired = true;
+            displayTask.requestUpdate();
           },
           [this](const int newSpineIndex, const int newPage) {
             if (currentSpineIndex != newSpineIndex || (section && section->currentPage != newPage)) {
@@ -698,7 +696,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
               section.reset();
             }
             exitActivity();
-            updateRequired = true;
+            displayTask.requestUpdate();
           }));
       xSemaphoreGive(renderingMutex);
       break;
@@ -717,11 +715,11 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
           [this](const int percent) {
             jumpToPercent(percent);
             exitActivity();
-            updateRequired = true;
+            displayTask.requestUpdate();
           },
           [this]() {
             exitActivity();
-            updateRequired = true;
+            displayTask.requestUpdate();
           }));
       xSemaphoreGive(renderingMutex);
       break;
@@ -803,22 +801,11 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
   xSemaphoreGive(renderingMutex);
 }
 
-void EpubReaderActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void EpubReaderActivity::renderScreen() {
   if (!epub) {
     return;
   }
+  TRACE_SCOPE(TraceModule::Reader, "renderScreen", currentSpineIndex);
 
   if (currentSpineIndex < 0) {
     currentSpineIndex = 0;
@@ -856,6 +843,8 @@ void EpubReaderActivity::renderScreen() {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     Serial.printf("[%lu] [ERS] Loading file: %s, index: %d\n", millis(), filepath.c_str(), currentSpineIndex);
     section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
+    prefetchedPage.reset();
+    prefetchedPageNumber = -1;
 
     const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
     const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
@@ -934,7 +923,11 @@ void EpubReaderActivity::renderScreen() {
   }
 
   {
-    auto p = section->loadPageFromSectionFile();
+    TRACE_SCOPE(TraceModule::Reader, "page", section->currentPage);
+    auto p = prefetchedPage && prefetchedPageNumber == section->currentPage ? std::move(prefetchedPage)
+                                                                             : section->loadPageFromSectionFile();
+    prefetchedPage.reset();
+    prefetchedPageNumber = -1;
     if (!p) {
       Serial.printf("[%lu] [ERS] Failed to load page from SD - clearing section cache\n", millis());
       section->clearCache();
@@ -945,11 +938,10 @@ void EpubReaderActivity::renderScreen() {
     renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     Serial.printf("[%lu] [ERS] Rendered page in %dms\n", millis(), millis() - start);
   }
-  saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
 }
 
 void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
-  FsFile f;
+  HalFile f;
   if (Storage.openFileForWrite("ERS", epub->getCachePath() + "/progress.bin", f)) {
     uint8_t data[6];
     data[0] = currentSpineIndex & 0xFF;
@@ -966,22 +958,41 @@ void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageC
   }
 }
 
+void EpubReaderActivity::prepareNextPage() {
+  saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+
+  // Most page turns go forward
+  const int nextPage = section->currentPage + 1;
+  if (nextPage < section->pageCount && prefetchedPageNumber != nextPage) {
+    prefetchedPage = section->loadPageFromSectionFile(nextPage);
+    prefetchedPageNumber = prefetchedPage ? nextPage : -1;
+  }
+}
+
 void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
                                         const int orientedMarginRight, const int orientedMarginBottom,
                                         const int orientedMarginLeft) {
   bool useBold = (SETTINGS.forceBoldText == 1);
+  // Don't anti-alias the help overlay
+  const bool antiAlias = SETTINGS.textAntiAliasing && !showHelpOverlay && !isNightMode;
 
-  // 1. Draw the normal black text
-  
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  // Rasterize the text once into a 2bpp capture when anti-aliasing, the BW and gray planes are derived from it.
+  // If the capture can't be allocated, fall back to rendering each grayscale pass separately below.
+  const bool grayCapture = antiAlias && renderer.beginGrayscaleCapture();
+  [[maybe_unused]] const auto rasterStart = millis();
 
-  // 2. Thicken the core black text by shifting 1 pixel right
-  if (SETTINGS.textAntiAliasing && !showHelpOverlay && !isNightMode) {
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft + 1, orientedMarginTop);
-  }
+  // Thicken the core black text by 1 pixel when anti-aliasing and another one for forced bold. The renderer
+  // emboldens each glyph as it is drawn, so the page is only rendered once.
+  renderer.setTextEmbolden((antiAlias ? 1 : 0) + (useBold ? 1 : 0));
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
 
   // IMMEDIATELY TURN OFF BOLD SO THE UI REMAINS NORMAL
-  
+  renderer.setTextEmbolden(0);
+
+  if (grayCapture) {
+    renderer.endGrayscaleCapture();
+  }
+  LOG_DBG("ERS", "Rasterized page text in %lums (%s)", millis() - rasterStart, grayCapture ? "2bpp capture" : "BW");
 
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
 
@@ -1047,26 +1058,36 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   }
 
   // --- STANDARD REFRESH ---
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+  // The waveform takes hundreds of ms without needing the CPU, save progress and read ahead meanwhile (builds with
+  // DISPLAY_SYNCHRONOUS_REFRESH, the default, do this after the refresh)
+  [[maybe_unused]] const auto submitStart = millis();
+  renderer.submitBuffer(refreshScheduler.nextRefreshMode(renderer));
+  [[maybe_unused]] const auto overlapStart = millis();
+  prepareNextPage();
+  [[maybe_unused]] const auto overlapEnd = millis();
+  [[maybe_unused]] const uint32_t waited = renderer.waitForRefresh();
+  LOG_DBG("ERS", "Page refresh: %lums submit, %lums overlapped, %lums waiting", overlapStart - submitStart,
+          overlapEnd - overlapStart, waited);
+
+  if (grayCapture) {
+    [[maybe_unused]] const auto grayStart = millis();
+    renderer.displayGrayscaleCapture();
+    LOG_DBG("ERS", "Derived and displayed grayscale planes in %lums", millis() - grayStart);
+    return;
   }
 
   renderer.storeBwBuffer();
 
-  if (SETTINGS.textAntiAliasing && !showHelpOverlay && !isNightMode) {  // Don't anti-alias the help overlay
+  if (antiAlias) {
+    [[maybe_unused]] const auto grayStart = millis();
     renderer.clearScreen(0x00);
 
     // TURN ON BOLD FOR GRAYSCALE PASSES
-    
+    renderer.setTextEmbolden(1 + (useBold ? 1 : 0));
 
     // --- LSB (Light Grays) Pass ---
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft + 1, orientedMarginTop);
     renderer.copyGrayscaleLsbBuffers();
 
     renderer.clearScreen(0x00);
@@ -1074,14 +1095,14 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     // --- MSB (Dark Grays) Pass ---
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
     page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft + 1, orientedMarginTop);
     renderer.copyGrayscaleMsbBuffers();
 
     // TURN BOLD OFF BEFORE FINAL FLUSH
-    
+    renderer.setTextEmbolden(0);
 
     renderer.displayGrayBuffer();
     renderer.setRenderMode(GfxRenderer::BW);
+    LOG_DBG("ERS", "Rendered and displayed grayscale passes in %lums", millis() - grayStart);
   }
   renderer.restoreBwBuffer();
 }
@@ -10,39 +10,19 @@
 void EpubReaderMenuActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
   renderingMutex = xSemaphoreCreateMutex();
-  updateRequired = true;
+  displayTask.requestUpdate();
 
-  xTaskCreate(&EpubReaderMenuActivity::taskTrampoline, "EpubMenuTask", 4096, this, 1, &displayTaskHandle);
+  displayTask.start("EpubMenuTask", renderingMutex, [this] { renderScreen(); }, [this] { return !subActivity; });
 }
 
 void EpubReaderMenuActivity::onExit() {
   ActivityWithSubactivity::onExit();
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
 
-void EpubReaderMenuActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<EpubReaderMenuActivity*>(param);
-  self->displayTaskLoop();
-}
-
-void EpubReaderMenuActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void EpubReaderMenuActivity::loop() {
   if (subActivity) {
     subActivity->loop();
@@ -51,33 +31,33 @@ void EpubReaderMenuActivity::loop() {
 
   buttonNavigator.onNext([this] {
     selectedIndex = ButtonNavigator::nextIndex(selectedIndex, static_cast<int>(menuItems.size()));
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPrevious([this] {
     selectedIndex = ButtonNavigator::previousIndex(selectedIndex, static_cast<int>(menuItems.size()));
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     const auto selectedAction = menuItems[selectedIndex].action;
     if (selectedAction == MenuAction::ROTATE_SCREEN) {
       pendingOrientation = (pendingOrientation + 1) % orientationLabels.size();
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     }
 
     if (selectedAction == MenuAction::BUTTON_MOD_SETTINGS) {
       SETTINGS.buttonModMode = (SETTINGS.buttonModMode + 1) % CrossPointSettings::BUTTON_MOD_MODE_COUNT;
       SETTINGS.saveToFile();
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     }
 
     if (selectedAction == MenuAction::SWAP_CONTROLS) {
       SETTINGS.swapPortraitControls = (SETTINGS.swapPortraitControls == 0) ? 1 : 0;
       SETTINGS.saveToFile();
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     }
 
@@ -151,5 +131,5 @@ void EpubReaderMenuActivity::renderScreen() {
   const auto labels = mappedInput.mapLabels("« Back", "Select", "Up", "Down");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
@@ -16,41 +16,19 @@ void EpubReaderPercentSelectionActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
   // Set up rendering task and mark first frame dirty.
   renderingMutex = xSemaphoreCreateMutex();
-  updateRequired = true;
-  xTaskCreate(&EpubReaderPercentSelectionActivity::taskTrampoline, "EpubPercentSlider", 4096, this, 1,
-              &displayTaskHandle);
+  displayTask.requestUpdate();
+  displayTask.start("EpubPercentSlider", renderingMutex, [this] { renderScreen(); }, [this] { return !subActivity; });
 }
 
 void EpubReaderPercentSelectionActivity::onExit() {
   ActivityWithSubactivity::onExit();
   // Ensure the render task is stopped before freeing the mutex.
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
 
-void EpubReaderPercentSelectionActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<EpubReaderPercentSelectionActivity*>(param);
-  self->displayTaskLoop();
-}
-
-void EpubReaderPercentSelectionActivity::displayTaskLoop() {
-  while (true) {
-    // Render only when the view is dirty and no subactivity is running.
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void EpubReaderPercentSelectionActivity::adjustPercent(const int delta) {
   // Apply delta and clamp within 0-100.
   percent += delta;
@@ -59,7 +37,7 @@ void EpubReaderPercentSelectionActivity::adjustPercent(const int delta) {
   } else if (percent > 100) {
     percent = 100;
   }
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void EpubReaderPercentSelectionActivity::loop() {
@@ -121,5 +99,5 @@ void EpubReaderPercentSelectionActivity::renderScreen() {
   const auto labels = mappedInput.mapLabels("« Back", "Select", "-", "+");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
@@ -7,6 +7,7 @@
 
 #include "MappedInputManager.h"
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 #include "util/ButtonNavigator.h"
 
 class EpubReaderPercentSelectionActivity final : public ActivityWithSubactivity {
@@ -28,19 +29,15 @@ class EpubReaderPercentSelectionActivity final : public ActivityWithSubactivity
   // Current percent value (0-100) shown on the slider.
   int percent = 0;
   // Render dirty flag for the task loop.
-  bool updateRequired = false;
   // FreeRTOS task and mutex for rendering.
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
 
   // Callback invoked when the user confirms a percent.
   const std::function<void(int)> onSelect;
   // Callback invoked when the user cancels the slider.
   const std::function<void()> onCancel;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   // Render the slider UI.
   void renderScreen();
   // Change the current percent by a delta and clamp within bounds.
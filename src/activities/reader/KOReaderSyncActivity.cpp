@@ -8,12 +8,13 @@
 #include "KOReaderCredentialStore.h"
 #include "KOReaderDocumentId.h"
 #include "MappedInputManager.h"
+#include "WorkerService.h"
 #include "activities/network/WifiSelectionActivity.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 
 namespace {
-void syncTimeWithNTP() {
+void syncTimeWithNTP(const CancelToken& token) {
   // Stop SNTP if already running (can't reconfigure while running)
   if (esp_sntp_enabled()) {
     esp_sntp_stop();
@@ -27,7 +28,7 @@ void syncTimeWithNTP() {
   // Wait for time to sync (with timeout)
   int retry = 0;
   const int maxRetries = 50;  // 5 seconds max
-  while (sntp_get_sync_status() != SNTP_SYNC_STATUS_COMPLETED && retry < maxRetries) {
+  while (sntp_get_sync_status() != SNTP_SYNC_STATUS_COMPLETED && retry < maxRetries && !token.isCancelled()) {
     vTaskDelay(100 / portTICK_PERIOD_MS);
     retry++;
   }
@@ -40,11 +41,6 @@ void syncTimeWithNTP() {
 }
 }  // namespace
 
-void KOReaderSyncActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KOReaderSyncActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void KOReaderSyncActivity::onWifiSelectionComplete(const bool success) {
   exitActivity();
 
@@ -60,20 +56,25 @@ void KOReaderSyncActivity::onWifiSelectionComplete(const bool success) {
   state = SYNCING;
   statusMessage = "Syncing time...";
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
 
   // Sync time with NTP before making API requests
-  syncTimeWithNTP();
+  syncTimeWithNTP(syncToken);
 
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   statusMessage = "Calculating document hash...";
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
 
-  performSync();
+  performSync(syncToken);
 }
 
-void KOReaderSyncActivity::performSync() {
+// Runs on the background worker when WiFi was already up. The HTTP requests can't be interrupted, but fail fast once
+// onExit() has turned WiFi off, the token is checked before and after each of them.
+void KOReaderSyncActivity::performSync(const CancelToken& token) {
+  if (token.isCancelled()) {
+    return;
+  }
   // Calculate document hash based on user's preferred method
   if (KOREADER_STORE.getMatchMethod() == DocumentMatchMethod::FILENAME) {
     documentHash = KOReaderDocumentId::calculateFromFilename(epubPath);
@@ -85,7 +86,7 @@ void KOReaderSyncActivity::performSync() {
     state = SYNC_FAILED;
     statusMessage = "Failed to calculate document hash";
     xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -94,11 +95,17 @@ void KOReaderSyncActivity::performSync() {
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   statusMessage = "Fetching remote progress...";
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
   vTaskDelay(10 / portTICK_PERIOD_MS);
+  if (token.isCancelled()) {
+    return;
+  }
 
   // Fetch remote progress
   const auto result = KOReaderSyncClient::getProgress(documentHash, remoteProgress);
+  if (token.isCancelled()) {
+    return;
+  }
 
   if (result == KOReaderSyncClient::NOT_FOUND) {
     // No remote progress - offer to upload
@@ -106,7 +113,7 @@ void KOReaderSyncActivity::performSync() {
     state = NO_REMOTE_PROGRESS;
     hasRemoteProgress = false;
     xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -115,7 +122,7 @@ void KOReaderSyncActivity::performSync() {
     state = SYNC_FAILED;
     statusMessage = KOReaderSyncClient::errorString(result);
     xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -132,7 +139,7 @@ void KOReaderSyncActivity::performSync() {
   state = SHOWING_RESULT;
   selectedOption = 0;  // Default to "Apply"
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void KOReaderSyncActivity::performUpload() {
@@ -140,7 +147,7 @@ void KOReaderSyncActivity::performUpload() {
   state = UPLOADING;
   statusMessage = "Uploading progress...";
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
   vTaskDelay(10 / portTICK_PERIOD_MS);
 
   // Convert current position to KOReader format
@@ -159,14 +166,14 @@ void KOReaderSyncActivity::performUpload() {
     state = SYNC_FAILED;
     statusMessage = KOReaderSyncClient::errorString(result);
     xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   state = UPLOAD_COMPLETE;
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void KOReaderSyncActivity::onEnter() {
@@ -174,17 +181,12 @@ void KOReaderSyncActivity::onEnter() {
 
   renderingMutex = xSemaphoreCreateMutex();
 
-  xTaskCreate(&KOReaderSyncActivity::taskTrampoline, "KOSyncTask",
-              4096,               // Stack size (larger for network operations)
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.start("KOSyncTask", renderingMutex, [this] { render(); });
 
   // Check for credentials first
   if (!KOREADER_STORE.hasCredentials()) {
     state = NO_CREDENTIALS;
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -197,22 +199,22 @@ void KOReaderSyncActivity::onEnter() {
     LOG_DBG("KOSync", "Already connected to WiFi");
     state = SYNCING;
     statusMessage = "Syncing time...";
-    updateRequired = true;
-
-    // Perform sync directly (will be handled in loop)
-    xTaskCreate(
-        [](void* param) {
-          auto* self = static_cast<KOReaderSyncActivity*>(param);
-          // Sync time first
-          syncTimeWithNTP();
-          xSemaphoreTake(self->renderingMutex, portMAX_DELAY);
-          self->statusMessage = "Calculating document hash...";
-          xSemaphoreGive(self->renderingMutex);
-          self->updateRequired = true;
-          self->performSync();
-          vTaskDelete(nullptr);
-        },
-        "SyncTask", 4096, this, 1, nullptr);
+    displayTask.requestUpdate();
+
+    // Perform sync in the background
+    syncToken = CancelToken();
+    WORKER.submit(WorkerService::Priority::Background, this, syncToken, [this](const CancelToken& token) {
+      // Sync time first
+      syncTimeWithNTP(token);
+      if (token.isCancelled()) {
+        return;
+      }
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      statusMessage = "Calculating document hash...";
+      xSemaphoreGive(renderingMutex);
+      displayTask.requestUpdate();
+      performSync(token);
+    });
     return;
   }
 
@@ -231,28 +233,17 @@ void KOReaderSyncActivity::onExit() {
   WiFi.mode(WIFI_OFF);
   delay(100);
 
+  // A sync still running stops at its next step, its requests fail fast without WiFi
+  syncToken.cancel();
+  WORKER.cancel(this);
+
   // Wait until not rendering to delete task
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
 
-void KOReaderSyncActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void KOReaderSyncActivity::render() {
   if (subActivity) {
     return;
@@ -388,11 +379,11 @@ void KOReaderSyncActivity::loop() {
     if (mappedInput.wasPressed(MappedInputManager::Button::Up) ||
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       selectedOption = (selectedOption + 1) % 2;  // Wrap around among 2 options
-      updateRequired = true;
+      displayTask.requestUpdate();
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       selectedOption = (selectedOption + 1) % 2;  // Wrap around among 2 options
-      updateRequired = true;
+      displayTask.requestUpdate();
     }
 
     if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
@@ -10,6 +10,7 @@
 #include "KOReaderSyncClient.h"
 #include "ProgressMapper.h"
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 
 /**
  * Activity for syncing reading progress with KOReader sync server.
@@ -65,10 +66,10 @@ class KOReaderSyncActivity final : public ActivityWithSubactivity {
   int currentSpineIndex;
   int currentPage;
   int totalPagesInSpine;
-
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  DisplayTask displayTask;
+  // Cancels the background sync when the activity exits
+  CancelToken syncToken;
 
   State state = WIFI_SELECTION;
   std::string statusMessage;
@@ -89,10 +90,7 @@ class KOReaderSyncActivity final : public ActivityWithSubactivity {
   OnSyncCompleteCallback onSyncComplete;
 
   void onWifiSelectionComplete(bool success);
-  void performSync();
+  void performSync(const CancelToken& token);
   void performUpload();
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
 };
@@ -0,0 +1,48 @@
+#include "ReaderRefreshScheduler.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+
+#include "CrossPointSettings.h"
+
+HalDisplay::RefreshMode ReaderRefreshScheduler::nextRefreshMode(const GfxRenderer& renderer) {
+  const uint8_t* frameBuffer = renderer.peekFrameBuffer();
+  const int pagesPerRefresh = SETTINGS.getRefreshFrequency();
+  const uint32_t threshold = pagesPerRefresh * REGION_PIXELS * DENSE_PAGE_GHOSTING_PER_MILLE / 1000;
+
+  uint32_t worstGhosting = 0;
+  for (int row = 0; row < REGION_ROWS; row++) {
+    for (int col = 0; col < REGION_COLS; col++) {
+      const uint8_t* line =
+          frameBuffer + row * REGION_HEIGHT * HalDisplay::DISPLAY_WIDTH_BYTES + col * REGION_WIDTH_BYTES;
+      uint32_t ink = 0;
+      for (int y = 0; y < REGION_HEIGHT; y++, line += HalDisplay::DISPLAY_WIDTH_BYTES) {
+        for (int i = 0; i < REGION_WIDTH_BYTES; i++) {
+          ink += __builtin_popcount(static_cast<uint8_t>(~line[i]));
+        }
+      }
+
+      // Keeping the previous page around for an exact XOR would cost another 48KB, so the black-to-white transitions
+      // are estimated from the ink counts alone, as if the two pages were independent: each previously black pixel
+      // turns white unless it is covered by the new page's ink. On text this overestimates by about a third, as lines
+      // of consecutive pages tend to share rows, which is accounted for in DENSE_PAGE_GHOSTING_PER_MILLE.
+      ghosting[row][col] += inkPixels[row][col] * (REGION_PIXELS - ink) / REGION_PIXELS;
+      inkPixels[row][col] = static_cast<uint16_t>(ink);
+      worstGhosting = std::max(worstGhosting, ghosting[row][col]);
+    }
+  }
+
+  if (!cleaningRequired && pagesPerRefresh > 1 && worstGhosting < threshold) {
+    return HalDisplay::FAST_REFRESH;
+  }
+
+  LOG_DBG("RFS", "Cleaning refresh (worst region ghosting %lu / %lu)", worstGhosting, threshold);
+  cleaningRequired = false;
+  for (auto& regionRow : ghosting) {
+    for (auto& regionGhosting : regionRow) {
+      regionGhosting = 0;
+    }
+  }
+  return HalDisplay::HALF_REFRESH;
+}
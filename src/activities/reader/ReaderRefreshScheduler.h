@@ -0,0 +1,37 @@
+#pragma once
+
+#include <GfxRenderer.h>
+
+#include <cstdint>
+
+// Decides when a reader page should be displayed with a cleaning (half) refresh, shared by the EPUB, TXT and XTC
+// readers.
+//
+// Fast refreshes leave a faint ghost wherever black pixels turn white. Instead of counting pages, the ghosting
+// accumulated since the last cleaning refresh is estimated for each panel region, and a cleaning refresh is done once
+// any region crosses a threshold. The refresh frequency setting scales the threshold: "15 pages" allows as much
+// ghosting as 15 turns of densely printed text, so light pages stretch the interval and images or tables shorten it.
+class ReaderRefreshScheduler {
+ public:
+  // Call with the finished BW page in the frame buffer, right before displaying it
+  HalDisplay::RefreshMode nextRefreshMode(const GfxRenderer& renderer);
+  // Use a cleaning refresh for the next page, e.g. after a full-screen subactivity
+  void reset() { cleaningRequired = true; }
+
+ private:
+  // 80x80 px regions of the physical panel
+  static constexpr int REGION_WIDTH_BYTES = 10;
+  static constexpr int REGION_HEIGHT = 80;
+  static constexpr int REGION_COLS = HalDisplay::DISPLAY_WIDTH_BYTES / REGION_WIDTH_BYTES;
+  static constexpr int REGION_ROWS = HalDisplay::DISPLAY_HEIGHT / REGION_HEIGHT;
+  static_assert(REGION_COLS * REGION_WIDTH_BYTES == HalDisplay::DISPLAY_WIDTH_BYTES &&
+                    REGION_ROWS * REGION_HEIGHT == HalDisplay::DISPLAY_HEIGHT,
+                "Ghosting regions must tile the panel");
+  static constexpr uint32_t REGION_PIXELS = REGION_WIDTH_BYTES * 8 * REGION_HEIGHT;
+  // Estimated black-to-white transitions in a region when turning a densely printed text page (Bookerly 14)
+  static constexpr uint32_t DENSE_PAGE_GHOSTING_PER_MILLE = 190;
+
+  bool cleaningRequired = true;
+  uint16_t inkPixels[REGION_ROWS][REGION_COLS] = {};  // Black pixels of the previously displayed page
+  uint32_t ghosting[REGION_ROWS][REGION_COLS] = {};   // Estimated transitions since the last cleaning refresh
+};
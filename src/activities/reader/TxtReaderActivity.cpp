@@ -3,7 +3,9 @@
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <Serialization.h>
-#include <Utf8.h>
+#include <TxtPaginator.h>
+
+#include <new>
 
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
@@ -17,17 +19,17 @@ constexpr unsigned long goHomeMs = 1000;
 constexpr int statusBarMargin = 25;
 constexpr int progressBarMarginTop = 1;
 constexpr size_t CHUNK_SIZE = 8 * 1024;  // 8KB chunk for reading
+// Pages indexed between two writes of index.bin, an interrupted index resumes from the last write
+constexpr size_t CHECKPOINT_PAGES = 64;
 
 // Cache file magic and version
 constexpr uint32_t CACHE_MAGIC = 0x54585449;  // "TXTI"
-constexpr uint8_t CACHE_VERSION = 2;          // Increment when cache format changes
+constexpr uint8_t CACHE_VERSION = 3;          // Increment when cache format changes
+// Positions in index.bin of the complete flag, followed by the page count, and of the page offsets
+constexpr size_t CACHE_COMPLETE_POSITION = 26;
+constexpr size_t CACHE_OFFSETS_POSITION = 31;
 }  // namespace
 
-void TxtReaderActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<TxtReaderActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void TxtReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -65,14 +67,9 @@ void TxtReaderActivity::onEnter() {
   RECENT_BOOKS.addBook(filePath, fileName, "", "");
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&TxtReaderActivity::taskTrampoline, "TxtReaderActivityTask",
-              6144,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.requestUpdate();
+
+  displayTask.start("TxtReaderActivityTask", renderingMutex, [this] { renderScreen(); });
 }
 
 void TxtReaderActivity::onExit() {
@@ -81,16 +78,20 @@ void TxtReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
+  // Indexing waits for renderingMutex between chunks, stop it before taking the mutex. It saves what it indexed.
+  indexToken.cancel();
+  WORKER.cancel(this);
+
   // Wait until not rendering to delete task
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
   pageOffsets.clear();
   currentPageLines.clear();
+  prefetchedLines.clear();
+  prefetchedOffset = SIZE_MAX;
+  readBuffer.reset();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
   txt.reset();
@@ -128,28 +129,17 @@ void TxtReaderActivity::loop() {
                                  : (mappedInput.wasReleased(MappedInputManager::Button::PageForward) || powerPageTurn ||
                                     mappedInput.wasReleased(MappedInputManager::Button::Right));
 
-  if (!prevTriggered && !nextTriggered) {
+  // The saved page is shown once it is indexed
+  if ((!prevTriggered && !nextTriggered) || pendingPage >= 0) {
     return;
   }
 
   if (prevTriggered && currentPage > 0) {
     currentPage--;
-    updateRequired = true;
+    displayTask.requestUpdate();
   } else if (nextTriggered && currentPage < totalPages - 1) {
     currentPage++;
-    updateRequired = true;
-  }
-}
-
-void TxtReaderActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    displayTask.requestUpdate();
   }
 }
 
@@ -193,57 +183,114 @@ void TxtReaderActivity::initializeReader() {
 
   LOG_DBG("TRS", "Viewport: %dx%d, lines per page: %d", viewportWidth, viewportHeight, linesPerPage);
 
-  // Try to load cached page index first
-  if (!loadPageIndexCache()) {
-    // Cache not found, build page index
-    buildPageIndex();
-    // Save to cache for next time
-    savePageIndexCache();
+  readBuffer.reset(new (std::nothrow) uint8_t[CHUNK_SIZE]);
+  if (!readBuffer) {
+    LOG_ERR("TRS", "Failed to allocate %zu bytes", CHUNK_SIZE);
   }
 
+  // Try to load cached page index first, it can be one that was interrupted
+  bool indexComplete = false;
+  if (!loadPageIndexCache(indexComplete)) {
+    pageOffsets.assign(1, 0);  // First page starts at offset 0
+    totalPages = 1;
+    savedPageOffsets = 0;
+    createPageIndexCache();
+  }
+  indexing = !indexComplete;
+
   // Load saved progress
   loadProgress();
 
+  // Pages past the index are laid out in the background, reading starts right away
+  if (!indexComplete) {
+    startPageIndex();
+  }
+
   initialized = true;
 }
 
-void TxtReaderActivity::buildPageIndex() {
-  pageOffsets.clear();
-  pageOffsets.push_back(0);  // First page starts at offset 0
-
-  size_t offset = 0;
-  const size_t fileSize = txt->getFileSize();
+void TxtReaderActivity::startPageIndex() {
+  indexedBytes = pageOffsets.back();
+  LOG_DBG("TRS", "Indexing pages of %zu bytes from offset %zu...", txt->getFileSize(), indexedBytes);
 
-  LOG_DBG("TRS", "Building page index for %zu bytes...", fileSize);
-
-  GUI.drawPopup(renderer, "Indexing...");
+  indexToken = CancelToken();
+  const auto job = [this](const CancelToken& token) { indexPages(token); };
+  if (!WORKER.submit(WorkerService::Priority::Background, this, indexToken, job)) {
+    LOG_ERR("TRS", "Failed to queue page indexing");
+    indexing = false;
+    pendingPage = -1;
+  }
+}
 
-  while (offset < fileSize) {
-    std::vector<std::string> tempLines;
-    size_t nextOffset = offset;
+void TxtReaderActivity::indexPages(const CancelToken& token) {
+  const size_t fileSize = txt->getFileSize();
+  [[maybe_unused]] const unsigned long start = millis();
 
-    if (!loadPageAtOffset(offset, tempLines, nextOffset)) {
-      break;
-    }
+  // The mutex is held for one chunk at a time so pages render in between. onExit() cancels this job before taking
+  // the mutex, so waiting for it can't deadlock.
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
 
-    if (nextOffset <= offset) {
-      // No progress made, avoid infinite loop
-      break;
-    }
+  const EpdFontFamily* font = renderer.getFont(cachedFontId);
+  HalFile file;
+  bool complete = false;
+  if (font && readBuffer && Storage.openFileForRead("TRS", txt->getPath(), file) && file.seek(indexedBytes)) {
+    // On the heap, the background task's stack is small
+    auto paginator = std::make_unique<TxtPaginator>(*font, viewportWidth, linesPerPage);
+    paginator->onPage = [this, fileSize](const size_t nextPageOffset) {
+      if (nextPageOffset < fileSize) {
+        pageOffsets.push_back(nextPageOffset);
+      }
+      return true;
+    };
+    paginator->restart(indexedBytes);
+
+    while (!token.isCancelled()) {
+      const size_t length = std::min(CHUNK_SIZE, fileSize - indexedBytes);
+      if (length == 0) {
+        paginator->finish();
+        complete = true;
+        break;
+      }
+      if (file.read(readBuffer.get(), length) != static_cast<int>(length)) {
+        LOG_ERR("TRS", "Failed to read %zu bytes at offset %zu", length, indexedBytes);
+        break;
+      }
+      paginator->feed(readBuffer.get(), length);
+      indexedBytes += length;
+      totalPages = static_cast<int>(pageOffsets.size());
+
+      const int pending = pendingPage;
+      if (pending >= 0 && pending < totalPages) {
+        currentPage = pending;
+        pendingPage = -1;
+        displayTask.requestUpdate();
+      }
+      if (pageOffsets.size() - savedPageOffsets >= CHECKPOINT_PAGES) {
+        checkpointPageIndexCache(false);
+      }
 
-    offset = nextOffset;
-    if (offset < fileSize) {
-      pageOffsets.push_back(offset);
+      xSemaphoreGive(renderingMutex);
+      vTaskDelay(1);  // Let a waiting render take the mutex
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
     }
+    file.close();
+  }
 
-    // Yield to other tasks periodically
-    if (pageOffsets.size() % 20 == 0) {
-      vTaskDelay(1);
-    }
+  checkpointPageIndexCache(complete);
+  totalPages = static_cast<int>(pageOffsets.size());
+  if (pendingPage >= 0) {
+    // The saved page was past the end of the book, or indexing stopped before it
+    currentPage = totalPages - 1;
+    pendingPage = -1;
   }
+  indexing = false;
+  xSemaphoreGive(renderingMutex);
 
-  totalPages = pageOffsets.size();
-  LOG_DBG("TRS", "Built page index: %d pages", totalPages);
+  LOG_DBG("TRS", "Indexed %d pages in %lums%s", totalPages.load(), millis() - start, complete ? "" : ", not complete");
+  if (!token.isCancelled()) {
+    // Shows the page count now that it is known
+    displayTask.requestUpdate();
+  }
 }
 
 bool TxtReaderActivity::loadPageAtOffset(size_t offset, std::vector<std::string>& outLines, size_t& nextOffset) {
@@ -254,120 +301,45 @@ bool TxtReaderActivity::loadPageAtOffset(size_t offset, std::vector<std::string>
     return false;
   }
 
-  // Read a chunk from file
-  size_t chunkSize = std::min(CHUNK_SIZE, fileSize - offset);
-  auto* buffer = static_cast<uint8_t*>(malloc(chunkSize + 1));
-  if (!buffer) {
-    LOG_ERR("TRS", "Failed to allocate %zu bytes", chunkSize);
+  const EpdFontFamily* font = renderer.getFont(cachedFontId);
+  if (!font || !readBuffer) {
     return false;
   }
 
-  if (!txt->readContent(buffer, offset, chunkSize)) {
-    free(buffer);
+  HalFile file;
+  if (!Storage.openFileForRead("TRS", txt->getPath(), file)) {
+    return false;
+  }
+  if (!file.seek(offset)) {
+    file.close();
     return false;
   }
-  buffer[chunkSize] = '\0';
-
-  // Parse lines from buffer
-  size_t pos = 0;
-
-  while (pos < chunkSize && static_cast<int>(outLines.size()) < linesPerPage) {
-    // Find end of line
-    size_t lineEnd = pos;
-    while (lineEnd < chunkSize && buffer[lineEnd] != '\n') {
-      lineEnd++;
-    }
-
-    // Check if we have a complete line
-    bool lineComplete = (lineEnd < chunkSize) || (offset + lineEnd >= fileSize);
-
-    if (!lineComplete && static_cast<int>(outLines.size()) > 0) {
-      // Incomplete line and we already have some lines, stop here
-      break;
-    }
-
-    // Calculate the actual length of line content in the buffer (excluding newline)
-    size_t lineContentLen = lineEnd - pos;
-
-    // Check for carriage return
-    bool hasCR = (lineContentLen > 0 && buffer[pos + lineContentLen - 1] == '\r');
-    size_t displayLen = hasCR ? lineContentLen - 1 : lineContentLen;
-
-    // Extract line content for display (without CR/LF)
-    std::string line(reinterpret_cast<char*>(buffer + pos), displayLen);
-
-    // Track position within this source line (in bytes from pos)
-    size_t lineBytePos = 0;
-
-    // Word wrap if needed
-    while (!line.empty() && static_cast<int>(outLines.size()) < linesPerPage) {
-      int lineWidth = renderer.getTextWidth(cachedFontId, line.c_str());
-
-      if (lineWidth <= viewportWidth) {
-        outLines.push_back(line);
-        lineBytePos = displayLen;  // Consumed entire display content
-        line.clear();
-        break;
-      }
-
-      // Find break point
-      size_t breakPos = line.length();
-      while (breakPos > 0 && renderer.getTextWidth(cachedFontId, line.substr(0, breakPos).c_str()) > viewportWidth) {
-        // Try to break at space
-        size_t spacePos = line.rfind(' ', breakPos - 1);
-        if (spacePos != std::string::npos && spacePos > 0) {
-          breakPos = spacePos;
-        } else {
-          // Break at character boundary for UTF-8
-          breakPos--;
-          // Make sure we don't break in the middle of a UTF-8 sequence
-          while (breakPos > 0 && (line[breakPos] & 0xC0) == 0x80) {
-            breakPos--;
-          }
-        }
-      }
-
-      if (breakPos == 0) {
-        breakPos = 1;
-      }
-
-      outLines.push_back(line.substr(0, breakPos));
-
-      // Skip space at break point
-      size_t skipChars = breakPos;
-      if (breakPos < line.length() && line[breakPos] == ' ') {
-        skipChars++;
-      }
-      lineBytePos += skipChars;
-      line = line.substr(skipChars);
-    }
 
-    // Determine how much of the source buffer we consumed
-    if (line.empty()) {
-      // Fully consumed this source line, move past the newline
-      pos = lineEnd + 1;
-    } else {
-      // Partially consumed - page is full mid-line
-      // Move pos to where we stopped in the line (NOT past the line)
-      pos = pos + lineBytePos;
+  // Lay out lines until the page is full, reading the file a chunk at a time
+  TxtPaginator paginator(*font, viewportWidth, linesPerPage);
+  nextOffset = fileSize;
+  paginator.onLine = [&outLines](const std::string_view line, size_t) { outLines.emplace_back(line); };
+  paginator.onPage = [&nextOffset](const size_t nextPageOffset) {
+    nextOffset = nextPageOffset;
+    return false;
+  };
+  paginator.restart(offset);
+
+  size_t position = offset;
+  bool pageFull = false;
+  while (!pageFull && position < fileSize) {
+    const size_t length = std::min(CHUNK_SIZE, fileSize - position);
+    if (file.read(readBuffer.get(), length) != static_cast<int>(length)) {
+      LOG_ERR("TRS", "Failed to read %zu bytes at offset %zu", length, position);
       break;
     }
+    pageFull = !paginator.feed(readBuffer.get(), length);
+    position += length;
   }
-
-  // Ensure we make progress even if calculations go wrong
-  if (pos == 0 && !outLines.empty()) {
-    // Fallback: at minimum, consume something to avoid infinite loop
-    pos = 1;
-  }
-
-  nextOffset = offset + pos;
-
-  // Make sure we don't go past the file
-  if (nextOffset > fileSize) {
-    nextOffset = fileSize;
+  if (!pageFull) {
+    paginator.finish();
   }
-
-  free(buffer);
+  file.close();
 
   return !outLines.empty();
 }
@@ -382,6 +354,11 @@ void TxtReaderActivity::renderScreen() {
     initializeReader();
   }
 
+  if (pendingPage >= 0) {
+    GUI.drawPopup(renderer, "Indexing...");
+    return;
+  }
+
   if (pageOffsets.empty()) {
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "Empty file", true, EpdFontFamily::BOLD);
@@ -393,17 +370,31 @@ void TxtReaderActivity::renderScreen() {
   if (currentPage < 0) currentPage = 0;
   if (currentPage >= totalPages) currentPage = totalPages - 1;
 
-  // Load current page content
-  size_t offset = pageOffsets[currentPage];
-  size_t nextOffset;
-  currentPageLines.clear();
-  loadPageAtOffset(offset, currentPageLines, nextOffset);
+  // Load current page content, usually read ahead during the previous refresh
+  const size_t offset = pageOffsets[currentPage];
+  if (offset == prefetchedOffset) {
+    currentPageLines.swap(prefetchedLines);
+  } else {
+    size_t nextOffset;
+    currentPageLines.clear();
+    loadPageAtOffset(offset, currentPageLines, nextOffset);
+  }
+  prefetchedLines.clear();
+  prefetchedOffset = SIZE_MAX;
 
   renderer.clearScreen();
   renderPage();
+}
 
-  // Save progress
-  saveProgress();
+void TxtReaderActivity::prefetchNextPage() {
+  if (currentPage + 1 >= totalPages) {
+    return;
+  }
+  const size_t offset = pageOffsets[currentPage + 1];
+  size_t nextOffset;
+  if (loadPageAtOffset(offset, prefetchedLines, nextOffset)) {
+    prefetchedOffset = offset;
+  }
 }
 
 void TxtReaderActivity::renderPage() {
@@ -453,16 +444,32 @@ void TxtReaderActivity::renderPage() {
     }
   };
 
+  // Rasterize the text once into a 2bpp capture when anti-aliasing, the BW and gray planes are derived from it.
+  // If the capture can't be allocated, fall back to rendering each grayscale pass separately below.
+  const bool grayCapture = SETTINGS.textAntiAliasing && renderer.beginGrayscaleCapture();
+
   // First pass: BW rendering
   renderLines();
+  if (grayCapture) {
+    renderer.endGrayscaleCapture();
+  }
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
 
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+  // The waveform takes hundreds of ms without needing the CPU, save progress and read ahead meanwhile (builds with
+  // DISPLAY_SYNCHRONOUS_REFRESH, the default, do this after the refresh)
+  [[maybe_unused]] const auto submitStart = millis();
+  renderer.submitBuffer(refreshScheduler.nextRefreshMode(renderer));
+  [[maybe_unused]] const auto overlapStart = millis();
+  saveProgress();
+  prefetchNextPage();
+  [[maybe_unused]] const auto overlapEnd = millis();
+  [[maybe_unused]] const uint32_t waited = renderer.waitForRefresh();
+  LOG_DBG("TRS", "Page refresh: %lums submit, %lums overlapped, %lums waiting", overlapStart - submitStart,
+          overlapEnd - overlapStart, waited);
+
+  if (grayCapture) {
+    renderer.displayGrayscaleCapture();
+    return;
   }
 
   // Grayscale rendering pass (for anti-aliased fonts)
@@ -514,16 +521,24 @@ void TxtReaderActivity::renderStatusBar(const int orientedMarginRight, const int
   const auto textY = screenHeight - orientedMarginBottom - 4;
   int progressTextWidth = 0;
 
-  const float progress = totalPages > 0 ? (currentPage + 1) * 100.0f / totalPages : 0;
+  // Until the index is complete the page count is a lower bound and progress goes by the position in the file
+  const int pages = totalPages;
+  const bool partial = indexing;
+  const size_t fileSize = txt->getFileSize();
+  float progress = pages > 0 ? (currentPage + 1) * 100.0f / pages : 0;
+  if (partial && fileSize > 0) {
+    progress = pageOffsets[currentPage] * 100.0f / fileSize;
+  }
+  const char* pagesSuffix = partial ? "+" : "";
 
   if (showProgressText || showProgressPercentage || showBookPercentage) {
     char progressStr[32];
     if (showProgressPercentage) {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d %.0f%%", currentPage + 1, totalPages, progress);
+      snprintf(progressStr, sizeof(progressStr), "%d/%d%s %.0f%%", currentPage + 1, pages, pagesSuffix, progress);
     } else if (showBookPercentage) {
       snprintf(progressStr, sizeof(progressStr), "%.0f%%", progress);
     } else {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d", currentPage + 1, totalPages);
+      snprintf(progressStr, sizeof(progressStr), "%d/%d%s", currentPage + 1, pages, pagesSuffix);
     }
 
     progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progressStr);
@@ -563,7 +578,7 @@ void TxtReaderActivity::renderStatusBar(const int orientedMarginRight, const int
 }
 
 void TxtReaderActivity::saveProgress() const {
-  FsFile f;
+  HalFile f;
   if (Storage.openFileForWrite("TRS", txt->getCachePath() + "/progress.bin", f)) {
     uint8_t data[4];
     data[0] = currentPage & 0xFF;
@@ -576,24 +591,28 @@ void TxtReaderActivity::saveProgress() const {
 }
 
 void TxtReaderActivity::loadProgress() {
-  FsFile f;
+  HalFile f;
   if (Storage.openFileForRead("TRS", txt->getCachePath() + "/progress.bin", f)) {
     uint8_t data[4];
     if (f.read(data, 4) == 4) {
       currentPage = data[0] + (data[1] << 8);
-      if (currentPage >= totalPages) {
+      if (currentPage >= totalPages && indexing) {
+        // Not indexed yet, the index job turns to it when it gets there
+        pendingPage = currentPage;
+        currentPage = 0;
+      } else if (currentPage >= totalPages) {
         currentPage = totalPages - 1;
       }
       if (currentPage < 0) {
         currentPage = 0;
       }
-      LOG_DBG("TRS", "Loaded progress: page %d/%d", currentPage, totalPages);
+      LOG_DBG("TRS", "Loaded progress: page %d/%d", currentPage, totalPages.load());
     }
     f.close();
   }
 }
 
-bool TxtReaderActivity::loadPageIndexCache() {
+bool TxtReaderActivity::loadPageIndexCache(bool& complete) {
   // Cache file format (using serialization module):
   // - uint32_t: magic "TXTI"
   // - uint8_t: cache version
@@ -603,11 +622,13 @@ bool TxtReaderActivity::loadPageIndexCache() {
   // - int32_t: font ID (to invalidate cache on font change)
   // - int32_t: screen margin (to invalidate cache on margin change)
   // - uint8_t: paragraph alignment (to invalidate cache on alignment change)
-  // - uint32_t: total pages count
+  // - uint8_t: 1 if the whole file is indexed, 0 if indexing was interrupted
+  // - uint32_t: page count so far
   // - N * uint32_t: page offsets
+  // The page offsets of each checkpoint are written before the count, so a cut off write leaves a shorter index.
 
   std::string cachePath = txt->getCachePath() + "/index.bin";
-  FsFile f;
+  HalFile f;
   if (!Storage.openFileForRead("TRS", cachePath, f)) {
     LOG_DBG("TRS", "No page index cache found");
     return false;
@@ -678,8 +699,15 @@ bool TxtReaderActivity::loadPageIndexCache() {
     return false;
   }
 
+  uint8_t completeFlag;
+  serialization::readPod(f, completeFlag);
   uint32_t numPages;
   serialization::readPod(f, numPages);
+  if (numPages == 0 || f.size() < CACHE_OFFSETS_POSITION + numPages * sizeof(uint32_t)) {
+    LOG_DBG("TRS", "Cache has no pages, rebuilding");
+    f.close();
+    return false;
+  }
 
   // Read page offsets
   pageOffsets.clear();
@@ -692,20 +720,22 @@ bool TxtReaderActivity::loadPageIndexCache() {
   }
 
   f.close();
-  totalPages = pageOffsets.size();
-  LOG_DBG("TRS", "Loaded page index cache: %d pages", totalPages);
+  complete = completeFlag != 0;
+  savedPageOffsets = pageOffsets.size();
+  totalPages = static_cast<int>(pageOffsets.size());
+  LOG_DBG("TRS", "Loaded page index cache: %d pages%s", totalPages.load(), complete ? "" : ", resuming indexing");
   return true;
 }
 
-void TxtReaderActivity::savePageIndexCache() const {
+bool TxtReaderActivity::createPageIndexCache() {
   std::string cachePath = txt->getCachePath() + "/index.bin";
-  FsFile f;
+  HalFile f;
   if (!Storage.openFileForWrite("TRS", cachePath, f)) {
     LOG_ERR("TRS", "Failed to save page index cache");
-    return;
+    return false;
   }
 
-  // Write header using serialization module
+  // Write header using serialization module, pages are added by checkpointPageIndexCache()
   serialization::writePod(f, CACHE_MAGIC);
   serialization::writePod(f, CACHE_VERSION);
   serialization::writePod(f, static_cast<uint32_t>(txt->getFileSize()));
@@ -714,13 +744,32 @@ void TxtReaderActivity::savePageIndexCache() const {
   serialization::writePod(f, static_cast<int32_t>(cachedFontId));
   serialization::writePod(f, static_cast<int32_t>(cachedScreenMargin));
   serialization::writePod(f, cachedParagraphAlignment);
-  serialization::writePod(f, static_cast<uint32_t>(pageOffsets.size()));
+  serialization::writePod(f, static_cast<uint8_t>(0));
+  serialization::writePod(f, static_cast<uint32_t>(0));
+
+  f.close();
+  return true;
+}
 
-  // Write page offsets
-  for (size_t offset : pageOffsets) {
-    serialization::writePod(f, static_cast<uint32_t>(offset));
+void TxtReaderActivity::checkpointPageIndexCache(const bool complete) {
+  std::string cachePath = txt->getCachePath() + "/index.bin";
+  HalFile f = Storage.open(cachePath.c_str(), O_RDWR);
+  if (!f) {
+    LOG_ERR("TRS", "Failed to save page index cache");
+    return;
   }
 
+  // New page offsets first, then the count and flag that make them part of the index
+  f.seek(CACHE_OFFSETS_POSITION + savedPageOffsets * sizeof(uint32_t));
+  for (size_t i = savedPageOffsets; i < pageOffsets.size(); i++) {
+    serialization::writePod(f, static_cast<uint32_t>(pageOffsets[i]));
+  }
+  f.flush();
+  f.seek(CACHE_COMPLETE_POSITION);
+  serialization::writePod(f, static_cast<uint8_t>(complete ? 1 : 0));
+  serialization::writePod(f, static_cast<uint32_t>(pageOffsets.size()));
+
   f.close();
-  LOG_DBG("TRS", "Saved page index cache: %d pages", totalPages);
+  savedPageOffsets = pageOffsets.size();
+  LOG_DBG("TRS", "Saved page index cache: %zu pages%s", savedPageOffsets, complete ? "" : " so far");
 }
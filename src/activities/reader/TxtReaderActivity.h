@@ -5,45 +5,63 @@
 #include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "CrossPointSettings.h"
+#include "ReaderRefreshScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 
 class TxtReaderActivity final : public ActivityWithSubactivity {
   std::unique_ptr<Txt> txt;
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   int currentPage = 0;
-  int totalPages = 1;
-  int pagesUntilFullRefresh = 0;
-  bool updateRequired = false;
+  // Grows while the page index is built in the background
+  std::atomic<int> totalPages{1};
+  ReaderRefreshScheduler refreshScheduler;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
   // Streaming text reader - stores file offsets for each page
-  std::vector<size_t> pageOffsets;  // File offset for start of each page
+  std::vector<size_t> pageOffsets;  // File offset for start of each page, guarded by renderingMutex
   std::vector<std::string> currentPageLines;
+  // Lines of the next page, read while the current one refreshes
+  std::vector<std::string> prefetchedLines;
+  size_t prefetchedOffset = SIZE_MAX;  // File offset of prefetchedLines, SIZE_MAX if there are none
   int linesPerPage = 0;
   int viewportWidth = 0;
   bool initialized = false;
+  // Chunk of the file being laid out, shared by rendering and indexing which both hold renderingMutex
+  std::unique_ptr<uint8_t[]> readBuffer;
+
+  // Background indexing
+  CancelToken indexToken;
+  std::atomic<bool> indexing{false};
+  size_t indexedBytes = 0;      // Where the index job has read up to, guarded by renderingMutex
+  size_t savedPageOffsets = 0;  // Page offsets already in index.bin
+  // Saved page that isn't indexed yet, shown once the index reaches it
+  std::atomic<int> pendingPage{-1};
 
   // Cached settings for cache validation (different fonts/margins require re-indexing)
   int cachedFontId = 0;
   int cachedScreenMargin = 0;
   uint8_t cachedParagraphAlignment = CrossPointSettings::LEFT_ALIGN;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void renderPage();
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
+  void prefetchNextPage();
 
   void initializeReader();
   bool loadPageAtOffset(size_t offset, std::vector<std::string>& outLines, size_t& nextOffset);
-  void buildPageIndex();
-  bool loadPageIndexCache();
-  void savePageIndexCache() const;
+  void startPageIndex();
+  void indexPages(const CancelToken& token);
+  bool loadPageIndexCache(bool& complete);
+  bool createPageIndexCache();
+  void checkpointPageIndexCache(bool complete);
   void saveProgress() const;
   void loadProgress();
 
@@ -12,20 +12,18 @@
 #include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#include "ReaderRefreshScheduler.h"
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 
 class XtcReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Xtc> xtc;
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   uint32_t currentPage = 0;
-  int pagesUntilFullRefresh = 0;
-  bool updateRequired = false;
+  ReaderRefreshScheduler refreshScheduler;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void renderPage();
   void saveProgress() const;
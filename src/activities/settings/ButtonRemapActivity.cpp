@@ -16,11 +16,6 @@ constexpr uint8_t kUnassigned = 0xFF;
 constexpr unsigned long kErrorDisplayMs = 1500;
 }  // namespace
 
-void ButtonRemapActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<ButtonRemapActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void ButtonRemapActivity::onEnter() {
   Activity::onEnter();
 
@@ -33,9 +28,9 @@ void ButtonRemapActivity::onEnter() {
   tempMapping[3] = kUnassigned;
   errorMessage.clear();
   errorUntil = 0;
-  updateRequired = true;
+  displayTask.requestUpdate();
 
-  xTaskCreate(&ButtonRemapActivity::taskTrampoline, "ButtonRemapTask", 4096, this, 1, &displayTaskHandle);
+  displayTask.start("ButtonRemapTask", renderingMutex, [this] { render(); });
 }
 
 void ButtonRemapActivity::onExit() {
@@ -43,15 +38,21 @@ void ButtonRemapActivity::onExit() {
 
   // Ensure display task is stopped outside of active rendering.
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
 
 void ButtonRemapActivity::loop() {
+  // Clear any temporary warning after its timeout.
+  if (errorUntil > 0 && millis() > errorUntil) {
+    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    errorMessage.clear();
+    errorUntil = 0;
+    xSemaphoreGive(renderingMutex);
+    displayTask.requestUpdate();
+  }
+
   // Side buttons:
   // - Up: reset mapping to defaults and exit.
   // - Down: cancel without saving.
@@ -74,7 +75,7 @@ void ButtonRemapActivity::loop() {
 
   // Wait for the UI to refresh before accepting another assignment.
   // This avoids rapid double-presses that can advance the step without a visible redraw.
-  if (updateRequired) {
+  if (displayTask.isUpdatePending()) {
     return;
   }
 
@@ -87,7 +88,7 @@ void ButtonRemapActivity::loop() {
   // Update temporary mapping and advance the remap step.
   // Only accept the press if this hardware button isn't already assigned elsewhere.
   if (!validateUnassigned(static_cast<uint8_t>(pressedButton))) {
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
   tempMapping[currentStep] = static_cast<uint8_t>(pressedButton);
@@ -101,28 +102,7 @@ void ButtonRemapActivity::loop() {
     return;
   }
 
-  updateRequired = true;
-}
-
-[[noreturn]] void ButtonRemapActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      // Ensure render calls are serialized with UI thread changes.
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      updateRequired = false;
-      xSemaphoreGive(renderingMutex);
-    }
-
-    // Clear any temporary warning after its timeout.
-    if (errorUntil > 0 && millis() > errorUntil) {
-      errorMessage.clear();
-      errorUntil = 0;
-      updateRequired = true;
-    }
-
-    vTaskDelay(50 / portTICK_PERIOD_MS);
-  }
+  displayTask.requestUpdate();
 }
 
 void ButtonRemapActivity::render() {
@@ -174,7 +154,7 @@ void ButtonRemapActivity::render() {
                       labelForHardware(CrossPointSettings::FRONT_HW_CONFIRM),
                       labelForHardware(CrossPointSettings::FRONT_HW_LEFT),
                       labelForHardware(CrossPointSettings::FRONT_HW_RIGHT));
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
 
 void ButtonRemapActivity::applyTempMapping() {
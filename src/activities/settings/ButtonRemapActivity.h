@@ -7,6 +7,7 @@
 #include <string>
 
 #include "activities/Activity.h"
+#include "activities/DisplayTask.h"
 
 class ButtonRemapActivity final : public Activity {
  public:
@@ -20,9 +21,8 @@ class ButtonRemapActivity final : public Activity {
 
  private:
   // Rendering task state.
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  DisplayTask displayTask;
 
   // Callback used to exit the remap flow back to the settings list.
   const std::function<void()> onBack;
@@ -35,8 +35,6 @@ class ButtonRemapActivity final : public Activity {
   std::string errorMessage;
 
   // FreeRTOS task helpers.
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
 
   // Commit temporary mapping to settings.
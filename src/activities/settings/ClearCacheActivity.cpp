@@ -8,24 +8,14 @@
 #include "components/UITheme.h"
 #include "fontIds.h"
 
-void ClearCacheActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<ClearCacheActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void ClearCacheActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
   renderingMutex = xSemaphoreCreateMutex();
   state = WARNING;
-  updateRequired = true;
-
-  xTaskCreate(&ClearCacheActivity::taskTrampoline, "ClearCacheActivityTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.requestUpdate();
+
+  displayTask.start("ClearCacheActivityTask", renderingMutex, [this] { render(); });
 }
 
 void ClearCacheActivity::onExit() {
@@ -33,26 +23,11 @@ void ClearCacheActivity::onExit() {
 
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
 
-void ClearCacheActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void ClearCacheActivity::render() {
   const auto pageHeight = renderer.getScreenHeight();
 
@@ -112,7 +87,7 @@ void ClearCacheActivity::clearCache() {
     LOG_DBG("CLEAR_CACHE", "Failed to open cache directory");
     if (root) root.close();
     state = FAILED;
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -147,7 +122,7 @@ void ClearCacheActivity::clearCache() {
   LOG_DBG("CLEAR_CACHE", "Cache cleared: %d removed, %d failed", clearedCount, failedCount);
 
   state = SUCCESS;
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void ClearCacheActivity::loop() {
@@ -157,7 +132,7 @@ void ClearCacheActivity::loop() {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       state = CLEARING;
       xSemaphoreGive(renderingMutex);
-      updateRequired = true;
+      displayTask.requestUpdate();
       vTaskDelay(10 / portTICK_PERIOD_MS);
 
       clearCache();
@@ -7,6 +7,7 @@
 #include <functional>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 
 class ClearCacheActivity final : public ActivityWithSubactivity {
  public:
@@ -22,16 +23,12 @@ class ClearCacheActivity final : public ActivityWithSubactivity {
   enum State { WARNING, CLEARING, SUCCESS, FAILED };
 
   State state = WARNING;
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  DisplayTask displayTask;
   const std::function<void()> goBack;
 
   int clearedCount = 0;
   int failedCount = 0;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
   void clearCache();
 };
@@ -6,15 +6,11 @@
 #include "KOReaderCredentialStore.h"
 #include "KOReaderSyncClient.h"
 #include "MappedInputManager.h"
+#include "WorkerService.h"
 #include "activities/network/WifiSelectionActivity.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 
-void KOReaderAuthActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KOReaderAuthActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void KOReaderAuthActivity::onWifiSelectionComplete(const bool success) {
   exitActivity();
 
@@ -23,7 +19,7 @@ void KOReaderAuthActivity::onWifiSelectionComplete(const bool success) {
     state = FAILED;
     errorMessage = "WiFi connection failed";
     xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -31,13 +27,17 @@ void KOReaderAuthActivity::onWifiSelectionComplete(const bool success) {
   state = AUTHENTICATING;
   statusMessage = "Authenticating...";
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
 
-  performAuthentication();
+  performAuthentication(authToken);
 }
 
-void KOReaderAuthActivity::performAuthentication() {
+void KOReaderAuthActivity::performAuthentication(const CancelToken& token) {
   const auto result = KOReaderSyncClient::authenticate();
+  // The request fails fast once onExit() has turned WiFi off, don't report that
+  if (token.isCancelled()) {
+    return;
+  }
 
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   if (result == KOReaderSyncClient::OK) {
@@ -48,7 +48,7 @@ void KOReaderAuthActivity::performAuthentication() {
     errorMessage = KOReaderSyncClient::errorString(result);
   }
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void KOReaderAuthActivity::onEnter() {
@@ -56,12 +56,7 @@ void KOReaderAuthActivity::onEnter() {
 
   renderingMutex = xSemaphoreCreateMutex();
 
-  xTaskCreate(&KOReaderAuthActivity::taskTrampoline, "KOAuthTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.start("KOAuthTask", renderingMutex, [this] { render(); }, [this] { return !subActivity; });
 
   // Turn on WiFi
   WiFi.mode(WIFI_STA);
@@ -70,16 +65,12 @@ void KOReaderAuthActivity::onEnter() {
   if (WiFi.status() == WL_CONNECTED) {
     state = AUTHENTICATING;
     statusMessage = "Authenticating...";
-    updateRequired = true;
-
-    // Perform authentication in a separate task
-    xTaskCreate(
-        [](void* param) {
-          auto* self = static_cast<KOReaderAuthActivity*>(param);
-          self->performAuthentication();
-          vTaskDelete(nullptr);
-        },
-        "AuthTask", 4096, this, 1, nullptr);
+    displayTask.requestUpdate();
+
+    // Perform authentication in the background
+    authToken = CancelToken();
+    WORKER.submit(WorkerService::Priority::Background, this, authToken,
+                  [this](const CancelToken& token) { performAuthentication(token); });
     return;
   }
 
@@ -97,27 +88,16 @@ void KOReaderAuthActivity::onExit() {
   WiFi.mode(WIFI_OFF);
   delay(100);
 
+  // An authentication still running fails fast without WiFi and then sees the cancelled token
+  authToken.cancel();
+  WORKER.cancel(this);
+
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
 
-void KOReaderAuthActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void KOReaderAuthActivity::render() {
   if (subActivity) {
     return;
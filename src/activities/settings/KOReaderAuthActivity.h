@@ -6,6 +6,7 @@
 #include <functional>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 
 /**
  * Activity for testing KOReader credentials.
@@ -24,10 +25,10 @@ class KOReaderAuthActivity final : public ActivityWithSubactivity {
 
  private:
   enum State { WIFI_SELECTION, CONNECTING, AUTHENTICATING, SUCCESS, FAILED };
-
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  DisplayTask displayTask;
+  // Cancels the background authentication when the activity exits
+  CancelToken authToken;
 
   State state = WIFI_SELECTION;
   std::string statusMessage;
@@ -36,9 +37,6 @@ class KOReaderAuthActivity final : public ActivityWithSubactivity {
   const std::function<void()> onComplete;
 
   void onWifiSelectionComplete(bool success);
-  void performAuthentication();
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
+  void performAuthentication(const CancelToken& token);
   void render();
 };
@@ -16,34 +16,21 @@ constexpr int MENU_ITEMS = 5;
 const char* menuNames[MENU_ITEMS] = {"Username", "Password", "Sync Server URL", "Document Matching", "Authenticate"};
 }  // namespace
 
-void KOReaderSettingsActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KOReaderSettingsActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void KOReaderSettingsActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
   renderingMutex = xSemaphoreCreateMutex();
   selectedIndex = 0;
-  updateRequired = true;
-
-  xTaskCreate(&KOReaderSettingsActivity::taskTrampoline, "KOReaderSettingsTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.requestUpdate();
+
+  displayTask.start("KOReaderSettingsTask", renderingMutex, [this] { render(); }, [this] { return !subActivity; });
 }
 
 void KOReaderSettingsActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
@@ -67,12 +54,12 @@ void KOReaderSettingsActivity::loop() {
   // Handle navigation
   buttonNavigator.onNext([this] {
     selectedIndex = (selectedIndex + 1) % MENU_ITEMS;
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPrevious([this] {
     selectedIndex = (selectedIndex + MENU_ITEMS - 1) % MENU_ITEMS;
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 }
 
@@ -90,11 +77,11 @@ void KOReaderSettingsActivity::handleSelection() {
           KOREADER_STORE.setCredentials(username, KOREADER_STORE.getPassword());
           KOREADER_STORE.saveToFile();
           exitActivity();
-          updateRequired = true;
+          displayTask.requestUpdate();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          displayTask.requestUpdate();
         }));
   } else if (selectedIndex == 1) {
     // Password
@@ -107,11 +94,11 @@ void KOReaderSettingsActivity::handleSelection() {
           KOREADER_STORE.setCredentials(KOREADER_STORE.getUsername(), password);
           KOREADER_STORE.saveToFile();
           exitActivity();
-          updateRequired = true;
+          displayTask.requestUpdate();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          displayTask.requestUpdate();
         }));
   } else if (selectedIndex == 2) {
     // Sync Server URL - prefill with https:// if empty to save typing
@@ -128,11 +115,11 @@ void KOReaderSettingsActivity::handleSelection() {
           KOREADER_STORE.setServerUrl(urlToSave);
           KOREADER_STORE.saveToFile();
           exitActivity();
-          updateRequired = true;
+          displayTask.requestUpdate();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          displayTask.requestUpdate();
         }));
   } else if (selectedIndex == 3) {
     // Document Matching - toggle between Filename and Binary
@@ -141,7 +128,7 @@ void KOReaderSettingsActivity::handleSelection() {
         (current == DocumentMatchMethod::FILENAME) ? DocumentMatchMethod::BINARY : DocumentMatchMethod::FILENAME;
     KOREADER_STORE.setMatchMethod(newMethod);
     KOREADER_STORE.saveToFile();
-    updateRequired = true;
+    displayTask.requestUpdate();
   } else if (selectedIndex == 4) {
     // Authenticate
     if (!KOREADER_STORE.hasCredentials()) {
@@ -152,25 +139,13 @@ void KOReaderSettingsActivity::handleSelection() {
     exitActivity();
     enterNewActivity(new KOReaderAuthActivity(renderer, mappedInput, [this] {
       exitActivity();
-      updateRequired = true;
+      displayTask.requestUpdate();
     }));
   }
 
   xSemaphoreGive(renderingMutex);
 }
 
-void KOReaderSettingsActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void KOReaderSettingsActivity::render() {
   renderer.clearScreen();
 
@@ -211,5 +186,5 @@ void KOReaderSettingsActivity::render() {
   const auto labels = mappedInput.mapLabels("« Back", "Select", "", "");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
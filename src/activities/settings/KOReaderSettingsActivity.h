@@ -6,6 +6,7 @@
 #include <functional>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 #include "util/ButtonNavigator.h"
 
 /**
@@ -23,16 +24,12 @@ class KOReaderSettingsActivity final : public ActivityWithSubactivity {
   void loop() override;
 
  private:
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
-  bool updateRequired = false;
 
   int selectedIndex = 0;
   const std::function<void()> onBack;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
   void handleSelection();
 };
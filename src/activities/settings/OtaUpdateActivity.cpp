@@ -9,11 +9,6 @@
 #include "fontIds.h"
 #include "network/OtaUpdater.h"
 
-void OtaUpdateActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<OtaUpdateActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void OtaUpdateActivity::onWifiSelectionComplete(const bool success) {
   exitActivity();
 
@@ -28,7 +23,7 @@ void OtaUpdateActivity::onWifiSelectionComplete(const bool success) {
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   state = CHECKING_FOR_UPDATE;
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
   vTaskDelay(10 / portTICK_PERIOD_MS);
   const auto res = updater.checkForUpdate();
   if (res != OtaUpdater::OK) {
@@ -36,7 +31,7 @@ void OtaUpdateActivity::onWifiSelectionComplete(const bool success) {
     xSemaphoreTake(renderingMutex, portMAX_DELAY);
     state = FAILED;
     xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
@@ -45,14 +40,14 @@ void OtaUpdateActivity::onWifiSelectionComplete(const bool success) {
     xSemaphoreTake(renderingMutex, portMAX_DELAY);
     state = NO_UPDATE;
     xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    displayTask.requestUpdate();
     return;
   }
 
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   state = WAITING_CONFIRMATION;
   xSemaphoreGive(renderingMutex);
-  updateRequired = true;
+  displayTask.requestUpdate();
 }
 
 void OtaUpdateActivity::onEnter() {
@@ -60,12 +55,7 @@ void OtaUpdateActivity::onEnter() {
 
   renderingMutex = xSemaphoreCreateMutex();
 
-  xTaskCreate(&OtaUpdateActivity::taskTrampoline, "OtaUpdateActivityTask",
-              2048,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.start("OtaUpdateActivityTask", renderingMutex, [this] { render(); });
 
   // Turn on WiFi immediately
   LOG_DBG("OTA", "Turning on WiFi...");
@@ -88,26 +78,11 @@ void OtaUpdateActivity::onExit() {
 
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
 
-void OtaUpdateActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired || updater.getRender()) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void OtaUpdateActivity::render() {
   if (subActivity) {
     // Subactivity handles its own rendering
@@ -193,23 +168,23 @@ void OtaUpdateActivity::loop() {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       state = UPDATE_IN_PROGRESS;
       xSemaphoreGive(renderingMutex);
-      updateRequired = true;
+      displayTask.requestUpdate();
       vTaskDelay(10 / portTICK_PERIOD_MS);
-      const auto res = updater.installUpdate();
+      const auto res = updater.installUpdate([this] { displayTask.requestUpdate(); });
 
       if (res != OtaUpdater::OK) {
         LOG_DBG("OTA", "Update failed: %d", res);
         xSemaphoreTake(renderingMutex, portMAX_DELAY);
         state = FAILED;
         xSemaphoreGive(renderingMutex);
-        updateRequired = true;
+        displayTask.requestUpdate();
         return;
       }
 
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       state = FINISHED;
       xSemaphoreGive(renderingMutex);
-      updateRequired = true;
+      displayTask.requestUpdate();
     }
 
     if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
@@ -4,6 +4,7 @@
 #include <freertos/task.h>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 #include "network/OtaUpdater.h"
 
 class OtaUpdateActivity : public ActivityWithSubactivity {
@@ -20,18 +21,14 @@ class OtaUpdateActivity : public ActivityWithSubactivity {
 
   // Can't initialize this to 0 or the first render doesn't happen
   static constexpr unsigned int UNINITIALIZED_PERCENTAGE = 111;
-
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  DisplayTask displayTask;
   const std::function<void()> goBack;
   State state = WIFI_SELECTION;
   unsigned int lastUpdaterPercentage = UNINITIALIZED_PERCENTAGE;
   OtaUpdater updater;
 
   void onWifiSelectionComplete(bool success);
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
 
  public:
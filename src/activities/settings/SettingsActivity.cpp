@@ -17,11 +17,6 @@
 
 const char* SettingsActivity::categoryNames[categoryCount] = {"Display", "Reader", "Controls", "System"};
 
-void SettingsActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<SettingsActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void SettingsActivity::onEnter() {
   Activity::onEnter();
   renderingMutex = xSemaphoreCreateMutex();
@@ -64,14 +59,9 @@ void SettingsActivity::onEnter() {
   settingsCount = static_cast<int>(displaySettings.size());
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&SettingsActivity::taskTrampoline, "SettingsActivityTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.requestUpdate();
+
+  displayTask.start("SettingsActivityTask", renderingMutex, [this] { render(); }, [this] { return !subActivity; });
 }
 
 void SettingsActivity::onExit() {
@@ -79,10 +69,7 @@ void SettingsActivity::onExit() {
 
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 
@@ -101,10 +88,10 @@ void SettingsActivity::loop() {
     if (selectedSettingIndex == 0) {
       selectedCategoryIndex = (selectedCategoryIndex < categoryCount - 1) ? (selectedCategoryIndex + 1) : 0;
       hasChangedCategory = true;
-      updateRequired = true;
+      displayTask.requestUpdate();
     } else {
       toggleCurrentSetting();
-      updateRequired = true;
+      displayTask.requestUpdate();
       return;
     }
   }
@@ -118,24 +105,24 @@ void SettingsActivity::loop() {
   // Handle navigation
   buttonNavigator.onNextRelease([this] {
     selectedSettingIndex = ButtonNavigator::nextIndex(selectedSettingIndex, settingsCount + 1);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPreviousRelease([this] {
     selectedSettingIndex = ButtonNavigator::previousIndex(selectedSettingIndex, settingsCount + 1);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onNextContinuous([this, &hasChangedCategory] {
     hasChangedCategory = true;
     selectedCategoryIndex = ButtonNavigator::nextIndex(selectedCategoryIndex, categoryCount);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPreviousContinuous([this, &hasChangedCategory] {
     hasChangedCategory = true;
     selectedCategoryIndex = ButtonNavigator::previousIndex(selectedCategoryIndex, categoryCount);
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   if (hasChangedCategory) {
@@ -190,12 +177,12 @@ void SettingsActivity::toggleCurrentSetting() {
 
     auto onComplete = [this] {
       exitActivity();
-      updateRequired = true;
+      displayTask.requestUpdate();
     };
 
     auto onCompleteBool = [this](bool) {
       exitActivity();
-      updateRequired = true;
+      displayTask.requestUpdate();
     };
 
     switch (setting.action) {
@@ -228,18 +215,6 @@ void SettingsActivity::toggleCurrentSetting() {
   SETTINGS.saveToFile();
 }
 
-void SettingsActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void SettingsActivity::render() const {
   renderer.clearScreen();
 
@@ -289,6 +264,6 @@ void SettingsActivity::render() const {
   const auto labels = mappedInput.mapLabels("« Back", "Toggle", "Up", "Down");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  // Always use standard refresh for settings screen
-  renderer.displayBuffer();
+  // Only the changed part of the screen (e.g. the moved selection) is refreshed
+  renderer.displayChanges();
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/DisplayTask.h"
 #include "util/ButtonNavigator.h"
 
 class CrossPointSettings;
@@ -135,10 +136,9 @@ struct SettingInfo {
 };
 
 class SettingsActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
-  bool updateRequired = false;
   int selectedCategoryIndex = 0;  // Currently selected category
   int selectedSettingIndex = 0;
   int settingsCount = 0;
@@ -154,9 +154,6 @@ class SettingsActivity final : public ActivityWithSubactivity {
 
   static constexpr int categoryCount = 4;
   static const char* categoryNames[categoryCount];
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   void enterCategory(int categoryIndex);
   void toggleCurrentSetting();
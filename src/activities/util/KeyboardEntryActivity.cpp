@@ -17,37 +17,15 @@ const char* const KeyboardEntryActivity::keyboardShift[NUM_ROWS] = {"~!@#$%^&*()
 // Shift state strings
 const char* const KeyboardEntryActivity::shiftString[3] = {"shift", "SHIFT", "LOCK"};
 
-void KeyboardEntryActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KeyboardEntryActivity*>(param);
-  self->displayTaskLoop();
-}
-
-void KeyboardEntryActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void KeyboardEntryActivity::onEnter() {
   Activity::onEnter();
 
   renderingMutex = xSemaphoreCreateMutex();
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&KeyboardEntryActivity::taskTrampoline, "KeyboardEntryActivity",
-              2048,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  displayTask.requestUpdate();
+
+  displayTask.start("KeyboardEntryActivity", renderingMutex, [this] { render(); });
 }
 
 void KeyboardEntryActivity::onExit() {
@@ -55,10 +33,7 @@ void KeyboardEntryActivity::onExit() {
 
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
+  displayTask.stop();
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
 }
@@ -148,7 +123,7 @@ void KeyboardEntryActivity::loop() {
 
     const int maxCol = getRowLength(selectedRow) - 1;
     if (selectedCol > maxCol) selectedCol = maxCol;
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPressAndContinuous({MappedInputManager::Button::Down}, [this] {
@@ -156,7 +131,7 @@ void KeyboardEntryActivity::loop() {
 
     const int maxCol = getRowLength(selectedRow) - 1;
     if (selectedCol > maxCol) selectedCol = maxCol;
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPressAndContinuous({MappedInputManager::Button::Left}, [this] {
@@ -182,7 +157,7 @@ void KeyboardEntryActivity::loop() {
       selectedCol = ButtonNavigator::previousIndex(selectedCol, maxCol + 1);
     }
 
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   buttonNavigator.onPressAndContinuous({MappedInputManager::Button::Right}, [this] {
@@ -207,13 +182,13 @@ void KeyboardEntryActivity::loop() {
     } else {
       selectedCol = ButtonNavigator::nextIndex(selectedCol, maxCol + 1);
     }
-    updateRequired = true;
+    displayTask.requestUpdate();
   });
 
   // Selection
   if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
     handleKeyPress();
-    updateRequired = true;
+    displayTask.requestUpdate();
   }
 
   // Cancel
@@ -221,7 +196,7 @@ void KeyboardEntryActivity::loop() {
     if (onCancel) {
       onCancel();
     }
-    updateRequired = true;
+    displayTask.requestUpdate();
   }
 }
 
@@ -337,7 +312,7 @@ void KeyboardEntryActivity::render() const {
   // Draw side button hints for Up/Down navigation
   GUI.drawSideButtonHints(renderer, "Up", "Down");
 
-  renderer.displayBuffer();
+  renderer.displayChanges();
 }
 
 void KeyboardEntryActivity::renderItemWithSelector(const int x, const int y, const char* item,
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "../Activity.h"
+#include "../DisplayTask.h"
 #include "util/ButtonNavigator.h"
 
 /**
@@ -64,10 +65,9 @@ class KeyboardEntryActivity : public Activity {
   std::string text;
   size_t maxLength;
   bool isPassword;
-  TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  DisplayTask displayTask;
   ButtonNavigator buttonNavigator;
-  bool updateRequired = false;
 
   // Keyboard state
   int selectedRow = 0;
@@ -91,9 +91,6 @@ class KeyboardEntryActivity : public Activity {
   static constexpr int SPACE_COL = 2;
   static constexpr int BACKSPACE_COL = 7;
   static constexpr int DONE_COL = 9;
-
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   char getSelectedChar() const;
   void handleKeyPress();
   int getRowLength(int row) const;
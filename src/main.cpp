@@ -4,8 +4,10 @@
 #include <HalDisplay.h>
 #include <HalGPIO.h>
 #include <HalStorage.h>
+#include <HeapAccounting.h>
 #include <Logging.h>
 #include <SPI.h>
+#include <Trace.h>
 #include <builtinFonts/all.h>
 
 #include <cstring>
@@ -16,6 +18,7 @@
 #include "KOReaderCredentialStore.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
+#include "WorkerService.h"
 #include "activities/boot_sleep/BootActivity.h"
 #include "activities/boot_sleep/SleepActivity.h"
 #include "activities/browser/OpdsBookBrowserActivity.h"
@@ -129,7 +132,11 @@ EpdFontFamily ui12FontFamily(&ui12RegularFont, &ui12BoldFont);
 unsigned long t1 = 0;
 unsigned long t2 = 0;
 
+// Start of the current activity switch, for logging how long it takes
+unsigned long activitySwitchStart = 0;
+
 void exitActivity() {
+  activitySwitchStart = millis();
   if (currentActivity) {
     currentActivity->onExit();
     delete currentActivity;
@@ -140,6 +147,8 @@ void exitActivity() {
 void enterNewActivity(Activity* activity) {
   currentActivity = activity;
   currentActivity->onEnter();
+  LOG_DBG("MAIN", "Activity switch took %lums, free heap %lu bytes", millis() - activitySwitchStart,
+          static_cast<uint32_t>(ESP.getFreeHeap()));
 }
 
 // Verify power button press duration on wake-up from deep sleep
@@ -256,6 +265,7 @@ void onGoHome() {
 void setupDisplayAndFonts() {
   display.begin();
   renderer.begin();
+  WORKER.begin();
   LOG_DBG("MAIN", "Display initialized");
   renderer.insertFont(BOOKERLY_14_FONT_ID, bookerly14FontFamily);
 #ifndef OMIT_FONTS
@@ -365,8 +375,17 @@ void loop() {
   renderer.setFadingFix(SETTINGS.fadingFix);
 
   if (Serial && millis() - lastMemPrint >= 10000) {
-    LOG_INF("MEM", "Free: %d bytes, Total: %d bytes, Min Free: %d bytes", ESP.getFreeHeap(), ESP.getHeapSize(),
-            ESP.getMinFreeHeap());
+    const auto heap = HeapAccounting::summary();
+    LOG_INF("MEM", "Free: %lu bytes, Total: %lu bytes, Min Free: %lu bytes, Largest: %lu bytes, Fragmentation: %u%%",
+            static_cast<unsigned long>(heap.freeBytes), static_cast<unsigned long>(heap.totalBytes),
+            static_cast<unsigned long>(heap.minFreeBytes), static_cast<unsigned long>(heap.largestFreeBlock),
+            heap.fragmentationPercent);
+    const auto glyphStats = renderer.getGlyphCacheStats();
+    LOG_INF("GLC", "Glyph cache: %lu hits, %lu misses, %lu evictions, %lu rejected, %lu entries, %zu/%zu bytes",
+            static_cast<unsigned long>(glyphStats.hits), static_cast<unsigned long>(glyphStats.misses),
+            static_cast<unsigned long>(glyphStats.evictions), static_cast<unsigned long>(glyphStats.rejected),
+            static_cast<unsigned long>(glyphStats.entries), glyphStats.bytesUsed, glyphStats.budgetBytes);
+    WORKER.logStats();
     lastMemPrint = millis();
   }
 
@@ -382,6 +401,16 @@ void loop() {
         uint8_t* buf = display.getFrameBuffer();
         logSerial.write(buf, HalDisplay::BUFFER_SIZE);
         logSerial.printf("SCREENSHOT_END\n");
+      } else if (cmd == "TRACE") {
+        Trace::dump(logSerial);
+      } else if (cmd == "TRACE_CLEAR") {
+        Trace::clear();
+      } else if (cmd == "HEAP") {
+        HeapAccounting::printReport(logSerial);
+      } else if (cmd == "STORAGE") {
+        Storage.printStats(logSerial);
+      } else if (cmd == "STORAGE_CLEAR") {
+        Storage.resetStats();
       }
     }
   }
@@ -4,6 +4,7 @@
 #include <Epub.h>
 #include <FsHelpers.h>
 #include <HalStorage.h>
+#include <HeapAccounting.h>
 #include <Logging.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
@@ -29,7 +30,7 @@ constexpr uint16_t LOCAL_UDP_PORT = 8134;
 CrossPointWebServer* wsInstance = nullptr;
 
 // WebSocket upload state
-FsFile wsUploadFile;
+HalFile wsUploadFile;
 String wsUploadFileName;
 String wsUploadPath;
 size_t wsUploadSize = 0;
@@ -133,6 +134,7 @@ void CrossPointWebServer::begin() {
   server->on("/files", HTTP_GET, [this] { handleFileList(); });
 
   server->on("/api/status", HTTP_GET, [this] { handleStatus(); });
+  server->on("/api/heap", HTTP_GET, [this] { handleHeap(); });
   server->on("/api/files", HTTP_GET, [this] { handleFileListData(); });
   server->on("/download", HTTP_GET, [this] { handleDownload(); });
 
@@ -251,6 +253,7 @@ void CrossPointWebServer::handleClient() {
     lastDebugPrint = millis();
   }
 
+  HEAP_SCOPE(HeapTag::Network);
   server->handleClient();
 
   // Handle WebSocket events
@@ -321,13 +324,54 @@ void CrossPointWebServer::handleStatus() const {
   doc["freeHeap"] = ESP.getFreeHeap();
   doc["uptime"] = millis() / 1000;
 
+  const JsonArray storage = doc["storage"].to<JsonArray>();
+  for (const auto& module : Storage.stats()) {
+    const JsonObject entry = storage.add<JsonObject>();
+    entry["module"] = module.module;
+    entry["opens"] = module.opens;
+    entry["reads"] = module.reads;
+    entry["writes"] = module.writes;
+    entry["seeks"] = module.seeks;
+    entry["bytesRead"] = module.bytesRead;
+    entry["bytesWritten"] = module.bytesWritten;
+    entry["busyMs"] = module.busyUs / 1000;
+  }
+
+  String json;
+  serializeJson(doc, json);
+  server->send(200, "application/json", json);
+}
+
+void CrossPointWebServer::handleHeap() const {
+  const auto heap = HeapAccounting::summary();
+
+  JsonDocument doc;
+  doc["total"] = heap.totalBytes;
+  doc["free"] = heap.freeBytes;
+  doc["minFree"] = heap.minFreeBytes;
+  doc["largestFreeBlock"] = heap.largestFreeBlock;
+  doc["fragmentation"] = heap.fragmentationPercent;
+#ifdef HEAP_ACCOUNTING
+  const JsonObject tags = doc["tags"].to<JsonObject>();
+  for (size_t i = 0; i < static_cast<size_t>(HeapTag::COUNT); i++) {
+    const auto tag = static_cast<HeapTag>(i);
+    const auto stats = HeapAccounting::tagStats(tag);
+    const JsonObject entry = tags[HeapAccounting::tagName(tag)].to<JsonObject>();
+    entry["allocations"] = stats.allocations;
+    entry["allocatedBytes"] = stats.allocatedBytes;
+    entry["scopes"] = stats.scopes;
+    entry["lastPeak"] = stats.lastPeakBytes;
+    entry["maxPeak"] = stats.maxPeakBytes;
+  }
+#endif
+
   String json;
   serializeJson(doc, json);
   server->send(200, "application/json", json);
 }
 
 void CrossPointWebServer::scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const {
-  FsFile root = Storage.open(path);
+  HalFile root = Storage.open(path);
   if (!root) {
     LOG_DBG("WEB", "Failed to open directory: %s", path);
     return;
@@ -341,7 +385,7 @@ void CrossPointWebServer::scanFiles(const char* path, const std::function<void(F
 
   LOG_DBG("WEB", "Scanning files in: %s", path);
 
-  FsFile file = root.openNextFile();
+  HalFile file = root.openNextFile();
   char name[500];
   while (file) {
     file.getName(name, sizeof(name));
@@ -476,7 +520,7 @@ void CrossPointWebServer::handleDownload() const {
     return;
   }
 
-  FsFile file = Storage.open(itemPath.c_str());
+  HalFile file = Storage.open(itemPath.c_str());
   if (!file) {
     server->send(500, "text/plain", "Failed to open file");
     return;
@@ -780,7 +824,7 @@ void CrossPointWebServer::handleRename() const {
     return;
   }
 
-  FsFile file = Storage.open(itemPath.c_str());
+  HalFile file = Storage.open(itemPath.c_str());
   if (!file) {
     server->send(500, "text/plain", "Failed to open file");
     return;
@@ -856,7 +900,7 @@ void CrossPointWebServer::handleMove() const {
     return;
   }
 
-  FsFile file = Storage.open(itemPath.c_str());
+  HalFile file = Storage.open(itemPath.c_str());
   if (!file) {
     server->send(500, "text/plain", "Failed to open file");
     return;
@@ -872,7 +916,7 @@ void CrossPointWebServer::handleMove() const {
     server->send(404, "text/plain", "Destination not found");
     return;
   }
-  FsFile destDir = Storage.open(destPath.c_str());
+  HalFile destDir = Storage.open(destPath.c_str());
   if (!destDir || !destDir.isDirectory()) {
     if (destDir) {
       destDir.close();
@@ -966,10 +1010,10 @@ void CrossPointWebServer::handleDelete() const {
 
   if (itemType == "folder") {
     // For folders, try to remove (will fail if not empty)
-    FsFile dir = Storage.open(itemPath.c_str());
+    HalFile dir = Storage.open(itemPath.c_str());
     if (dir && dir.isDirectory()) {
       // Check if folder is empty
-      FsFile entry = dir.openNextFile();
+      HalFile entry = dir.openNextFile();
       if (entry) {
         // Folder is not empty
         entry.close();
@@ -105,7 +105,7 @@ HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string&
   }
 
   // Open file for writing
-  FsFile file;
+  HalFile file;
   if (!Storage.openFileForWrite("HTTP", destPath.c_str(), file)) {
     LOG_ERR("HTTP", "Failed to open file for writing");
     http.end();
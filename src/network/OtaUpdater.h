@@ -10,7 +10,6 @@ class OtaUpdater {
   size_t otaSize = 0;
   size_t processedSize = 0;
   size_t totalSize = 0;
-  bool render = false;
 
  public:
   enum OtaUpdaterError {
@@ -29,11 +28,10 @@ class OtaUpdater {
 
   size_t getTotalSize() const { return totalSize; }
 
-  bool getRender() const { return render; }
-
   OtaUpdater() = default;
   bool isUpdateNewer() const;
   const std::string& getLatestVersion() const;
   OtaUpdaterError checkForUpdate();
-  OtaUpdaterError installUpdate();
+  // onProgress is called after each downloaded chunk
+  OtaUpdaterError installUpdate(const std::function<void()>& onProgress = nullptr);
 };
@@ -0,0 +1,90 @@
+#include <EpdFontFamily.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "lib/EpdFont/builtinFonts/bookerly_14_regular.h"
+#include "lib/EpdFont/builtinFonts/ubuntu_10_regular.h"
+#include "lib/GfxRenderer/FontRegistry.h"
+#include "src/fontIds.h"
+
+// Measures the per-call cost of resolving a font id the way GfxRenderer text calls do: the old std::map pattern
+// (count + at) against the FontRegistry slot table, alone and followed by a text measurement as in getTextWidth.
+
+namespace {
+
+const int kFontIds[] = {BOOKERLY_12_FONT_ID,     BOOKERLY_14_FONT_ID,     BOOKERLY_16_FONT_ID,  BOOKERLY_18_FONT_ID,
+                        NOTOSANS_12_FONT_ID,     NOTOSANS_14_FONT_ID,     NOTOSANS_16_FONT_ID,  NOTOSANS_18_FONT_ID,
+                        OPENDYSLEXIC_8_FONT_ID,  OPENDYSLEXIC_10_FONT_ID, OPENDYSLEXIC_12_FONT_ID,
+                        OPENDYSLEXIC_14_FONT_ID, UI_10_FONT_ID,           UI_12_FONT_ID,        SMALL_FONT_ID};
+
+const char* kWords[] = {"The", "quick", "brown", "fox", "jumps", "over", "the", "lazy", "dog", "pagination"};
+
+template <typename Fn>
+double nanosPerCall(const int iterations, Fn&& fn) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    fn(i);
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int iterations = argc > 1 ? std::stoi(argv[1]) : 2000000;
+
+  const EpdFont bookerly(&bookerly_14_regular);
+  const EpdFont ui(&ubuntu_10_regular);
+  const EpdFontFamily bookerlyFamily(&bookerly);
+  const EpdFontFamily uiFamily(&ui);
+
+  std::map<int, EpdFontFamily> fontMap;
+  FontRegistry registry;
+  for (const int id : kFontIds) {
+    const EpdFontFamily& family = (id == UI_10_FONT_ID || id == UI_12_FONT_ID) ? uiFamily : bookerlyFamily;
+    fontMap.insert({id, family});
+    registry.insert(id, family);
+  }
+
+  constexpr int numIds = sizeof(kFontIds) / sizeof(kFontIds[0]);
+  constexpr int numWords = sizeof(kWords) / sizeof(kWords[0]);
+  // Pagination measures every word in the reader font, so mostly repeat the same id
+  const int readerId = BOOKERLY_14_FONT_ID;
+  volatile intptr_t sink = 0;
+
+  const double mapLookup = nanosPerCall(iterations, [&](const int i) {
+    const int id = (i & 7) ? readerId : kFontIds[i % numIds];
+    if (fontMap.count(id) != 0) sink = sink + reinterpret_cast<intptr_t>(&fontMap.at(id));
+  });
+  const double registryLookup = nanosPerCall(iterations, [&](const int i) {
+    const int id = (i & 7) ? readerId : kFontIds[i % numIds];
+    sink = sink + reinterpret_cast<intptr_t>(registry.find(id));
+  });
+
+  const double mapTextWidth = nanosPerCall(iterations / 10, [&](const int i) {
+    if (fontMap.count(readerId) == 0) return;
+    int w = 0, h = 0;
+    fontMap.at(readerId).getTextDimensions(kWords[i % numWords], &w, &h);
+    sink = sink + w;
+  });
+  const double registryTextWidth = nanosPerCall(iterations / 10, [&](const int i) {
+    const EpdFontFamily* font = registry.find(readerId);
+    if (!font) return;
+    int w = 0, h = 0;
+    font->getTextDimensions(kWords[i % numWords], &w, &h);
+    sink = sink + w;
+  });
+
+  std::cout << "Fonts registered: " << registry.size() << ", iterations: " << iterations << "\n";
+  std::cout << "Font lookup      std::map: " << mapLookup << " ns/call, FontRegistry: " << registryLookup
+            << " ns/call\n";
+  std::cout << "getTextWidth     std::map: " << mapTextWidth << " ns/call, FontRegistry: " << registryTextWidth
+            << " ns/call\n";
+  return 0;
+}
@@ -0,0 +1,223 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/htmlEntities.h"
+#include "lib/Epub/Epub/htmlTags.h"
+
+// Measures how ChapterHtmlSlimParser classifies the tags and expands the entities of a tag-dense chapter: the old
+// strcmp scans over the tag lists and the linear entity scan against the perfect hash tables. Exits with 1 if the two
+// disagree on any tag or entity.
+
+namespace {
+
+const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
+const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
+const char* BOLD_TAGS[] = {"b", "strong"};
+const char* ITALIC_TAGS[] = {"i", "em"};
+const char* UNDERLINE_TAGS[] = {"u", "ins"};
+const char* IMAGE_TAGS[] = {"img"};
+const char* SKIP_TAGS[] = {"head"};
+
+template <size_t N>
+bool matches(const char* name, const char* (&tags)[N]) {
+  for (const char* tag : tags) {
+    if (strcmp(name, tag) == 0) return true;
+  }
+  return false;
+}
+
+// The checks startElement made, in its order
+HtmlTagKind scanStartTag(const char* name) {
+  if (strcmp(name, "table") == 0) return HtmlTagKind::Table;
+  if (matches(name, IMAGE_TAGS)) return HtmlTagKind::Image;
+  if (matches(name, SKIP_TAGS)) return HtmlTagKind::Skip;
+  if (matches(name, HEADER_TAGS)) return HtmlTagKind::Header;
+  if (matches(name, BLOCK_TAGS)) {
+    if (strcmp(name, "br") == 0) return HtmlTagKind::LineBreak;
+    return strcmp(name, "li") == 0 ? HtmlTagKind::ListItem : HtmlTagKind::Block;
+  }
+  if (matches(name, UNDERLINE_TAGS)) return HtmlTagKind::Underline;
+  if (matches(name, BOLD_TAGS)) return HtmlTagKind::Bold;
+  if (matches(name, ITALIC_TAGS)) return HtmlTagKind::Italic;
+  return HtmlTagKind::Other;
+}
+
+// The checks endElement made: header or block, then whether to flush the word buffer
+int scanEndTag(const char* name) {
+  const bool headerOrBlock = matches(name, HEADER_TAGS) || matches(name, BLOCK_TAGS);
+  const bool flush = headerOrBlock || matches(name, BOLD_TAGS) || matches(name, ITALIC_TAGS) ||
+                     matches(name, UNDERLINE_TAGS) || strcmp(name, "table") == 0 || matches(name, IMAGE_TAGS);
+  return headerOrBlock << 1 | flush;
+}
+
+int hashEndTag(const char* name) {
+  const HtmlTagKind kind = lookupHtmlTag(name);
+  const bool headerOrBlock = isHeaderOrBlock(kind);
+  const bool flush = headerOrBlock || kind == HtmlTagKind::Bold || kind == HtmlTagKind::Italic ||
+                     kind == HtmlTagKind::Underline || kind == HtmlTagKind::Table || kind == HtmlTagKind::Image;
+  return headerOrBlock << 1 | flush;
+}
+
+const char* scanEntity(const char* entity, const int len) {
+  for (size_t i = 0; i < ENTITY_LOOKUP_COUNT; i++) {
+    const char* key = ENTITY_LOOKUP[i].key;
+    const size_t keyLen = strlen(key);
+    if (static_cast<size_t>(len) == keyLen && memcmp(entity, key, keyLen) == 0) {
+      return ENTITY_LOOKUP[i].value;
+    }
+  }
+  return nullptr;
+}
+
+// A chapter the way converters write them: every paragraph and most words wrapped in classed spans
+std::string tagDenseChapter(const int paragraphs) {
+  const char* entities[] = {"&rsquo;", "&ldquo;", "&rdquo;", "&mdash;", "&hellip;", "&nbsp;", "&amp;", "&eacute;",
+                            "&shy;",   "&diams;", "&unknown;"};
+  std::string html = "<html><head><title>t</title><link href=\"s.css\"/></head><body><div class=\"chapter\">";
+  html += "<h2 class=\"title\"><a id=\"c1\"></a>Chapter</h2>";
+  for (int p = 0; p < paragraphs; p++) {
+    html += p % 7 == 0 ? "<blockquote><p class=\"q\">" : "<p class=\"calibre1\">";
+    for (int w = 0; w < 12; w++) {
+      switch ((p + w) % 6) {
+        case 0:
+          html += "<span class=\"s1\">word</span> ";
+          break;
+        case 1:
+          html += "<em>word</em>";
+          html += entities[(p + w) % (sizeof(entities) / sizeof(entities[0]))];
+          break;
+        case 2:
+          html += "<strong><span class=\"s2\">word</span></strong> ";
+          break;
+        case 3:
+          html += "<a href=\"#n1\"><sup>1</sup></a> ";
+          break;
+        case 4:
+          html += "<i>word</i>";
+          html += entities[(p * 3 + w) % (sizeof(entities) / sizeof(entities[0]))];
+          html += "<br/>";
+          break;
+        default:
+          html += "<small><u>word</u></small> ";
+      }
+    }
+    html += p % 7 == 0 ? "</p></blockquote>" : "</p>";
+    if (p % 25 == 24) {
+      html += "<div class=\"img\"><img src=\"i.jpg\" alt=\"\"/></div><ul><li>item</li><li>item</li></ul>";
+    }
+  }
+  return html + "</div></body></html>";
+}
+
+struct Tokens {
+  std::vector<std::string> startTags;
+  std::vector<std::string> endTags;
+  std::vector<std::string> entities;
+};
+
+Tokens tokenize(const std::string& html) {
+  Tokens tokens;
+  for (size_t i = 0; i < html.size(); i++) {
+    if (html[i] == '<') {
+      const bool end = html[i + 1] == '/';
+      size_t start = i + 1 + end;
+      size_t stop = start;
+      while (stop < html.size() && (isalnum(static_cast<unsigned char>(html[stop])) || html[stop] == ':')) stop++;
+      const std::string name = html.substr(start, stop - start);
+      (end ? tokens.endTags : tokens.startTags).push_back(name);
+      // Expat reports an end for empty elements too
+      const size_t close = html.find('>', stop);
+      if (!end && close != std::string::npos && html[close - 1] == '/') tokens.endTags.push_back(name);
+    } else if (html[i] == '&') {
+      const size_t semicolon = html.find(';', i);
+      tokens.entities.push_back(html.substr(i, semicolon - i + 1));
+    }
+  }
+  return tokens;
+}
+
+template <typename Fn>
+double nanosPerCall(const int repeats, const size_t count, Fn&& fn) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) {
+    for (size_t i = 0; i < count; i++) {
+      fn(i);
+    }
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / (static_cast<double>(repeats) * count);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int repeats = argc > 1 ? std::stoi(argv[1]) : 200;
+
+  const Tokens tokens = tokenize(tagDenseChapter(500));
+
+  int mismatches = 0;
+  for (const auto& name : tokens.startTags) {
+    if (scanStartTag(name.c_str()) != lookupHtmlTag(name.c_str())) {
+      std::cerr << "start tag mismatch: " << name << "\n";
+      mismatches++;
+    }
+  }
+  for (const auto& name : tokens.endTags) {
+    if (scanEndTag(name.c_str()) != hashEndTag(name.c_str())) {
+      std::cerr << "end tag mismatch: " << name << "\n";
+      mismatches++;
+    }
+  }
+  for (size_t i = 0; i < ENTITY_LOOKUP_COUNT; i++) {
+    const char* key = ENTITY_LOOKUP[i].key;
+    if (lookupHtmlEntity(key, static_cast<int>(strlen(key))) != ENTITY_LOOKUP[i].value) {
+      std::cerr << "entity mismatch: " << key << "\n";
+      mismatches++;
+    }
+  }
+  for (const auto& entity : tokens.entities) {
+    if (scanEntity(entity.data(), static_cast<int>(entity.size())) !=
+        lookupHtmlEntity(entity.data(), static_cast<int>(entity.size()))) {
+      std::cerr << "entity mismatch: " << entity << "\n";
+      mismatches++;
+    }
+  }
+
+  volatile intptr_t sink = 0;
+  const auto& starts = tokens.startTags;
+  const auto& ends = tokens.endTags;
+  const auto& entities = tokens.entities;
+  const double scanStart = nanosPerCall(repeats, starts.size(), [&](const size_t i) {
+    sink = sink + static_cast<int>(scanStartTag(starts[i].c_str()));
+  });
+  const double hashStart = nanosPerCall(repeats, starts.size(), [&](const size_t i) {
+    sink = sink + static_cast<int>(lookupHtmlTag(starts[i].c_str()));
+  });
+  const double scanEnd =
+      nanosPerCall(repeats, ends.size(), [&](const size_t i) { sink = sink + scanEndTag(ends[i].c_str()); });
+  const double hashEnd =
+      nanosPerCall(repeats, ends.size(), [&](const size_t i) { sink = sink + hashEndTag(ends[i].c_str()); });
+  const double scanEntities = nanosPerCall(repeats, entities.size(), [&](const size_t i) {
+    sink = sink + reinterpret_cast<intptr_t>(scanEntity(entities[i].data(), static_cast<int>(entities[i].size())));
+  });
+  const double hashEntities = nanosPerCall(repeats, entities.size(), [&](const size_t i) {
+    sink = sink +
+           reinterpret_cast<intptr_t>(lookupHtmlEntity(entities[i].data(), static_cast<int>(entities[i].size())));
+  });
+
+  std::cout << "Start tags: " << starts.size() << ", end tags: " << ends.size() << ", entities: " << entities.size()
+            << ", repeats: " << repeats << "\n";
+  std::cout << "startElement tag   scan: " << scanStart << " ns/tag, perfect hash: " << hashStart << " ns/tag\n";
+  std::cout << "endElement tag     scan: " << scanEnd << " ns/tag, perfect hash: " << hashEnd << " ns/tag\n";
+  std::cout << "entity lookup      scan: " << scanEntities << " ns/entity, perfect hash: " << hashEntities
+            << " ns/entity\n";
+  if (mismatches > 0) {
+    std::cerr << mismatches << " mismatches\n";
+    return 1;
+  }
+  return 0;
+}
@@ -1,18 +1,51 @@
 #include <Utf8.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <random>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "lib/Epub/Epub/hyphenation/HyphenationCommon.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageHyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageRegistry.h"
+#include "lib/Epub/Epub/hyphenation/TrieBlockCache.h"
+
+// Counts every heap allocation so --bench can report allocations per word. GCC doesn't know these replace the
+// global operators and warns about free() on memory from operator new.
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+std::atomic<size_t> gAllocationCount{0};
+
+void* operator new(const size_t size) {
+  gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+void* operator new[](const size_t size) { return operator new(size); }
+void* operator new(const size_t size, const std::nothrow_t&) noexcept {
+  gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size ? size : 1);
+}
+void* operator new[](const size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
 
 struct TestCase {
   std::string word;
@@ -302,13 +335,215 @@ void printResults(const std::string& language, const std::vector<TestCase>& test
   }
 }
 
+// The flash blob without its dense table, like generate_hyphenation_trie.py --no-dense-table
+std::vector<uint8_t> withoutDenseTable(const SerializedHyphenationPatterns& patterns) {
+  const auto readBigEndian = [](const uint8_t* bytes) {
+    return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+           (static_cast<uint32_t>(bytes[2]) << 8) | static_cast<uint32_t>(bytes[3]);
+  };
+  if (patterns.size < 4 || !(readBigEndian(patterns.data) & 0x80000000u)) {
+    return std::vector<uint8_t>(patterns.data, patterns.data + patterns.size);
+  }
+  std::vector<uint8_t> blob(patterns.data, patterns.data + readBigEndian(patterns.data + patterns.size - 4));
+  blob[0] &= 0x7F;
+  return blob;
+}
+
+// A trie blob written out as an SD card trie file and paged back in through TrieBlockCache, to compare against the
+// flash copy.
+class FileTrie final : public TrieBlockCache {
+ public:
+  FileTrie(const std::string& path, const std::vector<uint8_t>& blob) {
+    FILE* out = std::fopen(path.c_str(), "wb");
+    if (!out) {
+      return;
+    }
+    uint32_t header[kHyphenationTrieFileHeaderSize / sizeof(uint32_t)] = {
+        kHyphenationTrieFileMagic, kHyphenationTrieFileVersion, static_cast<uint32_t>(blob.size())};
+    std::fwrite(header, 1, sizeof(header), out);
+    std::fwrite(blob.data(), 1, blob.size(), out);
+    std::fclose(out);
+    file = std::fopen(path.c_str(), "rb");
+    trieSize = file ? blob.size() : 0;
+  }
+  ~FileTrie() override {
+    if (file) {
+      std::fclose(file);
+    }
+  }
+
+  uint32_t blockReads = 0;
+
+ protected:
+  bool readBlock(const size_t offset, uint8_t* out, const size_t length) override {
+    blockReads++;
+    return std::fseek(file, static_cast<long>(kHyphenationTrieFileHeaderSize + offset), SEEK_SET) == 0 &&
+           std::fread(out, 1, length, file) == length;
+  }
+
+ private:
+  FILE* file = nullptr;
+};
+
+// Words in the order a book would present them: every test word repeated by its frequency, shuffled with a fixed
+// seed so runs compare.
+std::vector<std::string> buildWordStream(const std::vector<TestCase>& testCases) {
+  std::vector<std::string> words;
+  for (const auto& testCase : testCases) {
+    for (int i = 0; i < std::max(testCase.frequency, 1); ++i) {
+      words.push_back(testCase.word);
+    }
+  }
+  std::mt19937 rng(42);
+  std::shuffle(words.begin(), words.end(), rng);
+  return words;
+}
+
+// Runs `hyphenate` over the stream `passes` times, prints words/s and allocations per word.
+void benchmarkMode(const char* name, const std::vector<std::string>& words, const int passes,
+                   const std::function<size_t(size_t)>& hyphenate) {
+  size_t breaks = 0;
+  const size_t allocationsBefore = gAllocationCount.load();
+  const auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; ++pass) {
+    for (size_t i = 0; i < words.size(); ++i) {
+      breaks += hyphenate(i);
+    }
+  }
+  const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  const double wordCount = static_cast<double>(words.size()) * passes;
+  const double allocations = static_cast<double>(gAllocationCount.load() - allocationsBefore);
+
+  std::cout << "  " << name << ": " << static_cast<size_t>(wordCount / elapsed) << " words/s, "
+            << allocations / wordCount << " allocations/word, " << breaks << " breaks" << std::endl;
+}
+
+// Words/s and allocations/word of the Liang evaluator alone and of Hyphenator::breakOffsets without and with a
+// chapter cache. A new cache is started every kChapterWords words, like a section build would.
+void runBenchmark(const LanguageConfig& lang) {
+  constexpr int kPasses = 5;
+  constexpr size_t kChapterWords = 5000;
+
+  const auto* hyphenator = getLanguageHyphenatorForPrimaryTag(lang.primaryTag);
+  const std::vector<TestCase> testCases = loadTestData(lang.testDataFile);
+  if (!hyphenator || testCases.empty()) {
+    std::cerr << "No hyphenator or test data for " << lang.cliName << ". Skipping." << std::endl;
+    return;
+  }
+  const std::vector<std::string> words = buildWordStream(testCases);
+  Hyphenator::setPreferredLanguage(lang.primaryTag);
+  std::cout << lang.cliName << " (" << words.size() << " words x " << kPasses << ")" << std::endl;
+
+  benchmarkMode("liang", words, kPasses, [&](const size_t i) {
+    CodepointInfo cps[kLiangMaxWordCodepoints];
+    const size_t count = collectCodepoints(words[i], cps, kLiangMaxWordCodepoints);
+    size_t begin = 0;
+    size_t end = count;
+    trimSurroundingPunctuationAndFootnote(cps, begin, end);
+    return static_cast<size_t>(__builtin_popcountll(hyphenator->breakMask(cps + begin, end - begin)));
+  });
+
+  // Trie files for the SD card are written without the dense table, the flash copy has it
+  const std::vector<uint8_t> flashBlob(hyphenator->patterns().data,
+                                       hyphenator->patterns().data + hyphenator->patterns().size);
+  const std::vector<uint8_t> sdBlob = withoutDenseTable(hyphenator->patterns());
+  const struct {
+    const char* name;
+    const std::vector<uint8_t>& blob;
+  } trieFiles[] = {{"liang (trie file)", sdBlob}, {"liang (trie file, dense table)", flashBlob}};
+  for (const auto& trieFile : trieFiles) {
+    if (&trieFile.blob == &flashBlob && flashBlob.size() == sdBlob.size()) {
+      continue;
+    }
+    FileTrie fileTrie("build/hyphenation_eval/hyph-" + std::string(lang.primaryTag) + ".trie", trieFile.blob);
+    const SerializedHyphenationPatterns filePatterns{nullptr, fileTrie.size(), &fileTrie};
+    benchmarkMode(trieFile.name, words, kPasses, [&](const size_t i) {
+      CodepointInfo cps[kLiangMaxWordCodepoints];
+      const size_t count = collectCodepoints(words[i], cps, kLiangMaxWordCodepoints);
+      size_t begin = 0;
+      size_t end = count;
+      trimSurroundingPunctuationAndFootnote(cps, begin, end);
+      return static_cast<size_t>(
+          __builtin_popcountll(liangBreakMask(cps + begin, end - begin, filePatterns, hyphenator->config())));
+    });
+    const uint32_t trieLookups = std::max<uint32_t>(fileTrie.hits + fileTrie.misses, 1);
+    std::cout << "    " << fileTrie.blockReads << " block reads of " << TrieBlockCache::kBlockSize
+              << " bytes, block cache hit rate " << (fileTrie.hits * 100.0 / trieLookups) << "%" << std::endl;
+  }
+
+  Hyphenator::Breaks breaks;
+  benchmarkMode("breakOffsets", words, kPasses, [&](const size_t i) {
+    Hyphenator::breakOffsets(words[i], false, breaks);
+    return breaks.count;
+  });
+
+  std::unique_ptr<Hyphenator::ChapterCache> cache;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  benchmarkMode("breakOffsets+cache", words, kPasses, [&](const size_t i) {
+    if (i % kChapterWords == 0) {
+      if (cache) {
+        hits += cache->hits;
+        misses += cache->misses;
+      }
+      cache.reset();
+      cache = std::make_unique<Hyphenator::ChapterCache>();
+    }
+    Hyphenator::breakOffsets(words[i], false, breaks);
+    return breaks.count;
+  });
+  hits += cache->hits;
+  misses += cache->misses;
+
+  // The hit rate a cache with room for every word of a chapter would reach
+  size_t repeats = 0;
+  std::unordered_set<std::string> chapterWords;
+  for (size_t i = 0; i < words.size(); ++i) {
+    if (i % kChapterWords == 0) {
+      chapterWords.clear();
+    }
+    repeats += chapterWords.insert(words[i]).second ? 0 : 1;
+  }
+  std::cout << "  cache hit rate: " << (hits * 100.0 / std::max<uint32_t>(hits + misses, 1)) << "%, "
+            << (repeats * 100.0 / std::max<size_t>(words.size(), 1)) << "% with unlimited entries" << std::endl;
+}
+
+void printUsage(std::ostream& out) {
+  out << "usage: HyphenationEvaluationTest [language | all]\n"
+         "       HyphenationEvaluationTest --bench [language | all]\n"
+         "languages:";
+  for (const auto& config : kSupportedLanguages) {
+    out << " " << config.cliName;
+  }
+  out << std::endl;
+}
+
 int main(int argc, char* argv[]) {
+  if (argc > 1 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")) {
+    printUsage(std::cout);
+    return 0;
+  }
+
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    const std::vector<LanguageConfig> languages = resolveLanguages(argc > 2 ? argv[2] : "all");
+    if (languages.empty()) {
+      std::cerr << "Unknown language: " << argv[2] << std::endl;
+      printUsage(std::cerr);
+      return 1;
+    }
+    for (const auto& lang : languages) {
+      runBenchmark(lang);
+    }
+    return 0;
+  }
+
   const bool summaryMode = argc <= 1;
   const std::string languageSelection = summaryMode ? "all" : argv[1];
 
   std::vector<LanguageConfig> languages = resolveLanguages(languageSelection);
   if (languages.empty()) {
     std::cerr << "Unknown language: " << languageSelection << std::endl;
+    printUsage(std::cerr);
     return 1;
   }
 
@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/host"
+SD_ROOT="$ROOT_DIR/build/css_test_sd"
+
+# The rule caches are written to an empty card
+rm -rf "$SD_ROOT"
+mkdir -p "$SD_ROOT"
+
+cmake -S "$ROOT_DIR/host" -B "$BUILD_DIR" -DCMAKE_BUILD_TYPE=RelWithDebInfo -DCROSSPOINT_LOG_LEVEL=0 > /dev/null
+cmake --build "$BUILD_DIR" -j --target HostCssTest
+
+CROSSPOINT_SD_ROOT="$SD_ROOT" "$BUILD_DIR/HostCssTest" "$@"
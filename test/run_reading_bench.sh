@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/host"
+SD_ROOT="$ROOT_DIR/build/bench_sd"
+
+if [ ! -d "$SD_ROOT/bench" ]; then
+  python3 "$ROOT_DIR/scripts/generate_bench_corpus.py" "$SD_ROOT/bench"
+fi
+
+cmake -S "$ROOT_DIR/host" -B "$BUILD_DIR" -DCMAKE_BUILD_TYPE=RelWithDebInfo -DCROSSPOINT_LOG_LEVEL=0 > /dev/null
+cmake --build "$BUILD_DIR" -j --target HostBench
+
+CROSSPOINT_SD_ROOT="$SD_ROOT" CROSSPOINT_FRAME_DIR="$BUILD_DIR/frames" "$BUILD_DIR/HostBench" "$@" /bench
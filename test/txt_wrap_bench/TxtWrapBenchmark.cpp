@@ -0,0 +1,193 @@
+#include <EpdFontFamily.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "lib/EpdFont/builtinFonts/bookerly_14_regular.h"
+#include "lib/Txt/TxtPaginator.h"
+
+// Builds the page index of a TXT book the way TxtReaderActivity did, re-measuring every candidate line with
+// getTextWidth() in 8KB chunks, and with TxtPaginator's single pass. Exits with 1 if the two disagree. The books keep
+// their lines under the chunk size, the old reader cut longer lines at its chunk boundaries.
+
+namespace {
+
+constexpr size_t CHUNK_SIZE = 8 * 1024;  // TxtReaderActivity's CHUNK_SIZE
+constexpr int VIEWPORT_WIDTH = 440;
+constexpr int LINES_PER_PAGE = 25;
+
+const char* WORDS[] = {"the", "of", "and", "to", "in", "a", "is", "that", "for", "it", "was", "with", "be",
+                       "by", "on", "not", "work", "world", "people", "between", "extraordinary",
+                       // Multi-byte codepoints: "café", "naïve" and an em dash
+                       "caf\xc3\xa9", "na\xc3\xafve", "\xe2\x80\x94"};
+
+// Paragraphs of `sentences` sentences, each on one line with a blank line after it, some with CR LF line ends
+std::string book(const size_t size, const int sentences, const unsigned seed) {
+  std::mt19937 rng(seed);
+  std::string text;
+  while (text.size() < size) {
+    for (int s = 0; s < sentences; s++) {
+      const int words = 6 + static_cast<int>(rng() % 16);
+      for (int w = 0; w < words; w++) {
+        text += WORDS[rng() % (sizeof(WORDS) / sizeof(WORDS[0]))];
+        text += w + 1 < words ? " " : ". ";
+      }
+    }
+    text += rng() % 4 == 0 ? "\r\n\r\n" : "\n\n";
+  }
+  return text;
+}
+
+int textWidth(const EpdFontFamily& font, const std::string& text) {
+  int w = 0, h = 0;
+  font.getTextDimensions(text.c_str(), &w, &h);
+  return w;
+}
+
+// TxtReaderActivity::loadPageAtOffset before the streaming paginator, reading from memory
+bool oldLoadPage(const EpdFontFamily& font, const std::string& file, const size_t offset, size_t& nextOffset) {
+  const size_t fileSize = file.size();
+  if (offset >= fileSize) {
+    return false;
+  }
+  const size_t chunkSize = std::min(CHUNK_SIZE, fileSize - offset);
+  const std::string buffer = file.substr(offset, chunkSize);
+
+  int lines = 0;
+  size_t pos = 0;
+  while (pos < chunkSize && lines < LINES_PER_PAGE) {
+    size_t lineEnd = pos;
+    while (lineEnd < chunkSize && buffer[lineEnd] != '\n') {
+      lineEnd++;
+    }
+    const bool lineComplete = lineEnd < chunkSize || offset + lineEnd >= fileSize;
+    if (!lineComplete && lines > 0) {
+      break;
+    }
+
+    const size_t lineContentLen = lineEnd - pos;
+    const bool hasCR = lineContentLen > 0 && buffer[pos + lineContentLen - 1] == '\r';
+    const size_t displayLen = hasCR ? lineContentLen - 1 : lineContentLen;
+    std::string line = buffer.substr(pos, displayLen);
+    size_t lineBytePos = 0;
+
+    while (!line.empty() && lines < LINES_PER_PAGE) {
+      if (textWidth(font, line) <= VIEWPORT_WIDTH) {
+        lines++;
+        lineBytePos = displayLen;
+        line.clear();
+        break;
+      }
+      size_t breakPos = line.length();
+      while (breakPos > 0 && textWidth(font, line.substr(0, breakPos)) > VIEWPORT_WIDTH) {
+        const size_t spacePos = line.rfind(' ', breakPos - 1);
+        if (spacePos != std::string::npos && spacePos > 0) {
+          breakPos = spacePos;
+        } else {
+          breakPos--;
+          while (breakPos > 0 && (line[breakPos] & 0xC0) == 0x80) {
+            breakPos--;
+          }
+        }
+      }
+      if (breakPos == 0) {
+        breakPos = 1;
+      }
+      lines++;
+      size_t skipChars = breakPos;
+      if (breakPos < line.length() && line[breakPos] == ' ') {
+        skipChars++;
+      }
+      lineBytePos += skipChars;
+      line = line.substr(skipChars);
+    }
+
+    if (line.empty()) {
+      pos = lineEnd + 1;
+    } else {
+      pos = pos + lineBytePos;
+      break;
+    }
+  }
+  if (pos == 0 && lines > 0) {
+    pos = 1;
+  }
+  nextOffset = std::min(offset + pos, fileSize);
+  return lines > 0;
+}
+
+std::vector<size_t> oldIndex(const EpdFontFamily& font, const std::string& file) {
+  std::vector<size_t> offsets = {0};
+  size_t offset = 0;
+  while (offset < file.size()) {
+    size_t nextOffset = offset;
+    if (!oldLoadPage(font, file, offset, nextOffset) || nextOffset <= offset) {
+      break;
+    }
+    offset = nextOffset;
+    if (offset < file.size()) {
+      offsets.push_back(offset);
+    }
+  }
+  return offsets;
+}
+
+std::vector<size_t> newIndex(const EpdFontFamily& font, const std::string& file) {
+  std::vector<size_t> offsets = {0};
+  TxtPaginator paginator(font, VIEWPORT_WIDTH, LINES_PER_PAGE);
+  paginator.onPage = [&](const size_t nextPageOffset) {
+    if (nextPageOffset < file.size()) {
+      offsets.push_back(nextPageOffset);
+    }
+    return true;
+  };
+  paginator.restart(0);
+  for (size_t offset = 0; offset < file.size(); offset += CHUNK_SIZE) {
+    paginator.feed(reinterpret_cast<const uint8_t*>(file.data()) + offset, std::min(CHUNK_SIZE, file.size() - offset));
+  }
+  paginator.finish();
+  return offsets;
+}
+
+template <typename Fn>
+double millis(Fn&& fn) {
+  const auto start = std::chrono::steady_clock::now();
+  fn();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const size_t size = argc > 1 ? std::stoul(argv[1]) : 1024 * 1024;
+
+  const EpdFont bookerly(&bookerly_14_regular);
+  const EpdFontFamily font(&bookerly);
+
+  int failures = 0;
+  struct Book {
+    const char* name;
+    std::string text;
+  };
+  // Re-measuring makes the old index quadratic in the line length, the long line book is kept small
+  const Book books[] = {{"paragraphs", book(size, 5, 1)}, {"long lines", book(size / 64, 50, 2)}};
+  for (const auto& b : books) {
+    std::vector<size_t> oldOffsets;
+    std::vector<size_t> newOffsets;
+    const double oldMs = millis([&] { oldOffsets = oldIndex(font, b.text); });
+    const double newMs = millis([&] { newOffsets = newIndex(font, b.text); });
+    std::cout << b.name << " (" << b.text.size() << " bytes): old " << oldMs << " ms, " << oldOffsets.size()
+              << " pages, streaming " << newMs << " ms, " << newOffsets.size() << " pages\n";
+    if (oldOffsets != newOffsets) {
+      const auto mismatch = std::mismatch(oldOffsets.begin(), oldOffsets.end(), newOffsets.begin(), newOffsets.end());
+      std::cerr << b.name << ": page offsets differ from page " << (mismatch.first - oldOffsets.begin()) << "\n";
+      failures++;
+    }
+  }
+  return failures > 0 ? 1 : 0;
+}